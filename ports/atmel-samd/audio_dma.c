@@ -322,14 +322,17 @@ void audio_dma_background(void) {
         }
 
         bool block_done = event_interrupt_active(dma->event_channel);
-        if (!block_done) {
-            continue;
-        }
 
         // audio_dma_load_next_block() can call Python code, which can call audio_dma_background()
         // recursively at the next background processing time. So disallow recursive calls to here.
         audio_dma_pending[i] = true;
-        audio_dma_load_next_block(dma);
+        if (block_done) {
+            audio_dma_load_next_block(dma);
+        }
+        // Read ahead while the DMA plays the blocks it has.
+        if (dma->dma_channel < AUDIO_DMA_CHANNEL_COUNT) {
+            audiosample_background(dma->sample);
+        }
         audio_dma_pending[i] = false;
     }
 }
@@ -38,6 +38,10 @@
 #include "shared-module/displayio/__init__.h"
 #endif
 
+#if CIRCUITPY_AUDIOBUSIO
+#include "common-hal/audiobusio/PDMIn.h"
+#endif
+
 volatile uint64_t last_finished_tick = 0;
 
 bool stack_ok_so_far = true;
@@ -59,6 +63,9 @@ void run_background_tasks(void) {
     #if (defined(SAMD21) && defined(PIN_PA02)) || defined(SAMD51)
     audio_dma_background();
     #endif
+    #if CIRCUITPY_AUDIOBUSIO
+    pdmin_background();
+    #endif
     #if CIRCUITPY_DISPLAYIO
     displayio_refresh_displays();
     #endif
@@ -86,7 +86,8 @@ void board_init(void) {
         MIPI_COMMAND_SET_COLUMN_ADDRESS, // Set column command
         MIPI_COMMAND_SET_PAGE_ADDRESS, // Set row command
         MIPI_COMMAND_WRITE_MEMORY_START, // Write memory command
-        0x37, // Set vertical scroll command
+        0, // No vertical scroll. MADCTL swaps rows and columns so the panel scrolls sideways.
+        0, // Memory height, only needed for vertical scroll
         display_init_sequence,
         sizeof(display_init_sequence),
         &pin_PB31,
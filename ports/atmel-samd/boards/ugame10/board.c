@@ -95,6 +95,7 @@ void board_init(void) {
         MIPI_COMMAND_SET_PAGE_ADDRESS, // Set row command
         MIPI_COMMAND_WRITE_MEMORY_START, // Write memory command
         0x37, // set vertical scroll command
+        162, // ST7735 memory height
         display_init_sequence,
         sizeof(display_init_sequence),
         NULL,
@@ -34,6 +34,7 @@
 #include "common-hal/analogio/AnalogOut.h"
 #include "common-hal/audiobusio/PDMIn.h"
 #include "shared-bindings/analogio/AnalogOut.h"
+#include "shared-bindings/audiobusio/PDMDecimator.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "supervisor/shared/translate.h"
@@ -65,13 +66,14 @@
 #define SERCTRL(name) I2S_RXCTRL_ ## name
 #endif
 
+// Stops background recording. The PDMIn itself is left alone because the heap is being reset.
 void pdmin_reset(void) {
-    while (I2S->SYNCBUSY.reg & I2S_SYNCBUSY_ENABLE) {}
-    I2S->INTENCLR.reg = I2S_INTENCLR_MASK;
-    I2S->INTFLAG.reg = I2S_INTFLAG_MASK;
-    I2S->CTRLA.reg &= ~I2S_SYNCBUSY_ENABLE;
-    while (I2S->SYNCBUSY.reg & I2S_SYNCBUSY_ENABLE) {}
-    I2S->CTRLA.reg = I2S_CTRLA_SWRST;
+    audiobusio_pdmin_obj_t* self = MP_STATE_PORT(recording_pdmin);
+    if (self != NULL) {
+        disable_event_channel(self->event_channel);
+        dma_disable_channel(self->dma_channel);
+    }
+    MP_STATE_PORT(recording_pdmin) = NULL;
 }
 
 void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
@@ -80,7 +82,8 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
                                            uint32_t sample_rate,
                                            uint8_t bit_depth,
                                            bool mono,
-                                           uint8_t oversample) {
+                                           uint8_t oversample,
+                                           uint32_t buffer_size) {
     self->clock_pin = clock_pin; // PA10, PA20 -> SCK0, PB11 -> SCK1
     #ifdef SAMD21
         if (clock_pin == &pin_PA10
@@ -216,6 +219,12 @@ void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
 
     self->bytes_per_sample = oversample >> 3;
     self->bit_depth = bit_depth;
+
+    common_hal_audiobusio_pdmdecimator_construct(&self->decimator, oversample, bit_depth, buffer_size);
+    self->first_buffer = NULL;
+    self->second_buffer = NULL;
+    self->second_descriptor = NULL;
+    self->recording = false;
 }
 
 bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t* self) {
@@ -226,6 +235,11 @@ void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t* self) {
     if (common_hal_audiobusio_pdmin_deinited(self)) {
         return;
     }
+    common_hal_audiobusio_pdmin_stop(self);
+    common_hal_audiobusio_pdmdecimator_deinit(&self->decimator);
+    self->first_buffer = NULL;
+    self->second_buffer = NULL;
+    self->second_descriptor = NULL;
 
     i2s_set_serializer_enable(self->serializer, false);
     i2s_set_clock_unit_enable(self->clock_unit, false);
@@ -308,49 +322,6 @@ static void setup_dma(audiobusio_pdmin_obj_t* self, uint32_t length,
     }
 }
 
-// a windowed sinc filter for 44 khz, 64 samples
-//
-// This filter is good enough to use for lower sample rates as
-// well. It does not increase the noise enough to be a problem.
-//
-// In the long run we could use a fast filter like this to do the
-// decimation and initial filtering in real time, filtering to a
-// higher sample rate than specified.  Then after the audio is
-// recorded, a more expensive filter non-real-time filter could be
-// used to down-sample and low-pass.
-uint16_t sinc_filter [OVERSAMPLING] = {
-    0, 2, 9, 21, 39, 63, 94, 132,
-    179, 236, 302, 379, 467, 565, 674, 792,
-    920, 1055, 1196, 1341, 1487, 1633, 1776, 1913,
-    2042, 2159, 2263, 2352, 2422, 2474, 2506, 2516,
-    2506, 2474, 2422, 2352, 2263, 2159, 2042, 1913,
-    1776, 1633, 1487, 1341, 1196, 1055, 920, 792,
-    674, 565, 467, 379, 302, 236, 179, 132,
-    94, 63, 39, 21, 9, 2, 0, 0
-};
-
-#define REPEAT_16_TIMES(X) X X X X X X X X X X X X X X X X
-
-static uint16_t filter_sample(uint32_t pdm_samples[4]) {
-    uint16_t running_sum = 0;
-    const uint16_t *filter_ptr = sinc_filter;
-    for (uint8_t i = 0; i < OVERSAMPLING/16; i++) {
-        // The sample is 16-bits right channel in the upper two bytes and 16-bits left channel
-        // in the lower two bytes.
-        // We just ignore the upper bits
-        uint32_t pdm_sample = pdm_samples[i];
-        REPEAT_16_TIMES( {
-                if (pdm_sample & 0x8000) {
-                    running_sum += *filter_ptr;
-                }
-                filter_ptr++;
-                pdm_sample <<= 1;
-            }
-            )
-    }
-    return running_sum;
-}
-
 // output_buffer may be a byte buffer or a halfword buffer.
 // output_buffer_length is the number of slots, not the number of bytes.
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* self,
@@ -370,6 +341,7 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
     uint32_t second_buffer[words_per_buffer];
 
     turn_on_event_system();
+    audiobusio_pdmdecimator_reset(&self->decimator);
 
     COMPILER_ALIGNED(16) DmacDescriptor second_descriptor;
 
@@ -427,17 +399,10 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
         uint32_t samples_gathered = descriptor->BTCNT.reg / words_per_sample;
         // Don't run off the end of output buffer. Process only as many as needed.
         uint32_t samples_to_process = min(remaining_samples_needed, samples_gathered);
-        for (uint32_t i = 0; i < samples_to_process; i++) {
-            // Call filter_sample just one place so it can be inlined.
-            uint16_t value = filter_sample(buffer + i * words_per_sample);
-            if (self->bit_depth == 8) {
-                // Truncate to 8 bits.
-                ((uint8_t*) output_buffer)[values_output] = value >> 8;
-            } else {
-                output_buffer[values_output] = value;
-            }
-            values_output++;
-        }
+        // Whole samples of PDM decimate into exactly as many samples.
+        values_output += audiobusio_pdmdecimator_decimate(&self->decimator, (uint8_t*) buffer,
+            samples_to_process * words_per_sample * sizeof(uint32_t), AUDIOBUSIO_PDM_LOW_HALFWORDS,
+            ((uint8_t*) output_buffer) + values_output * (self->bit_depth / 8));
 
         buffers_processed++;
 
@@ -476,3 +441,104 @@ uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* se
 void common_hal_audiobusio_pdmin_record_to_file(audiobusio_pdmin_obj_t* self, uint8_t* buffer, uint32_t length) {
 
 }
+
+void common_hal_audiobusio_pdmin_start(audiobusio_pdmin_obj_t* self) {
+    if (self->recording) {
+        return;
+    }
+    uint8_t dma_channel = find_free_audio_dma_channel();
+    if (dma_channel >= AUDIO_DMA_CHANNEL_COUNT) {
+        mp_raise_RuntimeError(translate("No DMA channel found"));
+    }
+    uint8_t event_channel = find_sync_event_channel();
+    if (event_channel >= EVSYS_SYNCH_NUM) {
+        mp_raise_RuntimeError(translate("All sync event channels in use"));
+    }
+
+    uint8_t words_per_sample = self->bytes_per_sample / 2;
+    uint32_t words_per_buffer = SAMPLES_PER_BUFFER * words_per_sample;
+    if (self->first_buffer == NULL) {
+        self->first_buffer = (uint32_t*) m_malloc(words_per_buffer * sizeof(uint32_t), false);
+        self->second_buffer = (uint32_t*) m_malloc(words_per_buffer * sizeof(uint32_t), false);
+        self->second_descriptor = (DmacDescriptor*) m_malloc(sizeof(DmacDescriptor), false);
+    }
+    audiobusio_pdmdecimator_reset(&self->decimator);
+
+    turn_on_event_system();
+    // Asking for two full buffers chains the descriptors into a loop.
+    setup_dma(self, 2 * SAMPLES_PER_BUFFER, dma_descriptor(dma_channel), self->second_descriptor,
+              words_per_buffer, words_per_sample, self->first_buffer, self->second_buffer);
+
+    uint8_t trigger_source = I2S_DMAC_ID_RX_0;
+    #ifdef SAMD21
+    trigger_source += self->serializer;
+    #endif
+
+    dma_configure(dma_channel, trigger_source, true);
+    init_event_channel_interrupt(event_channel, CORE_GCLK, EVSYS_ID_GEN_DMAC_CH_0 + dma_channel);
+
+    self->dma_channel = dma_channel;
+    self->event_channel = event_channel;
+    self->use_first_buffer = true;
+    self->recording = true;
+    // Keeps the buffers from being collected while DMA writes to them.
+    MP_STATE_PORT(recording_pdmin) = self;
+
+    i2s_set_serializer_enable(self->serializer, true);
+    dma_enable_channel(dma_channel);
+}
+
+void common_hal_audiobusio_pdmin_stop(audiobusio_pdmin_obj_t* self) {
+    if (!self->recording) {
+        return;
+    }
+    disable_event_channel(self->event_channel);
+    dma_disable_channel(self->dma_channel);
+    // Turn off serializer, but leave clock on, to avoid mic startup delay.
+    i2s_set_serializer_enable(self->serializer, false);
+    self->recording = false;
+    MP_STATE_PORT(recording_pdmin) = NULL;
+}
+
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t* self) {
+    return self->recording;
+}
+
+uint32_t common_hal_audiobusio_pdmin_read(audiobusio_pdmin_obj_t* self, uint8_t* data,
+                                          uint32_t length) {
+    return common_hal_audiobusio_pdmdecimator_read(&self->decimator, data, length);
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_in_waiting(audiobusio_pdmin_obj_t* self) {
+    return common_hal_audiobusio_pdmdecimator_get_in_waiting(&self->decimator);
+}
+
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t* self) {
+    return common_hal_audiobusio_pdmdecimator_get_overruns(&self->decimator);
+}
+
+// WARN(tannewt): DO NOT print from here. Printing calls background tasks such as this and causes a
+// stack overflow.
+
+void pdmin_background(void) {
+    audiobusio_pdmin_obj_t* self = MP_STATE_PORT(recording_pdmin);
+    if (self == NULL) {
+        return;
+    }
+    // Waiting for the event clears the overflow flag too so check it first.
+    bool overflow = event_interrupt_overflow(self->event_channel);
+    if (!event_interrupt_active(self->event_channel)) {
+        return;
+    }
+    if (overflow) {
+        // A second buffer filled before the first was decimated and DMA has started over on the
+        // first. Skip it and decimate the second, which is whole.
+        self->decimator.overruns += SAMPLES_PER_BUFFER;
+        self->use_first_buffer = !self->use_first_buffer;
+    }
+    uint32_t* buffer = self->use_first_buffer ? self->first_buffer : self->second_buffer;
+    self->use_first_buffer = !self->use_first_buffer;
+    uint32_t words_per_buffer = SAMPLES_PER_BUFFER * self->bytes_per_sample / 2;
+    audiobusio_pdmdecimator_push(&self->decimator, (uint8_t*) buffer,
+                                 words_per_buffer * sizeof(uint32_t), AUDIOBUSIO_PDM_LOW_HALFWORDS);
+}
@@ -31,6 +31,7 @@
 
 #include "extmod/vfs_fat.h"
 #include "py/obj.h"
+#include "shared-module/audiobusio/PDMDecimator.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -42,6 +43,17 @@ typedef struct {
     uint8_t bytes_per_sample;
     uint8_t bit_depth;
     uint8_t gclk;
+
+    // Decimated samples wait in the decimator's ring until they are read. While recording in the
+    // background DMA fills the two buffers in turn and pdmin_background decimates each as it fills.
+    audiobusio_pdmdecimator_obj_t decimator;
+    uint32_t* first_buffer;
+    uint32_t* second_buffer;
+    DmacDescriptor* second_descriptor;
+    uint8_t dma_channel;
+    uint8_t event_channel;
+    bool use_first_buffer;
+    bool recording;
 } audiobusio_pdmin_obj_t;
 
 void pdmin_reset(void);
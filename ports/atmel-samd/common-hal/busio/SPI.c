@@ -311,6 +311,7 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     if (len == 0) {
         return true;
     }
+    sercom_dma_finish_write(self->spi_desc.dev.prvt);
     int32_t status;
     if (len >= 16) {
         status = sercom_dma_write(self->spi_desc.dev.prvt, data, len);
@@ -322,11 +323,36 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self,
     return status >= 0; // Status is number of chars read or an error code < 0.
 }
 
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self,
+        const uint8_t *data, size_t len) {
+    // Short writes aren't worth setting up DMA for so do them right away.
+    if (len < 16) {
+        return common_hal_busio_spi_write(self, data, len);
+    }
+    if (sercom_dma_start_write(self->spi_desc.dev.prvt, data, len) >= 0) {
+        return true;
+    }
+    // The shared DMA channels are in use so write without DMA instead.
+    struct io_descriptor *spi_io;
+    spi_m_sync_get_io_descriptor(&self->spi_desc, &spi_io);
+    return spi_io->write(spi_io, data, len) >= 0;
+}
+
+bool common_hal_busio_spi_write_done(busio_spi_obj_t *self) {
+    Sercom* sercom = self->spi_desc.dev.prvt;
+    if (!sercom_dma_write_done(sercom)) {
+        return false;
+    }
+    sercom_dma_finish_write(sercom);
+    return true;
+}
+
 bool common_hal_busio_spi_read(busio_spi_obj_t *self,
         uint8_t *data, size_t len, uint8_t write_value) {
     if (len == 0) {
         return true;
     }
+    sercom_dma_finish_write(self->spi_desc.dev.prvt);
     int32_t status;
     if (len >= 16) {
         status = sercom_dma_read(self->spi_desc.dev.prvt, data, len, write_value);
@@ -345,6 +371,7 @@ bool common_hal_busio_spi_transfer(busio_spi_obj_t *self, uint8_t *data_out, uin
     if (len == 0) {
         return true;
     }
+    sercom_dma_finish_write(self->spi_desc.dev.prvt);
     int32_t status;
     if (len >= 16) {
         status = sercom_dma_transfer(self->spi_desc.dev.prvt, data_out, data_in, len);
@@ -35,6 +35,7 @@
 #define MICROPY_PY_SYS_PLATFORM                     "Atmel SAMD21"
 #define SPI_FLASH_MAX_BAUDRATE 8000000
 #define CIRCUITPY_DEFAULT_STACK_SIZE                4096
+#define CIRCUITPY_DISPLAY_BUFFER_SIZE               256
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (0)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT          (0)
 #define MICROPY_PY_FUNCTION_ATTRS                   (0)
@@ -42,6 +43,8 @@
 #define MICROPY_PY_IO                               (0)
 #define MICROPY_PY_UJSON                            (0)
 #define MICROPY_PY_REVERSE_SPECIAL_METHODS          (0)
+// Not enough flash for the qstr hash index.
+#define MICROPY_QSTR_HASH_INDEX                     (0)
 #define MICROPY_PY_UERRNO_LIST \
     X(EPERM) \
     X(ENOENT) \
@@ -62,6 +65,7 @@
 #define SPI_FLASH_MAX_BAUDRATE 24000000
 // 24kiB stack
 #define CIRCUITPY_DEFAULT_STACK_SIZE                0x6000
+#define CIRCUITPY_DISPLAY_BUFFER_SIZE               1024
 #define MICROPY_PY_BUILTINS_NOTIMPLEMENTED          (1)
 #define MICROPY_PY_COLLECTIONS_ORDEREDDICT          (1)
 #define MICROPY_PY_FUNCTION_ATTRS                   (1)
@@ -80,6 +84,7 @@
 
 #define MICROPY_PORT_ROOT_POINTERS \
     CIRCUITPY_COMMON_ROOT_POINTERS \
-    mp_obj_t playing_audio[AUDIO_DMA_CHANNEL_COUNT];
+    mp_obj_t playing_audio[AUDIO_DMA_CHANNEL_COUNT]; \
+    mp_obj_t recording_pdmin;
 
 #endif  // __INCLUDED_MPCONFIGPORT_H
@@ -18,6 +18,12 @@ endif
 ifeq ($(CHIP_FAMILY),samd21)
 # frequencyio not yet verified as working on SAMD21.
 CIRCUITPY_FRQUENCYIO = 0
+# fft takes about 6 KB of flash, 2 KB of it the sine table, so boards have to turn it on.
+ifndef CIRCUITPY_FFT
+CIRCUITPY_FFT = 0
+endif
+# No FPU so only fixed point FFTs.
+CIRCUITPY_FFT_FLOAT = 0
 endif
 
 # Put samd51-only choices here.
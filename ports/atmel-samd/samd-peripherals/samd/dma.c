@@ -71,14 +71,24 @@ void init_shared_dma(void) {
     }
 }
 
+// Sercom whose write was started by sercom_dma_start_write and hasn't been finished yet.
+static Sercom* pending_write_sercom = NULL;
+static bool shared_rx_active = false;
+static bool shared_tx_active = false;
+
 // Do write and read simultaneously. If buffer_out is NULL, write the tx byte over and over.
 // If buffer_out is a real buffer, ignore tx.
 // DMAs buffer_out -> dest
 // DMAs src -> buffer_in
-static int32_t shared_dma_transfer(void* peripheral,
-                                   const uint8_t* buffer_out, volatile uint32_t* dest,
-                                   volatile uint32_t* src, uint8_t* buffer_in,
-                                   uint32_t length, uint8_t tx) {
+// Returns 0 once the transfer has started and a negative error code if it couldn't be.
+static int32_t shared_dma_transfer_start(void* peripheral,
+                                         const uint8_t* buffer_out, volatile uint32_t* dest,
+                                         volatile uint32_t* src, uint8_t* buffer_in,
+                                         uint32_t length, const uint8_t* tx) {
+    // A write started in the background must complete before we reuse the channels.
+    if (pending_write_sercom != NULL) {
+        sercom_dma_finish_write(pending_write_sercom);
+    }
     if (!dma_channel_free(SHARED_TX_CHANNEL) ||
         (buffer_in != NULL && !dma_channel_free(SHARED_RX_CHANNEL))) {
         return -1;
@@ -86,8 +96,8 @@ static int32_t shared_dma_transfer(void* peripheral,
 
     uint32_t beat_size = DMAC_BTCTRL_BEATSIZE_BYTE;
     bool sercom = true;
-    bool tx_active = false;
-    bool rx_active = false;
+    shared_tx_active = false;
+    shared_rx_active = false;
     uint16_t beat_length = length;
     #ifdef SAMD51
     if (peripheral == QSPI) {
@@ -101,10 +111,10 @@ static int32_t shared_dma_transfer(void* peripheral,
         sercom = false;
         if (buffer_out != NULL) {
             dma_configure(SHARED_TX_CHANNEL, QSPI_DMAC_ID_TX, false);
-            tx_active = true;
+            shared_tx_active = true;
         } else {
             dma_configure(SHARED_RX_CHANNEL, QSPI_DMAC_ID_RX, false);
-            rx_active = true;
+            shared_rx_active = true;
         }
 
     } else {
@@ -112,10 +122,10 @@ static int32_t shared_dma_transfer(void* peripheral,
 
         // sercom index is incorrect for SAMD51
         dma_configure(SHARED_TX_CHANNEL, sercom_index(peripheral) * 2 + FIRST_SERCOM_TX_TRIGSRC, false);
-        tx_active = true;
+        shared_tx_active = true;
         if (buffer_in != NULL) {
             dma_configure(SHARED_RX_CHANNEL, sercom_index(peripheral) * 2 + FIRST_SERCOM_RX_TRIGSRC, false);
-            rx_active = true;
+            shared_rx_active = true;
         }
 
     #ifdef SAMD51
@@ -123,7 +133,7 @@ static int32_t shared_dma_transfer(void* peripheral,
     #endif
 
     // Set up RX first.
-    if (rx_active) {
+    if (shared_rx_active) {
         DmacDescriptor* rx_descriptor = &dma_descriptors[SHARED_RX_CHANNEL];
         rx_descriptor->BTCTRL.reg = beat_size | DMAC_BTCTRL_DSTINC;
         rx_descriptor->BTCNT.reg = beat_length;
@@ -138,7 +148,7 @@ static int32_t shared_dma_transfer(void* peripheral,
     }
 
     // Set up TX second.
-    if (tx_active) {
+    if (shared_tx_active) {
         DmacDescriptor* tx_descriptor = &dma_descriptors[SHARED_TX_CHANNEL];
         tx_descriptor->BTCTRL.reg = beat_size;
         tx_descriptor->BTCNT.reg = beat_length;
@@ -147,7 +157,7 @@ static int32_t shared_dma_transfer(void* peripheral,
             tx_descriptor->SRCADDR.reg = ((uint32_t)buffer_out + length);
             tx_descriptor->BTCTRL.reg |= DMAC_BTCTRL_SRCINC;
         } else {
-            tx_descriptor->SRCADDR.reg = ((uint32_t) &tx);
+            tx_descriptor->SRCADDR.reg = ((uint32_t) tx);
         }
         tx_descriptor->DSTADDR.reg = ((uint32_t) dest);
         tx_descriptor->BTCTRL.bit.VALID = true;
@@ -160,10 +170,10 @@ static int32_t shared_dma_transfer(void* peripheral,
     }
     // Start the RX job first so we don't miss the first byte. The TX job clocks
     // the output.
-    if (rx_active) {
+    if (shared_rx_active) {
         dma_enable_channel(SHARED_RX_CHANNEL);
     }
-    if (tx_active) {
+    if (shared_tx_active) {
         dma_enable_channel(SHARED_TX_CHANNEL);
     }
 
@@ -174,7 +184,7 @@ static int32_t shared_dma_transfer(void* peripheral,
         // Do a manual copy to trigger then DMA. We do 32-bit accesses to match the DMA.
         #pragma GCC diagnostic push
         #pragma GCC diagnostic ignored "-Wcast-align"
-        if (rx_active) {
+        if (shared_rx_active) {
             //buffer_in[0] = *src;
             DMAC->SWTRIGCTRL.reg |= (1 << SHARED_RX_CHANNEL);
         } else {
@@ -182,16 +192,24 @@ static int32_t shared_dma_transfer(void* peripheral,
         }
         #pragma GCC diagnostic pop
     }
+    return 0;
+}
 
-    // Channels cycle between Suspend -> Pending -> Busy and back while transfering. So, we check
-    // the channels transfer status for an error or completion.
-    if (rx_active) {
-        while ((dma_transfer_status(SHARED_RX_CHANNEL) & 0x3) == 0) {}
-    }
-    if (tx_active) {
-        while ((dma_transfer_status(SHARED_TX_CHANNEL) & 0x3) == 0) {}
-    }
+// Channels cycle between Suspend -> Pending -> Busy and back while transfering. So, we check
+// the channels transfer status for an error or completion.
+static bool shared_dma_transfer_done(void) {
+    return (!shared_rx_active || (dma_transfer_status(SHARED_RX_CHANNEL) & 0x3) != 0) &&
+           (!shared_tx_active || (dma_transfer_status(SHARED_TX_CHANNEL) & 0x3) != 0);
+}
+
+// Waits for the transfer started by shared_dma_transfer_start to complete.
+static int32_t shared_dma_transfer_finish(void* peripheral, uint32_t length) {
+    while (!shared_dma_transfer_done()) {}
 
+    bool sercom = true;
+    #ifdef SAMD51
+    sercom = peripheral != QSPI;
+    #endif
     if (sercom) {
         Sercom* s = (Sercom*) peripheral;
         // Wait for the SPI transfer to complete.
@@ -199,7 +217,7 @@ static int32_t shared_dma_transfer(void* peripheral,
 
         // This transmit will cause the RX buffer overflow but we're OK with that.
         // So, read the garbage and clear the overflow flag.
-        if (!rx_active) {
+        if (!shared_rx_active) {
             while (s->SPI.INTFLAG.bit.RXC == 1) {
                 s->SPI.DATA.reg;
             }
@@ -208,13 +226,24 @@ static int32_t shared_dma_transfer(void* peripheral,
         }
     }
 
-    if ((!rx_active || dma_transfer_status(SHARED_RX_CHANNEL) == DMAC_CHINTFLAG_TCMPL) &&
-        (!tx_active || dma_transfer_status(SHARED_TX_CHANNEL) == DMAC_CHINTFLAG_TCMPL)) {
+    if ((!shared_rx_active || dma_transfer_status(SHARED_RX_CHANNEL) == DMAC_CHINTFLAG_TCMPL) &&
+        (!shared_tx_active || dma_transfer_status(SHARED_TX_CHANNEL) == DMAC_CHINTFLAG_TCMPL)) {
         return length;
     }
     return -2;
 }
 
+static int32_t shared_dma_transfer(void* peripheral,
+                                   const uint8_t* buffer_out, volatile uint32_t* dest,
+                                   volatile uint32_t* src, uint8_t* buffer_in,
+                                   uint32_t length, uint8_t tx) {
+    int32_t status = shared_dma_transfer_start(peripheral, buffer_out, dest, src, buffer_in,
+                                               length, &tx);
+    if (status < 0) {
+        return status;
+    }
+    return shared_dma_transfer_finish(peripheral, length);
+}
 
 int32_t sercom_dma_transfer(Sercom* sercom, const uint8_t* buffer_out, uint8_t* buffer_in,
                             uint32_t length) {
@@ -229,6 +258,28 @@ int32_t sercom_dma_read(Sercom* sercom, uint8_t* buffer, uint32_t length, uint8_
     return shared_dma_transfer(sercom, NULL, &sercom->SPI.DATA.reg, &sercom->SPI.DATA.reg, buffer, length, tx);
 }
 
+int32_t sercom_dma_start_write(Sercom* sercom, const uint8_t* buffer, uint32_t length) {
+    int32_t status = shared_dma_transfer_start(sercom, buffer, &sercom->SPI.DATA.reg, NULL, NULL,
+                                               length, NULL);
+    if (status < 0) {
+        return status;
+    }
+    pending_write_sercom = sercom;
+    return length;
+}
+
+bool sercom_dma_write_done(Sercom* sercom) {
+    return pending_write_sercom != sercom || shared_dma_transfer_done();
+}
+
+int32_t sercom_dma_finish_write(Sercom* sercom) {
+    if (pending_write_sercom != sercom) {
+        return 0;
+    }
+    pending_write_sercom = NULL;
+    return shared_dma_transfer_finish(sercom, dma_descriptors[SHARED_TX_CHANNEL].BTCNT.reg);
+}
+
 #ifdef SAMD51
 int32_t qspi_dma_write(uint32_t address, const uint8_t* buffer, uint32_t length) {
     return shared_dma_transfer(QSPI, buffer, (uint32_t*) (QSPI_AHB + address), NULL, NULL, length, 0);
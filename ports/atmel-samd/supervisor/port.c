@@ -207,8 +207,8 @@ void reset_port(void) {
     audioout_reset();
 #endif
 #if CIRCUITPY_AUDIOBUSIO
+    pdmin_reset();
     i2sout_reset();
-    //pdmin_reset();
 #endif
 
 #if CIRCUITPY_TOUCHIO
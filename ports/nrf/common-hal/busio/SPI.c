@@ -250,6 +250,15 @@ bool common_hal_busio_spi_write(busio_spi_obj_t *self, const uint8_t *data, size
     return true;
 }
 
+// Writes are blocking so they are done by the time start_write returns.
+bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, const uint8_t *data, size_t len) {
+    return common_hal_busio_spi_write(self, data, len);
+}
+
+bool common_hal_busio_spi_write_done(busio_spi_obj_t *self) {
+    return true;
+}
+
 bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value) {
     if (len == 0)
         return true;
@@ -50,6 +50,7 @@
 
 // 24kiB stack
 #define CIRCUITPY_DEFAULT_STACK_SIZE            0x6000
+#define CIRCUITPY_DISPLAY_BUFFER_SIZE           1024
 
 #include "py/circuitpy_mpconfig.h"
 
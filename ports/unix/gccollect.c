@@ -29,6 +29,10 @@
 #include "py/mpstate.h"
 #include "py/gc.h"
 
+#if CIRCUITPY_DISPLAYIO
+#include "shared-module/displayio/__init__.h"
+#endif
+
 #if MICROPY_ENABLE_GC
 
 // Even if we have specific support for an architecture, it is
@@ -170,6 +174,10 @@ void gc_collect(void) {
     #if MICROPY_EMIT_NATIVE
     mp_unix_mark_exec();
     #endif
+    #if CIRCUITPY_DISPLAYIO
+    // Displays and their buses live outside the heap but hold on to groups and framebuffers in it.
+    gc_collect_root((void**)displays, sizeof(primary_display_t) * CIRCUITPY_DISPLAY_LIMIT / sizeof(mp_uint_t));
+    #endif
     gc_collect_end();
 
     //printf("-----\n");
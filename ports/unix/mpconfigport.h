@@ -28,6 +28,7 @@
 
 #define MICROPY_ALLOC_PATH_MAX      (PATH_MAX)
 #define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_QSTR_HASH_INDEX     (1)
 #if !defined(MICROPY_EMIT_X64) && defined(__x86_64__)
     #define MICROPY_EMIT_X64        (1)
 #endif
@@ -215,6 +216,51 @@ extern const struct _mp_obj_module_t mp_module_jni;
 #else
 #define MICROPY_PY_USELECT_DEF
 #endif
+#if CIRCUITPY_DISPLAYIO
+extern const struct _mp_obj_module_t displayio_module;
+extern const struct _mp_obj_module_t stage_module;
+extern const struct _mp_obj_module_t fontio_module;
+extern const struct _mp_obj_module_t terminalio_module;
+#define CIRCUITPY_DISPLAYIO_DEF \
+    { MP_ROM_QSTR(MP_QSTR_displayio), MP_ROM_PTR(&displayio_module) }, \
+    { MP_ROM_QSTR(MP_QSTR__stage), MP_ROM_PTR(&stage_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_fontio), MP_ROM_PTR(&fontio_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_terminalio), MP_ROM_PTR(&terminalio_module) },
+
+// displayio draws into memory through MemoryBus so that rendering can be tested and benchmarked
+// without display hardware.
+#define CIRCUITPY_DISPLAY_LIMIT (1)
+#define CIRCUITPY_DISPLAY_AREA_LIMIT (4)
+#define CIRCUITPY_DISPLAY_BUFFER_SIZE (1024)
+#define CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS (2)
+#define CIRCUITPY_AUTORELOAD_DELAY_MS (500)
+
+// Refresh displays in the background while Python code runs, like boards do.
+void displayio_refresh_displays(void);
+#define MICROPY_VM_HOOK_LOOP displayio_refresh_displays();
+#define MICROPY_VM_HOOK_RETURN displayio_refresh_displays();
+#else
+#define CIRCUITPY_DISPLAYIO_DEF
+#endif
+#if CIRCUITPY_AUDIOIO
+extern const struct _mp_obj_module_t audioio_module;
+#define CIRCUITPY_AUDIOIO_DEF { MP_ROM_QSTR(MP_QSTR_audioio), MP_ROM_PTR(&audioio_module) },
+#else
+#define CIRCUITPY_AUDIOIO_DEF
+#endif
+#if CIRCUITPY_AUDIOBUSIO
+extern const struct _mp_obj_module_t audiobusio_module;
+#define CIRCUITPY_AUDIOBUSIO_DEF { MP_ROM_QSTR(MP_QSTR_audiobusio), MP_ROM_PTR(&audiobusio_module) },
+#else
+#define CIRCUITPY_AUDIOBUSIO_DEF
+#endif
+
+#if CIRCUITPY_FFT
+extern const struct _mp_obj_module_t fft_module;
+#define CIRCUITPY_FFT_DEF { MP_ROM_QSTR(MP_QSTR_fft), MP_ROM_PTR(&fft_module) },
+#else
+#define CIRCUITPY_FFT_DEF
+#endif
 
 #define MICROPY_PORT_BUILTIN_MODULES \
     MICROPY_PY_FFI_DEF \
@@ -225,6 +271,10 @@ extern const struct _mp_obj_module_t mp_module_jni;
     MICROPY_PY_UOS_DEF \
     MICROPY_PY_USELECT_DEF \
     MICROPY_PY_TERMIOS_DEF \
+    CIRCUITPY_DISPLAYIO_DEF \
+    CIRCUITPY_AUDIOIO_DEF \
+    CIRCUITPY_AUDIOBUSIO_DEF \
+    CIRCUITPY_FFT_DEF \
 
 // type definitions for the specific machine
 
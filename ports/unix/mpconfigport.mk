@@ -23,6 +23,9 @@ MICROPY_PY_SOCKET = 1
 # ffi module requires libffi (libffi-dev Debian package)
 MICROPY_PY_FFI = 1
 
+# fft module for spectra of arrays, in fixed and floating point
+CIRCUITPY_FFT = 1
+
 # ussl module requires one of the TLS libraries below
 MICROPY_PY_USSL = 1
 # axTLS has minimal size and fully integrated with MicroPython, but
@@ -23,13 +23,15 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  * THE SOFTWARE.
  */
+#include <stdbool.h>
 #include <unistd.h>
 
 #ifndef CHAR_CTRL_C
 #define CHAR_CTRL_C (3)
 #endif
 
-void mp_hal_set_interrupt_char(char c);
+void mp_hal_set_interrupt_char(int c);
+bool mp_hal_is_interrupted(void);
 
 void mp_hal_stdio_mode_raw(void);
 void mp_hal_stdio_mode_orig(void);
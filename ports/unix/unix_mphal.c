@@ -58,7 +58,7 @@ STATIC void sighandler(int signum) {
 }
 #endif
 
-void mp_hal_set_interrupt_char(char c) {
+void mp_hal_set_interrupt_char(int c) {
     // configure terminal settings to (not) let ctrl-C through
     if (c == CHAR_CTRL_C) {
         #ifndef _WIN32
@@ -81,6 +81,11 @@ void mp_hal_set_interrupt_char(char c) {
     }
 }
 
+// Check to see if we've been CTRL-C'ed.
+bool mp_hal_is_interrupted(void) {
+    return MP_STATE_VM(mp_pending_exception) == MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_kbd_exception));
+}
+
 #if MICROPY_USE_READLINE == 1
 
 #include <termios.h>
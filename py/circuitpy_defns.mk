@@ -126,6 +126,9 @@ endif
 ifeq ($(CIRCUITPY_DISPLAYIO),1)
 SRC_PATTERNS += displayio/% terminalio/% fontio/%
 endif
+ifeq ($(CIRCUITPY_FFT),1)
+SRC_PATTERNS += fft/%
+endif
 ifeq ($(CIRCUITPY_FREQUENCYIO),1)
 SRC_PATTERNS += frequencyio/%
 endif
@@ -276,6 +279,7 @@ $(filter $(SRC_PATTERNS), \
 	digitalio/Direction.c \
 	digitalio/DriveMode.c \
 	digitalio/Pull.c \
+	displayio/Colorspace.c \
 	fontio/Glyph.c \
 	microcontroller/RunMode.c \
 	math/__init__.c \
@@ -303,8 +307,15 @@ $(filter $(SRC_PATTERNS), \
 	_stage/Text.c \
 	_stage/__init__.c \
 	audioio/__init__.c \
+	audioio/Biquad.c \
+	audioio/Echo.c \
+	audioio/Effect.c \
+	audioio/Limiter.c \
 	audioio/Mixer.c \
+	audioio/OnePole.c \
 	audioio/RawSample.c \
+	audioio/Resampler.c \
+	audioio/Synthesizer.c \
 	audioio/WaveFile.c \
 	bitbangio/I2C.c \
 	bitbangio/OneWire.c \
@@ -319,9 +330,11 @@ $(filter $(SRC_PATTERNS), \
 	displayio/Group.c \
 	displayio/OnDiskBitmap.c \
 	displayio/Palette.c \
+	displayio/RLEBitmap.c \
 	displayio/Shape.c \
 	displayio/TileGrid.c \
 	displayio/__init__.c \
+	fft/__init__.c \
 	fontio/BuiltinFont.c \
 	fontio/__init__.c \
 	gamepad/GamePad.c \
@@ -194,6 +194,10 @@ typedef long mp_off_t;
 #define MICROPY_PY_URE_MATCH_GROUPS           (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_MATCH_SPAN_START_END   (CIRCUITPY_FULL_BUILD)
 #define MICROPY_PY_URE_SUB                    (CIRCUITPY_FULL_BUILD)
+// The index over the built in qstrs costs flash.
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX               (CIRCUITPY_FULL_BUILD)
+#endif
 
 // LONGINT_IMPL_xxx are defined in the Makefile.
 //
@@ -229,6 +233,15 @@ extern const struct _mp_obj_module_t audiobusio_module;
 #define AUDIOBUSIO_MODULE
 #endif
 
+// Ports with audiobusio have I2SOut and PDMIn. The unix port builds audiobusio with only
+// PDMDecimator.
+#ifndef CIRCUITPY_AUDIOBUSIO_I2SOUT
+#define CIRCUITPY_AUDIOBUSIO_I2SOUT (CIRCUITPY_AUDIOBUSIO)
+#endif
+#ifndef CIRCUITPY_AUDIOBUSIO_PDMIN
+#define CIRCUITPY_AUDIOBUSIO_PDMIN (CIRCUITPY_AUDIOBUSIO)
+#endif
+
 #if CIRCUITPY_AUDIOIO
 #define AUDIOIO_MODULE         { MP_OBJ_NEW_QSTR(MP_QSTR_audioio), (mp_obj_t)&audioio_module },
 extern const struct _mp_obj_module_t audioio_module;
@@ -236,6 +249,11 @@ extern const struct _mp_obj_module_t audioio_module;
 #define AUDIOIO_MODULE
 #endif
 
+// Ports with audioio have AudioOut. The unix port builds audioio without it.
+#ifndef CIRCUITPY_AUDIOIO_AUDIOOUT
+#define CIRCUITPY_AUDIOIO_AUDIOOUT (CIRCUITPY_AUDIOIO)
+#endif
+
 #if CIRCUITPY_BITBANGIO
 #define BITBANGIO_MODULE       { MP_OBJ_NEW_QSTR(MP_QSTR_bitbangio), (mp_obj_t)&bitbangio_module },
 extern const struct _mp_obj_module_t bitbangio_module;
@@ -300,6 +318,19 @@ extern const struct _mp_obj_module_t terminalio_module;
 #define FONTIO_MODULE       { MP_OBJ_NEW_QSTR(MP_QSTR_fontio), (mp_obj_t)&fontio_module },
 #define TERMINALIO_MODULE      { MP_OBJ_NEW_QSTR(MP_QSTR_terminalio), (mp_obj_t)&terminalio_module },
 #define CIRCUITPY_DISPLAY_LIMIT (3)
+// Number of separate areas tracked for redraw each frame before they are merged together.
+#ifndef CIRCUITPY_DISPLAY_AREA_LIMIT
+#define CIRCUITPY_DISPLAY_AREA_LIMIT (4)
+#endif
+// Pixels rendered per chunk. Refresh keeps two chunk buffers on the stack so one can be sent while
+// the other is rendered.
+#ifndef CIRCUITPY_DISPLAY_BUFFER_SIZE
+#define CIRCUITPY_DISPLAY_BUFFER_SIZE (512)
+#endif
+// Decoded rows each OnDiskBitmap keeps in memory.
+#ifndef CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS
+#define CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS (2)
+#endif
 #else
 #define DISPLAYIO_MODULE
 #define FONTIO_MODULE
@@ -307,6 +338,13 @@ extern const struct _mp_obj_module_t terminalio_module;
 #define CIRCUITPY_DISPLAY_LIMIT (0)
 #endif
 
+#if CIRCUITPY_FFT
+extern const struct _mp_obj_module_t fft_module;
+#define FFT_MODULE             { MP_OBJ_NEW_QSTR(MP_QSTR_fft), (mp_obj_t)&fft_module },
+#else
+#define FFT_MODULE
+#endif
+
 #if CIRCUITPY_FREQUENCYIO
 extern const struct _mp_obj_module_t frequencyio_module;
 #define FREQUENCYIO_MODULE       { MP_OBJ_NEW_QSTR(MP_QSTR_frequencyio), (mp_obj_t)&frequencyio_module },
@@ -573,6 +611,7 @@ extern const struct _mp_obj_module_t ustack_module;
       FONTIO_MODULE \
       TERMINALIO_MODULE \
     ERRNO_MODULE \
+    FFT_MODULE \
     FREQUENCYIO_MODULE \
     GAMEPAD_MODULE \
     GAMEPADSHIFT_MODULE \
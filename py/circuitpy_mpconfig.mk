@@ -92,6 +92,17 @@ CIRCUITPY_DISPLAYIO = $(CIRCUITPY_FULL_BUILD)
 endif
 CFLAGS += -DCIRCUITPY_DISPLAYIO=$(CIRCUITPY_DISPLAYIO)
 
+ifndef CIRCUITPY_FFT
+CIRCUITPY_FFT = $(CIRCUITPY_FULL_BUILD)
+endif
+CFLAGS += -DCIRCUITPY_FFT=$(CIRCUITPY_FFT)
+
+# Adds floating point transforms of 'f' arrays. Turn off on chips without an FPU.
+ifndef CIRCUITPY_FFT_FLOAT
+CIRCUITPY_FFT_FLOAT = $(CIRCUITPY_FFT)
+endif
+CFLAGS += -DCIRCUITPY_FFT_FLOAT=$(CIRCUITPY_FFT_FLOAT)
+
 ifndef CIRCUITPY_FREQUENCYIO
 CIRCUITPY_FREQUENCYIO = $(CIRCUITPY_FULL_BUILD)
 endif
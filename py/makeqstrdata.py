@@ -75,13 +75,43 @@ C_ESCAPES = {
 }
 
 # this must match the equivalent function in qstr.c
-def compute_hash(qstr, bytes_hash):
+def compute_full_hash(qstr):
     hash = 5381
     for b in qstr:
-        hash = (hash * 33) ^ b
+        hash = ((hash * 33) ^ b) & 0xffffffff
+    return hash
+
+def compute_hash(qstr, bytes_hash):
+    hash = compute_full_hash(qstr)
     # Make sure that valid hash is never zero, zero means "hash not computed"
     return (hash & ((1 << (8 * bytes_hash)) - 1)) or 1
 
+# this must match the equivalent function in qstr.c
+def index_slot(full_hash, index_mask):
+    return (((full_hash * 2654435769) & 0xffffffff) >> 16) & index_mask
+
+def compute_index(qstrs):
+    """Returns the hash index for a pool of the given qstrs, as bytes objects, or None for ones that
+    can't be found. Entries are one more than the position of a qstr and zero when free."""
+    if len(qstrs) >= 0xffff:
+        raise ValueError("too many qstrs for a 16 bit index")
+    length = 2
+    while length < 2 * len(qstrs):
+        length *= 2
+    index = [0] * length
+    for position, qbytes in enumerate(qstrs):
+        if qbytes is None:
+            continue
+        slot = index_slot(compute_full_hash(qbytes), length - 1)
+        while index[slot] != 0:
+            slot = (slot + 1) & (length - 1)
+        index[slot] = position + 1
+    return index
+
+def print_index(index):
+    for i in range(0, len(index), 16):
+        print('QINDEX(%s)' % ', '.join(str(x) for x in index[i:i + 16]))
+
 def translate(translation_file, i18ns):
     with open(translation_file, "rb") as f:
         table = gettext.GNUTranslations(f)
@@ -325,6 +355,7 @@ def print_qstr_data(encoding_table, qcfgs, qstrs, i18ns):
     # get config variables
     cfg_bytes_len = int(qcfgs['BYTES_IN_LEN'])
     cfg_bytes_hash = int(qcfgs['BYTES_IN_HASH'])
+    cfg_hash_index = int(qcfgs.get('HASH_INDEX', '0'))
 
     # print out the starter of the generated C header file
     print('// This file was automatically generated by makeqstrdata.py')
@@ -335,11 +366,17 @@ def print_qstr_data(encoding_table, qcfgs, qstrs, i18ns):
 
     total_qstr_size = 0
     total_qstr_compressed_size = 0
+    # the NULL qstr is never found
+    index_qstrs = [None]
     # go through each qstr and print it out
     for order, ident, qstr in sorted(qstrs.values(), key=lambda x: x[0]):
         qbytes = make_bytes(cfg_bytes_len, cfg_bytes_hash, qstr)
         print('QDEF(MP_QSTR_%s, %s)' % (ident, qbytes))
         total_qstr_size += len(qstr)
+        index_qstrs.append(bytes_cons(qstr, 'utf8'))
+
+    if cfg_hash_index:
+        print_index(compute_index(index_qstrs))
 
     total_text_size = 0
     total_text_compressed_size = 0
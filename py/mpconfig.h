@@ -141,6 +141,13 @@
 #define MICROPY_QSTR_POOL_MAX_ENTRIES (64)
 #endif
 
+// Whether each QSTR pool has a hash index so that finding a string probes a few entries of each
+// pool instead of comparing against every QSTR. The index costs 4 to 8 bytes per QSTR, in ROM for
+// the built in QSTRs and in RAM for the ones added at runtime.
+#ifndef MICROPY_QSTR_HASH_INDEX
+#define MICROPY_QSTR_HASH_INDEX (0)
+#endif
+
 // Initial amount for lexer indentation level
 #ifndef MICROPY_ALLOC_LEXER_INDENT_INIT
 #define MICROPY_ALLOC_LEXER_INDENT_INIT (10)
@@ -33,8 +33,8 @@
 #include "py/qstr.h"
 #include "py/gc.h"
 
-// NOTE: we are using linear arrays to store and search for qstr's (unique strings, interned strings)
-// ultimately we will replace this with a static hash table of some kind
+// NOTE: we are using linear arrays to store qstr's (unique strings, interned strings) and, with
+// MICROPY_QSTR_HASH_INDEX, a hash index per array to search them
 // also probably need to include the length in the string data, to allow null bytes in the string
 
 #if MICROPY_DEBUG_VERBOSE // print debugging info
@@ -82,13 +82,18 @@
 #endif
 
 // this must match the equivalent function in makeqstrdata.py
-mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+STATIC uint32_t compute_full_hash(const byte *data, size_t len) {
     // djb2 algorithm; see http://www.cse.yorku.ca/~oz/hash.html
-    mp_uint_t hash = 5381;
+    uint32_t hash = 5381;
     for (const byte *top = data + len; data < top; data++) {
         hash = ((hash << 5) + hash) ^ (*data); // hash * 33 ^ data
     }
-    hash &= Q_HASH_MASK;
+    return hash;
+}
+
+// cut a full hash down to the bytes stored with each qstr
+STATIC mp_uint_t short_hash(uint32_t full_hash) {
+    mp_uint_t hash = full_hash & Q_HASH_MASK;
     // Make sure that valid hash is never zero, zero means "hash not computed"
     if (hash == 0) {
         hash++;
@@ -96,16 +101,49 @@ mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
     return hash;
 }
 
+mp_uint_t qstr_compute_hash(const byte *data, size_t len) {
+    return short_hash(compute_full_hash(data, len));
+}
+
+#if MICROPY_QSTR_HASH_INDEX
+// this must match the equivalent function in makeqstrdata.py
+// The low bits of djb2 barely depend on the string so mix the hash by multiplying by 2^32 / phi
+// and take bits from the middle of the product.
+STATIC size_t index_slot(uint32_t full_hash, size_t index_mask) {
+    return ((uint32_t)(full_hash * 2654435769u) >> 16) & index_mask;
+}
+
+STATIC const uint16_t const_pool_index[] = {
+#ifndef NO_QSTR
+#define QDEF(id, str)
+#define TRANSLATION(id, length, compressed...)
+#define QINDEX(...) __VA_ARGS__,
+#include "genhdr/qstrdefs.generated.h"
+#undef QINDEX
+#undef TRANSLATION
+#undef QDEF
+#else
+    0,
+#endif
+};
+#endif
+
 const qstr_pool_t mp_qstr_const_pool = {
     NULL,               // no previous pool
     0,                  // no previous pool
     10,                 // set so that the first dynamically allocated pool is twice this size; must be <= the len (just below)
     MP_QSTRnumber_of,   // corresponds to number of strings in array just below
+    #if MICROPY_QSTR_HASH_INDEX
+    (uint16_t*)const_pool_index, // never written to because the pool is full
+    MP_ARRAY_SIZE(const_pool_index) - 1,
+    #endif
     {
 #ifndef NO_QSTR
 #define QDEF(id, str) str,
 #define TRANSLATION(id, length, compressed...)
+#define QINDEX(...)
 #include "genhdr/qstrdefs.generated.h"
+#undef QINDEX
 #undef TRANSLATION
 #undef QDEF
 #endif
@@ -139,7 +177,7 @@ STATIC const byte *find_qstr(qstr q) {
 }
 
 // qstr_mutex must be taken while in this function
-STATIC qstr qstr_add(const byte *q_ptr) {
+STATIC qstr qstr_add(const byte *q_ptr, uint32_t full_hash) {
     DEBUG_printf("QSTR: add hash=%d len=%d data=%.*s\n", Q_GET_HASH(q_ptr), Q_GET_LENGTH(q_ptr), Q_GET_LENGTH(q_ptr), Q_GET_DATA(q_ptr));
 
     // make sure we have room in the pool for a new qstr
@@ -148,7 +186,17 @@ STATIC qstr qstr_add(const byte *q_ptr) {
         if (new_pool_length > MICROPY_QSTR_POOL_MAX_ENTRIES) {
             new_pool_length = MICROPY_QSTR_POOL_MAX_ENTRIES;
         }
-        qstr_pool_t *pool = m_new_ll_obj_var_maybe(qstr_pool_t, const char*, new_pool_length);
+        #if MICROPY_QSTR_HASH_INDEX
+        // the index follows the qstrs in the same allocation
+        size_t index_length = 2;
+        while (index_length < 2 * new_pool_length) {
+            index_length *= 2;
+        }
+        size_t extra_bytes = sizeof(const char*) * new_pool_length + sizeof(uint16_t) * index_length;
+        #else
+        size_t extra_bytes = sizeof(const char*) * new_pool_length;
+        #endif
+        qstr_pool_t *pool = m_new_ll_obj_var_maybe(qstr_pool_t, byte, extra_bytes);
         if (pool == NULL) {
             QSTR_EXIT();
             m_malloc_fail(new_pool_length);
@@ -157,34 +205,63 @@ STATIC qstr qstr_add(const byte *q_ptr) {
         pool->total_prev_len = MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len;
         pool->alloc = new_pool_length;
         pool->len = 0;
+        #if MICROPY_QSTR_HASH_INDEX
+        pool->index = (uint16_t*)&pool->qstrs[new_pool_length];
+        pool->index_mask = index_length - 1;
+        memset(pool->index, 0, sizeof(uint16_t) * index_length);
+        #endif
         MP_STATE_VM(last_pool) = pool;
         DEBUG_printf("QSTR: allocate new pool of size %d\n", MP_STATE_VM(last_pool)->alloc);
     }
 
     // add the new qstr
-    MP_STATE_VM(last_pool)->qstrs[MP_STATE_VM(last_pool)->len++] = q_ptr;
+    qstr_pool_t *pool = MP_STATE_VM(last_pool);
+    pool->qstrs[pool->len] = q_ptr;
+    #if MICROPY_QSTR_HASH_INDEX
+    size_t slot = index_slot(full_hash, pool->index_mask);
+    while (pool->index[slot] != 0) {
+        slot = (slot + 1) & pool->index_mask;
+    }
+    pool->index[slot] = pool->len + 1;
+    #else
+    (void)full_hash;
+    #endif
+    pool->len++;
 
     // return id for the newly-added qstr
-    return MP_STATE_VM(last_pool)->total_prev_len + MP_STATE_VM(last_pool)->len - 1;
+    return pool->total_prev_len + pool->len - 1;
 }
 
-qstr qstr_find_strn(const char *str, size_t str_len) {
-    // work out hash of str
-    mp_uint_t str_hash = qstr_compute_hash((const byte*)str, str_len);
+STATIC qstr find_strn(const char *str, size_t str_len, uint32_t full_hash) {
+    mp_uint_t str_hash = short_hash(full_hash);
 
     // search pools for the data
     for (qstr_pool_t *pool = MP_STATE_VM(last_pool); pool != NULL; pool = pool->prev) {
+        #if MICROPY_QSTR_HASH_INDEX
+        for (size_t slot = index_slot(full_hash, pool->index_mask); pool->index[slot] != 0; slot = (slot + 1) & pool->index_mask) {
+            size_t position = pool->index[slot] - 1;
+            const byte *q = pool->qstrs[position];
+            if (Q_GET_HASH(q) == str_hash && Q_GET_LENGTH(q) == str_len && memcmp(Q_GET_DATA(q), str, str_len) == 0) {
+                return pool->total_prev_len + position;
+            }
+        }
+        #else
         for (const byte **q = pool->qstrs, **q_top = pool->qstrs + pool->len; q < q_top; q++) {
             if (Q_GET_HASH(*q) == str_hash && Q_GET_LENGTH(*q) == str_len && memcmp(Q_GET_DATA(*q), str, str_len) == 0) {
                 return pool->total_prev_len + (q - pool->qstrs);
             }
         }
+        #endif
     }
 
     // not found; return null qstr
     return 0;
 }
 
+qstr qstr_find_strn(const char *str, size_t str_len) {
+    return find_strn(str, str_len, compute_full_hash((const byte*)str, str_len));
+}
+
 qstr qstr_from_str(const char *str) {
     return qstr_from_strn(str, strlen(str));
 }
@@ -192,7 +269,8 @@ qstr qstr_from_str(const char *str) {
 qstr qstr_from_strn(const char *str, size_t len) {
     assert(len < (1 << (8 * MICROPY_QSTR_BYTES_IN_LEN)));
     QSTR_ENTER();
-    qstr q = qstr_find_strn(str, len);
+    uint32_t full_hash = compute_full_hash((const byte*)str, len);
+    qstr q = find_strn(str, len, full_hash);
     if (q == 0) {
         // qstr does not exist in interned pool so need to add it
 
@@ -237,12 +315,12 @@ qstr qstr_from_strn(const char *str, size_t len) {
         MP_STATE_VM(qstr_last_used) += n_bytes;
 
         // store the interned strings' data
-        mp_uint_t hash = qstr_compute_hash((const byte*)str, len);
+        mp_uint_t hash = short_hash(full_hash);
         Q_SET_HASH(q_ptr, hash);
         Q_SET_LENGTH(q_ptr, len);
         memcpy(q_ptr + MICROPY_QSTR_BYTES_IN_HASH + MICROPY_QSTR_BYTES_IN_LEN, str, len);
         q_ptr[MICROPY_QSTR_BYTES_IN_HASH + MICROPY_QSTR_BYTES_IN_LEN + len] = '\0';
-        q = qstr_add(q_ptr);
+        q = qstr_add(q_ptr, full_hash);
     }
     QSTR_EXIT();
     return q;
@@ -284,6 +362,9 @@ void qstr_pool_info(size_t *n_pool, size_t *n_qstr, size_t *n_str_data_bytes, si
         *n_total_bytes += gc_nbytes(pool); // this counts actual bytes used in heap
         #else
         *n_total_bytes += sizeof(qstr_pool_t) + sizeof(qstr) * pool->alloc;
+        #if MICROPY_QSTR_HASH_INDEX
+        *n_total_bytes += sizeof(uint16_t) * (pool->index_mask + 1);
+        #endif
         #endif
     }
     *n_total_bytes += *n_str_data_bytes;
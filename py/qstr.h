@@ -52,6 +52,13 @@ typedef struct _qstr_pool_t {
     size_t total_prev_len;
     size_t alloc;
     size_t len;
+    #if MICROPY_QSTR_HASH_INDEX
+    // Open addressing table, probed linearly from index_slot() of the string's full hash. Entries
+    // are one more than the position of a qstr in qstrs and zero when free. It has index_mask + 1
+    // entries, a power of two at least twice the number of qstrs the pool holds.
+    uint16_t *index;
+    size_t index_mask;
+    #endif
     const byte *qstrs[];
 } qstr_pool_t;
 
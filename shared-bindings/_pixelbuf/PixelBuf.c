@@ -38,7 +38,6 @@
 #include "PixelBuf.h"
 #include "shared-bindings/_pixelbuf/types.h"
 #include "../../shared-module/_pixelbuf/PixelBuf.h"
-#include "shared-bindings/digitalio/DigitalInOut.h"
 
 extern const pixelbuf_byteorder_obj_t byteorder_BGR;
 extern const mp_obj_type_t pixelbuf_byteorder_type;
@@ -51,7 +50,7 @@ extern const int32_t colorwheel(float pos);
 //|
 //| :class:`~_pixelbuf.PixelBuf` implements an RGB[W] bytearray abstraction.
 //|
-//| .. class:: PixelBuf(size, buf, byteorder=BGR, brightness=0, rawbuf=None, offset=0, dotstar=False, auto_write=False, write_function=None, write_args=None)
+//| .. class:: PixelBuf(size, buf, byteorder=BGR, brightness=0, rawbuf=None, offset=0, dotstar=False, auto_write=False, write_function=None, write_args=None, gamma=1.0, defer_brightness=False)
 //|
 //|   Create a PixelBuf object of the specified size, byteorder, and bits per pixel.
 //|
@@ -60,6 +59,13 @@ extern const int32_t colorwheel(float pos);
 //|
 //|   When only given ``buf``, ``brightness`` applies to the next pixel assignment.
 //|
+//|   Brightness and ``gamma`` are applied through a 256 entry table that is only rebuilt when
+//|   either of them changes.
+//|
+//|   When ``defer_brightness`` is True, pixel changes only update ``rawbuf`` and brightness is
+//|   applied to the whole of ``buf`` when the pixels are shown. This is faster when many pixels
+//|   change between shows. A ``rawbuf`` is allocated if one isn't given.
+//|
 //|   When ``dotstar`` is True, and ``bpp`` is 4, the 4th value in a tuple/list
 //|   is the individual pixel brightness (0-1).  Not compatible with RGBW Byteorders.
 //|   Compatible `ByteOrder` classes are bpp=3, or bpp=4 and has_luminosity=True (g LBGR).
@@ -75,11 +81,13 @@ extern const int32_t colorwheel(float pos);
 //|   :param ~callable write_function: (optional) Callable to use to send pixels
 //|   :param ~list write_args: (optional) Tuple or list of args to pass to ``write_function``.  The
 //|          PixelBuf instance is appended after these args.
+//|   :param ~float gamma: Gamma correction exponent applied before brightness (default 1.0, none)
+//|   :param ~bool defer_brightness: Apply brightness to ``buf`` on `show()` only (default False)
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mp_arg_check_num(n_args, kw_args, 2, MP_OBJ_FUN_ARGS_MAX, true);
     enum { ARG_size, ARG_buf, ARG_byteorder, ARG_brightness, ARG_rawbuf, ARG_offset, ARG_dotstar,
-           ARG_auto_write, ARG_write_function, ARG_write_args };
+           ARG_auto_write, ARG_write_function, ARG_write_args, ARG_gamma, ARG_defer_brightness };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_size, MP_ARG_REQUIRED | MP_ARG_INT },
         { MP_QSTR_buf, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -91,6 +99,8 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         { MP_QSTR_auto_write, MP_ARG_BOOL, {.u_bool = false} },
         { MP_QSTR_write_function, MP_ARG_OBJ, {.u_obj = mp_const_none} },
         { MP_QSTR_write_args, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_gamma, MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_defer_brightness, MP_ARG_BOOL, {.u_bool = false} },
     };
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
@@ -109,6 +119,9 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
     mp_buffer_info_t bufinfo, rawbufinfo;
 
     mp_get_buffer_raise(args[ARG_buf].u_obj, &bufinfo, MP_BUFFER_READ | MP_BUFFER_WRITE);
+    if (args[ARG_defer_brightness].u_bool && args[ARG_rawbuf].u_obj == mp_const_none) {
+        args[ARG_rawbuf].u_obj = mp_obj_new_bytearray_of_zeros(bufinfo.len);
+    }
     bool two_buffers = args[ARG_rawbuf].u_obj != mp_const_none;
     if (two_buffers) {
         mp_get_buffer_raise(args[ARG_rawbuf].u_obj, &rawbufinfo, MP_BUFFER_READ | MP_BUFFER_WRITE);
@@ -127,6 +140,14 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         mp_raise_ValueError(translate("write_args must be a list, tuple, or None"));
     }
 
+    mp_float_t gamma = 1;
+    if (args[ARG_gamma].u_obj != mp_const_none) {
+        gamma = mp_obj_get_float(args[ARG_gamma].u_obj);
+        if (gamma <= 0) {
+            mp_raise_ValueError(translate("gamma must be greater than 0"));
+        }
+    }
+
     // Validation complete, allocate and populate object.
     pixelbuf_pixelbuf_obj_t *self = m_new_obj(pixelbuf_pixelbuf_obj_t);
 
@@ -143,6 +164,8 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
     self->rawbuf = two_buffers ? (uint8_t *)rawbufinfo.buf + offset : NULL;
     self->pixel_step = effective_bpp;
     self->auto_write = args[ARG_auto_write].u_bool;
+    self->gamma = gamma;
+    self->defer_brightness = args[ARG_defer_brightness].u_bool;
 
     if (self->dotstar_mode) {
         // Ensure sane configuration
@@ -186,6 +209,8 @@ STATIC mp_obj_t pixelbuf_pixelbuf_make_new(const mp_obj_type_t *type, size_t n_a
         else if (self->brightness > 1)
             self->brightness = 1;
     }
+    self->brightness_lut = NULL;
+    pixelbuf_update_brightness_lut(self);
 
     if (self->dotstar_mode) {
         // Initialize the buffer with the dotstar start bytes.
@@ -227,7 +252,7 @@ const mp_obj_property_t pixelbuf_pixelbuf_bpp_obj = {
 //|     setting this value causes a recomputation of the values in buf.
 //|     If only a buf was provided, then the brightness only applies to
 //|     future pixel changes.
-//|     In DotStar mode
+//|     In DotStar mode the per-pixel luminance is not affected.
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_obj_get_brightness(mp_obj_t self_in) {
     mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
@@ -240,12 +265,13 @@ MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_get_brightness_obj, pixelbuf_pixelbu
 STATIC mp_obj_t pixelbuf_pixelbuf_obj_set_brightness(mp_obj_t self_in, mp_obj_t value) {
     mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
     pixelbuf_pixelbuf_obj_t *self = MP_OBJ_TO_PTR(self_in);
-    self->brightness = mp_obj_float_get(value);
+    self->brightness = mp_obj_get_float(value);
     if (self->brightness > 1)
         self->brightness = 1;
     else if (self->brightness < 0)
         self->brightness = 0;
-    if (self->two_buffers)
+    pixelbuf_update_brightness_lut(self);
+    if (self->two_buffers && !self->defer_brightness)
         pixelbuf_recalculate_brightness(self);
     if (self->auto_write)
         call_write_function(self);
@@ -261,16 +287,56 @@ const mp_obj_property_t pixelbuf_pixelbuf_brightness_obj = {
 };
 
 void pixelbuf_recalculate_brightness(pixelbuf_pixelbuf_obj_t *self) {
-    uint8_t *buf = (uint8_t *)self->buf;
-    uint8_t *rawbuf = (uint8_t *)self->rawbuf;
-    // Compensate for shifted buffer (bpp=3 dotstar)
-    for (uint i = 0; i < self->bytes; i++) {
-        // Don't adjust per-pixel luminance bytes in dotstar mode
-        if (!self->dotstar_mode || (i % 4 != 0))
-            buf[i] = rawbuf[i] * self->brightness;
+    pixelbuf_apply_brightness(self->buf, self->rawbuf, self->bytes, self->brightness_lut, self->dotstar_mode);
+}
+
+void pixelbuf_update_brightness_lut(pixelbuf_pixelbuf_obj_t *self) {
+    if (self->brightness >= 1 && self->gamma == 1) {
+        self->brightness_lut = NULL;
+        return;
     }
+    if (self->brightness_lut == NULL) {
+        self->brightness_lut = m_new(uint8_t, 256);
+    }
+    pixelbuf_fill_brightness_lut(self->brightness_lut, self->brightness, self->gamma);
 }
 
+//|   .. attribute:: gamma
+//|
+//|     Gamma correction exponent applied to each channel before brightness. 1.0 leaves values
+//|     unchanged. Changing it recomputes ``buf`` in the same way as changing `brightness`.
+//|
+STATIC mp_obj_t pixelbuf_pixelbuf_obj_get_gamma(mp_obj_t self_in) {
+    mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
+    pixelbuf_pixelbuf_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_float(self->gamma);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_get_gamma_obj, pixelbuf_pixelbuf_obj_get_gamma);
+
+STATIC mp_obj_t pixelbuf_pixelbuf_obj_set_gamma(mp_obj_t self_in, mp_obj_t value) {
+    mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
+    pixelbuf_pixelbuf_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_float_t gamma = mp_obj_get_float(value);
+    if (gamma <= 0) {
+        mp_raise_ValueError(translate("gamma must be greater than 0"));
+    }
+    self->gamma = gamma;
+    pixelbuf_update_brightness_lut(self);
+    if (self->two_buffers && !self->defer_brightness)
+        pixelbuf_recalculate_brightness(self);
+    if (self->auto_write)
+        call_write_function(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_set_gamma_obj, pixelbuf_pixelbuf_obj_set_gamma);
+
+const mp_obj_property_t pixelbuf_pixelbuf_gamma_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&pixelbuf_pixelbuf_get_gamma_obj,
+              (mp_obj_t)&pixelbuf_pixelbuf_set_gamma_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|   .. attribute:: auto_write
 //|
 //|     Whether to automatically write the pixels after each update.
@@ -303,7 +369,7 @@ const mp_obj_property_t pixelbuf_pixelbuf_auto_write_obj = {
 //|
 //|     (read-only) bytearray of pixel data after brightness adjustment.  If an offset was provided
 //|     then this bytearray is the subset of the bytearray passed in that represents the
-//|     actual pixels.
+//|     actual pixels. With ``defer_brightness`` it is only brought up to date by `show()`.
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_obj_get_buf(mp_obj_t self_in) {
     mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
@@ -361,19 +427,98 @@ STATIC mp_obj_t pixelbuf_pixelbuf_show(mp_obj_t self_in) {
 STATIC MP_DEFINE_CONST_FUN_OBJ_1(pixelbuf_pixelbuf_show_obj, pixelbuf_pixelbuf_show);
 
 void call_write_function(pixelbuf_pixelbuf_obj_t *self) {
+    if (self->defer_brightness) {
+        pixelbuf_recalculate_brightness(self);
+    }
     // execute function if it's set
     if (self->write_function != mp_const_none) {
         mp_call_function_n_kw(self->write_function, self->write_function_args->len, 0, self->write_function_args->items);
     }
 }
 
+// Sets pixel index from a color int or tuple. Brightness is applied straight away unless it is
+// deferred until show().
+STATIC void pixelbuf_pixelbuf_set_pixel(pixelbuf_pixelbuf_obj_t *self, size_t index, mp_obj_t value) {
+    size_t offset = index * self->pixel_step;
+    pixelbuf_set_pixel(self->defer_brightness ? NULL : self->buf + offset,
+        self->two_buffers ? self->rawbuf + offset : NULL,
+        self->brightness_lut, value, &self->byteorder, self->dotstar_mode);
+}
+
+//|   .. method:: fill(color)
+//|
+//|     Sets every pixel to the given color int or tuple.
+//|
+STATIC mp_obj_t pixelbuf_pixelbuf_fill(mp_obj_t self_in, mp_obj_t color) {
+    mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
+    pixelbuf_pixelbuf_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    if (self->pixels > 0) {
+        pixelbuf_pixelbuf_set_pixel(self, 0, color);
+        if (self->two_buffers) {
+            pixelbuf_fill(self->rawbuf, self->pixels, self->pixel_step);
+        }
+        if (!self->defer_brightness) {
+            pixelbuf_fill(self->buf, self->pixels, self->pixel_step);
+        }
+    }
+    if (self->auto_write)
+        call_write_function(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_fill_obj, pixelbuf_pixelbuf_fill);
+
+//|   .. method:: rotate(n)
+//|
+//|     Moves every pixel ``n`` places towards the end of the buffer. Pixels moved past the end wrap
+//|     around to the start. Negative values move pixels towards the start.
+//|
+STATIC mp_obj_t pixelbuf_pixelbuf_rotate(mp_obj_t self_in, mp_obj_t n_in) {
+    mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
+    pixelbuf_pixelbuf_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t n = mp_obj_get_int(n_in);
+    if (self->two_buffers) {
+        pixelbuf_rotate(self->rawbuf, self->pixels, self->pixel_step, n);
+    }
+    if (!self->defer_brightness) {
+        pixelbuf_rotate(self->buf, self->pixels, self->pixel_step, n);
+    }
+    if (self->auto_write)
+        call_write_function(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_rotate_obj, pixelbuf_pixelbuf_rotate);
+
+//|   .. method:: shift(n)
+//|
+//|     Moves every pixel ``n`` places towards the end of the buffer. Pixels moved past the end are
+//|     dropped and the pixels left behind are turned off. Negative values move pixels towards the
+//|     start.
+//|
+STATIC mp_obj_t pixelbuf_pixelbuf_shift(mp_obj_t self_in, mp_obj_t n_in) {
+    mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
+    pixelbuf_pixelbuf_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t n = mp_obj_get_int(n_in);
+    if (self->two_buffers) {
+        pixelbuf_shift(self->rawbuf, self->pixels, self->pixel_step, n, self->dotstar_mode);
+    }
+    if (!self->defer_brightness) {
+        pixelbuf_shift(self->buf, self->pixels, self->pixel_step, n, self->dotstar_mode);
+    }
+    if (self->auto_write)
+        call_write_function(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(pixelbuf_pixelbuf_shift_obj, pixelbuf_pixelbuf_shift);
+
 //|   .. method:: __getitem__(index)
 //|
 //|     Returns the pixel value at the given index.
 //|
 //|   .. method:: __setitem__(index, value)
 //|
-//|     Sets the pixel value at the given index.
+//|     Sets the pixel value at the given index. Slices can be set from a list or tuple of pixel
+//|     values or from a buffer of raw pixel bytes in the same layout as ``buf``. Raw bytes are
+//|     copied as is and then have brightness applied.
 //|
 STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp_obj_t value) {
     mp_check_self(MP_OBJ_IS_TYPE(self_in, &pixelbuf_pixelbuf_type));
@@ -390,44 +535,46 @@ STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp
     } else if (MP_OBJ_IS_TYPE(index_in, &mp_type_slice)) {
         mp_bound_slice_t slice;
 
-        if (!mp_seq_get_fast_slice_indexes(self->bytes, index_in, &slice))
+        if (!mp_seq_get_fast_slice_indexes(self->pixels, index_in, &slice))
             mp_raise_NotImplementedError(translate("Only slices with step=1 (aka None) are supported"));
         if ((slice.stop * self->pixel_step) > self->bytes)
             mp_raise_IndexError(translate("Range out of bounds"));
 
         if (value == MP_OBJ_SENTINEL) { // Get
             size_t len = slice.stop - slice.start;
-            return pixelbuf_get_pixel_array((uint8_t *) self->buf + slice.start, len, &self->byteorder, self->pixel_step, self->dotstar_mode);
+            uint8_t *pixelstart = (self->two_buffers ? self->rawbuf : self->buf) + slice.start * self->pixel_step;
+            return pixelbuf_get_pixel_array(pixelstart, len, &self->byteorder, self->pixel_step, self->dotstar_mode);
         } else { // Set
             #if MICROPY_PY_ARRAY_SLICE_ASSIGN
 
-            if (!(MP_OBJ_IS_TYPE(value, &mp_type_list) || MP_OBJ_IS_TYPE(value, &mp_type_tuple)))
-                mp_raise_ValueError(translate("tuple/list required on RHS"));
-
             size_t dst_len = slice.stop - slice.start;
-
-            mp_obj_t *src_objs;
-            size_t num_items;
-            if (MP_OBJ_IS_TYPE(value, &mp_type_list)) {
-                mp_obj_list_t *t = MP_OBJ_TO_PTR(value);
-                num_items = t->len;
-                src_objs = t->items;
-            } else {
-                mp_obj_tuple_t *l = MP_OBJ_TO_PTR(value);
-                num_items = l->len;
-                src_objs = l->items;
-            }
-            if (num_items != dst_len)
-                mp_raise_ValueError_varg(translate("Unmatched number of items on RHS (expected %d, got %d)."),
-                                                   dst_len, num_items);
-
-            for (size_t i = slice.start; i < slice.stop; i++) {
-                mp_obj_t *item = src_objs[i-slice.start];
-                if (MP_OBJ_IS_TYPE(value, &mp_type_list) || MP_OBJ_IS_TYPE(value, &mp_type_tuple) || MP_OBJ_IS_INT(value)) {
-                    pixelbuf_set_pixel(self->buf + (i * self->pixel_step),
-                        self->two_buffers ? self->rawbuf + (i * self->pixel_step) : NULL,
-                        self->brightness, item, &self->byteorder, self->dotstar_mode);
+            mp_buffer_info_t bufinfo;
+
+            if (MP_OBJ_IS_TYPE(value, &mp_type_list) || MP_OBJ_IS_TYPE(value, &mp_type_tuple)) {
+                mp_obj_t *src_objs;
+                size_t num_items;
+                mp_obj_get_array(value, &num_items, &src_objs);
+                if (num_items != dst_len)
+                    mp_raise_ValueError_varg(translate("Unmatched number of items on RHS (expected %d, got %d)."),
+                                                       dst_len, num_items);
+
+                for (size_t i = slice.start; i < slice.stop; i++) {
+                    pixelbuf_pixelbuf_set_pixel(self, i, src_objs[i - slice.start]);
+                }
+            } else if (mp_get_buffer(value, &bufinfo, MP_BUFFER_READ)) {
+                size_t start = slice.start * self->pixel_step;
+                size_t len = dst_len * self->pixel_step;
+                if (bufinfo.len != len)
+                    mp_raise_ValueError_varg(translate("Buffer incorrect size. Should be %d bytes."), len);
+
+                uint8_t *target = (self->two_buffers ? self->rawbuf : self->buf) + start;
+                // The source may be a view of this buffer.
+                memmove(target, bufinfo.buf, len);
+                if (!self->defer_brightness) {
+                    pixelbuf_apply_brightness(self->buf + start, target, len, self->brightness_lut, self->dotstar_mode);
                 }
+            } else {
+                mp_raise_ValueError(translate("tuple/list required on RHS"));
             }
             if (self->auto_write)
                 call_write_function(self);
@@ -447,8 +594,7 @@ STATIC mp_obj_t pixelbuf_pixelbuf_subscr(mp_obj_t self_in, mp_obj_t index_in, mp
             uint8_t *pixelstart = (uint8_t *)(self->two_buffers ? self->rawbuf : self->buf) + offset;
             return pixelbuf_get_pixel(pixelstart, &self->byteorder, self->dotstar_mode);
         } else { // Store
-            pixelbuf_set_pixel(self->buf + offset, self->two_buffers ? self->rawbuf + offset : NULL,
-                self->brightness, value, &self->byteorder, self->dotstar_mode);
+            pixelbuf_pixelbuf_set_pixel(self, index, value);
             if (self->auto_write)
                 call_write_function(self);
             return mp_const_none;
@@ -462,6 +608,10 @@ STATIC const mp_rom_map_elem_t pixelbuf_pixelbuf_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&pixelbuf_pixelbuf_brightness_obj)},
     { MP_ROM_QSTR(MP_QSTR_buf), MP_ROM_PTR(&pixelbuf_pixelbuf_buf_obj)},
     { MP_ROM_QSTR(MP_QSTR_byteorder), MP_ROM_PTR(&pixelbuf_pixelbuf_byteorder_obj)},
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&pixelbuf_pixelbuf_fill_obj)},
+    { MP_ROM_QSTR(MP_QSTR_gamma), MP_ROM_PTR(&pixelbuf_pixelbuf_gamma_obj)},
+    { MP_ROM_QSTR(MP_QSTR_rotate), MP_ROM_PTR(&pixelbuf_pixelbuf_rotate_obj)},
+    { MP_ROM_QSTR(MP_QSTR_shift), MP_ROM_PTR(&pixelbuf_pixelbuf_shift_obj)},
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&pixelbuf_pixelbuf_show_obj)},
 };
 
@@ -29,7 +29,7 @@
 
 #include "shared-bindings/_pixelbuf/types.h"
 
-const mp_obj_type_t pixelbuf_pixelbuf_type;
+extern const mp_obj_type_t pixelbuf_pixelbuf_type;
 
 typedef struct {
     mp_obj_base_t base;
@@ -40,6 +40,10 @@ typedef struct {
     mp_obj_t bytearray;
     mp_obj_t rawbytearray;
     mp_float_t brightness;
+    mp_float_t gamma;
+    // Maps raw channel values to output values. NULL when brightness is 1 and gamma is 1.
+    uint8_t *brightness_lut;
+    bool defer_brightness;
     bool two_buffers;
     size_t offset;
     bool dotstar_mode;
@@ -51,6 +55,7 @@ typedef struct {
 } pixelbuf_pixelbuf_obj_t;
 
 void pixelbuf_recalculate_brightness(pixelbuf_pixelbuf_obj_t *self);
+void pixelbuf_update_brightness_lut(pixelbuf_pixelbuf_obj_t *self);
 void call_write_function(pixelbuf_pixelbuf_obj_t *self);
 
 #endif  // CP_SHARED_BINDINGS_PIXELBUF_PIXELBUF_H
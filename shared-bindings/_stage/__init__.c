@@ -27,7 +27,6 @@
 #include "__init__.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
-#include "shared-bindings/busio/SPI.h"
 #include "shared-bindings/displayio/Display.h"
 #include "shared-module/_stage/__init__.h"
 #include "Layer.h"
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiobusio/PDMDecimator.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/ioctl.h"
+#include "py/mperrno.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audiobusio
+//|
+//| :class:`PDMDecimator` -- Converts a PDM bitstream to samples
+//| ============================================================
+//|
+//| PDMDecimator runs the filters that `PDMIn` uses on PDM data given to it instead of on a
+//| microphone. It is available on ports without PDM hardware so that the filters can be tested.
+//|
+//| .. class:: PDMDecimator(*, oversample=64, bit_depth=16, buffer_size=1024)
+//|
+//|   Create a PDMDecimator. The output is unsigned like `PDMIn.record`.
+//|
+//|   :param int oversample: Number of PDM bits per sample. A power of two from 16 to 256
+//|   :param int bit_depth: Bits per sample, 8 or 16
+//|   :param int buffer_size: Size in bytes of the buffer that holds samples until they are read.
+//|     It is rounded up to a power of two.
+//|
+//|   Decimating 64x oversampled PDM bytes::
+//|
+//|     import array
+//|     import audiobusio
+//|
+//|     decimator = audiobusio.PDMDecimator()
+//|     decimator.write(pdm)
+//|     samples = array.array("H", [0] * (len(pdm) // 8))
+//|     decimator.readinto(samples)
+//|
+STATIC mp_obj_t audiobusio_pdmdecimator_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_oversample, ARG_bit_depth, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_oversample, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 64} },
+        { MP_QSTR_bit_depth, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t oversample = args[ARG_oversample].u_int;
+    if (oversample < AUDIOBUSIO_PDM_MIN_OVERSAMPLE || oversample > AUDIOBUSIO_PDM_MAX_OVERSAMPLE ||
+        (oversample & (oversample - 1)) != 0) {
+        mp_raise_ValueError(translate("Oversample must be a power of two from 16 to 256"));
+    }
+    mp_int_t bit_depth = args[ARG_bit_depth].u_int;
+    if (bit_depth != 8 && bit_depth != 16) {
+        mp_raise_ValueError(translate("Bit depth must be 8 or 16"));
+    }
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 2 || buffer_size > 0x100000) {
+        mp_raise_ValueError(translate("Invalid buffer size"));
+    }
+
+    audiobusio_pdmdecimator_obj_t *self = m_new_obj(audiobusio_pdmdecimator_obj_t);
+    self->base.type = &audiobusio_pdmdecimator_type;
+    common_hal_audiobusio_pdmdecimator_construct(self, oversample, bit_depth, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: deinit()
+//|
+//|      Deinitialises the PDMDecimator and releases its buffer for reuse.
+//|
+STATIC mp_obj_t audiobusio_pdmdecimator_deinit(mp_obj_t self_in) {
+    audiobusio_pdmdecimator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audiobusio_pdmdecimator_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmdecimator_deinit_obj, audiobusio_pdmdecimator_deinit);
+
+//|   .. method:: __enter__()
+//|
+//|      No-op used by Context Managers.
+//|
+//  Provided by context manager helper.
+
+//|   .. method:: __exit__()
+//|
+//|      Automatically deinitializes the PDMDecimator when exiting a context. See
+//|      :ref:`lifetime-and-contextmanagers` for more info.
+//|
+STATIC mp_obj_t audiobusio_pdmdecimator_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audiobusio_pdmdecimator_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiobusio_pdmdecimator___exit___obj, 4, 4, audiobusio_pdmdecimator_obj___exit__);
+
+// These are standard stream methods. Code is in py/stream.c.
+//
+//|   .. method:: write(buf)
+//|
+//|     Decimates the PDM bits in ``buf``, most significant bit of each byte first. Samples that
+//|     don't fit in the buffer are dropped and counted in `overruns`.
+//|
+//|     :return: the number of bytes written
+//|     :rtype: int
+//|
+//|   .. method:: read(nbytes=None)
+//|
+//|     Read whole samples. If ``nbytes`` is specified then read at most that many bytes.
+//|     Otherwise, read every sample that is waiting.
+//|
+//|     :return: Data read
+//|     :rtype: bytes or None
+//|
+//|   .. method:: readinto(buf)
+//|
+//|     Read whole samples into ``buf``. Read at most ``len(buf)`` bytes.
+//|
+//|     :return: number of bytes read and stored into ``buf``
+//|     :rtype: int or None (when no samples are waiting)
+//|
+
+// These three methods are used by the shared stream methods.
+STATIC mp_uint_t audiobusio_pdmdecimator_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
+    audiobusio_pdmdecimator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmdecimator_deinited(self));
+    if (size == 0) {
+        return 0;
+    }
+    mp_uint_t length = common_hal_audiobusio_pdmdecimator_read(self, buf_in, size);
+    if (length == 0 && common_hal_audiobusio_pdmdecimator_get_in_waiting(self) == 0) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return length;
+}
+
+STATIC mp_uint_t audiobusio_pdmdecimator_write(mp_obj_t self_in, const void *buf_in, mp_uint_t size, int *errcode) {
+    audiobusio_pdmdecimator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmdecimator_deinited(self));
+    common_hal_audiobusio_pdmdecimator_write(self, buf_in, size);
+    return size;
+}
+
+STATIC mp_uint_t audiobusio_pdmdecimator_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    audiobusio_pdmdecimator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmdecimator_deinited(self));
+    mp_uint_t ret;
+    if (request == MP_IOCTL_POLL) {
+        mp_uint_t flags = arg;
+        ret = flags & MP_IOCTL_POLL_WR;
+        if ((flags & MP_IOCTL_POLL_RD) && common_hal_audiobusio_pdmdecimator_get_in_waiting(self) > 0) {
+            ret |= MP_IOCTL_POLL_RD;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
+//|   .. attribute:: in_waiting
+//|
+//|     The number of bytes of samples waiting to be read. (read-only)
+//|
+STATIC mp_obj_t audiobusio_pdmdecimator_obj_get_in_waiting(mp_obj_t self_in) {
+    audiobusio_pdmdecimator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmdecimator_deinited(self));
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiobusio_pdmdecimator_get_in_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmdecimator_get_in_waiting_obj, audiobusio_pdmdecimator_obj_get_in_waiting);
+
+const mp_obj_property_t audiobusio_pdmdecimator_in_waiting_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmdecimator_get_in_waiting_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: overruns
+//|
+//|     The number of samples dropped because the buffer was full. (read-only)
+//|
+STATIC mp_obj_t audiobusio_pdmdecimator_obj_get_overruns(mp_obj_t self_in) {
+    audiobusio_pdmdecimator_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmdecimator_deinited(self));
+    return mp_obj_new_int_from_uint(common_hal_audiobusio_pdmdecimator_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmdecimator_get_overruns_obj, audiobusio_pdmdecimator_obj_get_overruns);
+
+const mp_obj_property_t audiobusio_pdmdecimator_overruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmdecimator_get_overruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t audiobusio_pdmdecimator_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiobusio_pdmdecimator_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_pdmdecimator___exit___obj) },
+
+    // Standard stream methods.
+    { MP_OBJ_NEW_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_write), MP_ROM_PTR(&mp_stream_write_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&audiobusio_pdmdecimator_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overruns), MP_ROM_PTR(&audiobusio_pdmdecimator_overruns_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audiobusio_pdmdecimator_locals_dict, audiobusio_pdmdecimator_locals_dict_table);
+
+STATIC const mp_stream_p_t audiobusio_pdmdecimator_stream_p = {
+    .read = audiobusio_pdmdecimator_read,
+    .write = audiobusio_pdmdecimator_write,
+    .ioctl = audiobusio_pdmdecimator_ioctl,
+    .is_text = false,
+    .pyserial_compatibility = true,
+};
+
+const mp_obj_type_t audiobusio_pdmdecimator_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_PDMDecimator,
+    .make_new = audiobusio_pdmdecimator_make_new,
+    .protocol = &audiobusio_pdmdecimator_stream_p,
+    .locals_dict = (mp_obj_dict_t*)&audiobusio_pdmdecimator_locals_dict,
+};
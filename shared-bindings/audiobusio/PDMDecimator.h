@@ -0,0 +1,47 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_PDMDECIMATOR_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_PDMDECIMATOR_H
+
+#include "shared-module/audiobusio/PDMDecimator.h"
+
+extern const mp_obj_type_t audiobusio_pdmdecimator_type;
+
+void common_hal_audiobusio_pdmdecimator_construct(audiobusio_pdmdecimator_obj_t* self,
+    uint16_t oversample, uint8_t bit_depth, uint32_t buffer_size);
+
+void common_hal_audiobusio_pdmdecimator_deinit(audiobusio_pdmdecimator_obj_t* self);
+bool common_hal_audiobusio_pdmdecimator_deinited(audiobusio_pdmdecimator_obj_t* self);
+void common_hal_audiobusio_pdmdecimator_write(audiobusio_pdmdecimator_obj_t* self,
+    const uint8_t* pdm, uint32_t length);
+// Reads whole samples only and returns the number of bytes read.
+uint32_t common_hal_audiobusio_pdmdecimator_read(audiobusio_pdmdecimator_obj_t* self,
+    uint8_t* data, uint32_t length);
+uint32_t common_hal_audiobusio_pdmdecimator_get_in_waiting(audiobusio_pdmdecimator_obj_t* self);
+uint32_t common_hal_audiobusio_pdmdecimator_get_overruns(audiobusio_pdmdecimator_obj_t* self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_PDMDECIMATOR_H
@@ -28,9 +28,12 @@
 
 #include "lib/utils/context_manager_helpers.h"
 #include "py/binary.h"
+#include "py/ioctl.h"
+#include "py/mperrno.h"
 #include "py/mphal.h"
 #include "py/objproperty.h"
 #include "py/runtime.h"
+#include "py/stream.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/audiobusio/PDMIn.h"
 #include "shared-bindings/util.h"
@@ -43,7 +46,7 @@
 //|
 //| PDMIn can be used to record an input audio signal on a given set of pins.
 //|
-//| .. class:: PDMIn(clock_pin, data_pin, *, sample_rate=16000, bit_depth=8, mono=True, oversample=64, startup_delay=0.11)
+//| .. class:: PDMIn(clock_pin, data_pin, *, sample_rate=16000, bit_depth=8, mono=True, oversample=64, startup_delay=0.11, buffer_size=1024)
 //|
 //|   Create a PDMIn object associated with the given pins. This allows you to
 //|   record audio signals from the given pins. Individual ports may put further
@@ -61,6 +64,8 @@
 //|   :param float startup_delay: seconds to wait after starting microphone clock
 //|    to allow microphone to turn on. Most require only 0.01s; some require 0.1s. Longer is safer.
 //|    Must be in range 0.0-1.0 seconds.
+//|   :param int buffer_size: Size in bytes of the buffer that holds samples recorded with `start`
+//|     until they are read. It is rounded up to a power of two.
 //|
 
 //|   Record 8-bit unsigned samples to buffer::
@@ -87,8 +92,23 @@
 //|     with audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000, bit_depth=16) as mic:
 //|         mic.record(b, len(b))
 //|
+//|   Record 16-bit unsigned samples in the background while doing other work::
+//|
+//|     import array
+//|     import audiobusio
+//|     import board
+//|
+//|     b = array.array("H", [0] * 256)
+//|     with audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000,
+//|                           bit_depth=16, buffer_size=4096) as mic:
+//|         mic.start()
+//|         while True:
+//|             received = mic.readinto(b)
+//|             if received:
+//|                 process(b, received // 2)
+//|
 STATIC mp_obj_t audiobusio_pdmin_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_clock_pin, ARG_data_pin, ARG_sample_rate, ARG_bit_depth, ARG_mono, ARG_oversample, ARG_startup_delay };
+    enum { ARG_clock_pin, ARG_data_pin, ARG_sample_rate, ARG_bit_depth, ARG_mono, ARG_oversample, ARG_startup_delay, ARG_buffer_size };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_clock_pin,     MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_data_pin,      MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -97,6 +117,7 @@ STATIC mp_obj_t audiobusio_pdmin_make_new(const mp_obj_type_t *type, size_t n_ar
         { MP_QSTR_mono,          MP_ARG_KW_ONLY | MP_ARG_BOOL,{.u_bool = true} },
         { MP_QSTR_oversample,    MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 64} },
         { MP_QSTR_startup_delay, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = MP_OBJ_NULL} },
+        { MP_QSTR_buffer_size,   MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 1024} },
     };
     // Default microphone startup delay is 110msecs. Have seen mics that need 100 msecs plus a bit.
     static const float STARTUP_DELAY_DEFAULT = 0.110F;
@@ -135,9 +156,13 @@ STATIC mp_obj_t audiobusio_pdmin_make_new(const mp_obj_type_t *type, size_t n_ar
     if (startup_delay < 0.0 || startup_delay > 1.0) {
         mp_raise_ValueError(translate("Microphone startup delay must be in range 0.0 to 1.0"));
     }
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 2 || buffer_size > 0x100000) {
+        mp_raise_ValueError(translate("Invalid buffer size"));
+    }
 
     common_hal_audiobusio_pdmin_construct(self, clock_pin, data_pin, sample_rate,
-                                          bit_depth, mono, oversample);
+                                          bit_depth, mono, oversample, buffer_size);
 
     // Wait for the microphone to start up. Some start in 10 msecs; some take as much as 100 msecs.
     mp_hal_delay_ms(startup_delay * 1000);
@@ -186,9 +211,14 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audiobusio_pdmin___exit___obj, 4, 4,
 //|     :return: The number of samples recorded. If this is less than ``destination_length``,
 //|       some samples were missed due to processing time.
 //|
+//|     record can't be used while recording in the background with `start`.
+//|
 STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destination, mp_obj_t destination_length) {
     audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_obj);
     raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    if (common_hal_audiobusio_pdmin_get_recording(self)) {
+        mp_raise_RuntimeError(translate("Already recording"));
+    }
     if (!MP_OBJ_IS_SMALL_INT(destination_length) || MP_OBJ_SMALL_INT_VALUE(destination_length) < 0) {
         mp_raise_TypeError(translate("destination_length must be an int >= 0"));
     }
@@ -216,6 +246,85 @@ STATIC mp_obj_t audiobusio_pdmin_obj_record(mp_obj_t self_obj, mp_obj_t destinat
 }
 MP_DEFINE_CONST_FUN_OBJ_3(audiobusio_pdmin_record_obj, audiobusio_pdmin_obj_record);
 
+//|   .. method:: start()
+//|
+//|     Starts recording in the background. Samples are decimated as the microphone delivers
+//|     them and wait in a buffer of ``buffer_size`` bytes until they are read with `read` or
+//|     `readinto`. Samples that arrive while the buffer is full are dropped and counted in
+//|     `overruns`.
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_start(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    common_hal_audiobusio_pdmin_start(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_start_obj, audiobusio_pdmin_obj_start);
+
+//|   .. method:: stop()
+//|
+//|     Stops recording in the background. Samples already recorded can still be read.
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_stop(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    common_hal_audiobusio_pdmin_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_stop_obj, audiobusio_pdmin_obj_stop);
+
+// These are standard stream methods. Code is in py/stream.c.
+//
+//|   .. method:: read(nbytes=None)
+//|
+//|     Read whole samples recorded in the background. If ``nbytes`` is specified then read at
+//|     most that many bytes. Otherwise, read every sample that is waiting. This doesn't wait for
+//|     more samples to arrive.
+//|
+//|     :return: Data read
+//|     :rtype: bytes or None
+//|
+//|   .. method:: readinto(buf)
+//|
+//|     Read whole samples recorded in the background into ``buf``. Read at most ``len(buf)``
+//|     bytes. This doesn't wait for more samples to arrive.
+//|
+//|     :return: number of bytes read and stored into ``buf``
+//|     :rtype: int or None (when no samples are waiting)
+//|
+
+// These two methods are used by the shared stream methods.
+STATIC mp_uint_t audiobusio_pdmin_read(mp_obj_t self_in, void *buf_in, mp_uint_t size, int *errcode) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    if (size == 0) {
+        return 0;
+    }
+    mp_uint_t length = common_hal_audiobusio_pdmin_read(self, buf_in, size);
+    if (length == 0 && common_hal_audiobusio_pdmin_get_in_waiting(self) == 0) {
+        *errcode = MP_EAGAIN;
+        return MP_STREAM_ERROR;
+    }
+    return length;
+}
+
+STATIC mp_uint_t audiobusio_pdmin_ioctl(mp_obj_t self_in, mp_uint_t request, mp_uint_t arg, int *errcode) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    mp_uint_t ret;
+    if (request == MP_IOCTL_POLL) {
+        mp_uint_t flags = arg;
+        ret = 0;
+        if ((flags & MP_IOCTL_POLL_RD) && common_hal_audiobusio_pdmin_get_in_waiting(self) > 0) {
+            ret |= MP_IOCTL_POLL_RD;
+        }
+    } else {
+        *errcode = MP_EINVAL;
+        ret = MP_STREAM_ERROR;
+    }
+    return ret;
+}
+
 //|   .. attribute:: sample_rate
 //|
 //|     The actual sample_rate of the recording. This may not match the constructed
@@ -235,19 +344,93 @@ const mp_obj_property_t audiobusio_pdmin_sample_rate_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|   .. attribute:: recording
+//|
+//|     True when recording in the background. (read-only)
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_recording(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    return mp_obj_new_bool(common_hal_audiobusio_pdmin_get_recording(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_recording_obj, audiobusio_pdmin_obj_get_recording);
+
+const mp_obj_property_t audiobusio_pdmin_recording_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmin_get_recording_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: in_waiting
+//|
+//|     The number of bytes of samples recorded in the background waiting to be read. (read-only)
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_in_waiting(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audiobusio_pdmin_get_in_waiting(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_in_waiting_obj, audiobusio_pdmin_obj_get_in_waiting);
+
+const mp_obj_property_t audiobusio_pdmin_in_waiting_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmin_get_in_waiting_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: overruns
+//|
+//|     The number of samples dropped since `start` because they weren't read in time.
+//|     (read-only)
+//|
+STATIC mp_obj_t audiobusio_pdmin_obj_get_overruns(mp_obj_t self_in) {
+    audiobusio_pdmin_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audiobusio_pdmin_deinited(self));
+    return mp_obj_new_int_from_uint(common_hal_audiobusio_pdmin_get_overruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audiobusio_pdmin_get_overruns_obj, audiobusio_pdmin_obj_get_overruns);
+
+const mp_obj_property_t audiobusio_pdmin_overruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audiobusio_pdmin_get_overruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 STATIC const mp_rom_map_elem_t audiobusio_pdmin_locals_dict_table[] = {
     // Methods
     { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audiobusio_pdmin_deinit_obj) },
     { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audiobusio_pdmin___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_record), MP_ROM_PTR(&audiobusio_pdmin_record_obj) },
-    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) }
+    { MP_ROM_QSTR(MP_QSTR_start), MP_ROM_PTR(&audiobusio_pdmin_start_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audiobusio_pdmin_stop_obj) },
+
+    // Standard stream methods.
+    { MP_OBJ_NEW_QSTR(MP_QSTR_read), MP_ROM_PTR(&mp_stream_read_obj) },
+    { MP_OBJ_NEW_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&mp_stream_readinto_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audiobusio_pdmin_sample_rate_obj) },
+    { MP_ROM_QSTR(MP_QSTR_recording), MP_ROM_PTR(&audiobusio_pdmin_recording_obj) },
+    { MP_ROM_QSTR(MP_QSTR_in_waiting), MP_ROM_PTR(&audiobusio_pdmin_in_waiting_obj) },
+    { MP_ROM_QSTR(MP_QSTR_overruns), MP_ROM_PTR(&audiobusio_pdmin_overruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audiobusio_pdmin_locals_dict, audiobusio_pdmin_locals_dict_table);
 
+STATIC const mp_stream_p_t audiobusio_pdmin_stream_p = {
+    .read = audiobusio_pdmin_read,
+    .ioctl = audiobusio_pdmin_ioctl,
+    .is_text = false,
+    .pyserial_compatibility = true,
+};
+
 const mp_obj_type_t audiobusio_pdmin_type = {
     { &mp_type_type },
     .name = MP_QSTR_PDMIn,
     .make_new = audiobusio_pdmin_make_new,
+    .protocol = &audiobusio_pdmin_stream_p,
     .locals_dict = (mp_obj_dict_t*)&audiobusio_pdmin_locals_dict,
 };
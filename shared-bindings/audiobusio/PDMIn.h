@@ -35,13 +35,21 @@ extern const mp_obj_type_t audiobusio_pdmin_type;
 
 void common_hal_audiobusio_pdmin_construct(audiobusio_pdmin_obj_t* self,
     const mcu_pin_obj_t* clock_pin, const mcu_pin_obj_t* data_pin,
-    uint32_t sample_rate, uint8_t bit_depth, bool mono, uint8_t oversample);
+    uint32_t sample_rate, uint8_t bit_depth, bool mono, uint8_t oversample, uint32_t buffer_size);
 void common_hal_audiobusio_pdmin_deinit(audiobusio_pdmin_obj_t* self);
 bool common_hal_audiobusio_pdmin_deinited(audiobusio_pdmin_obj_t* self);
 uint32_t common_hal_audiobusio_pdmin_record_to_buffer(audiobusio_pdmin_obj_t* self,
     uint16_t* buffer, uint32_t length);
 uint8_t common_hal_audiobusio_pdmin_get_bit_depth(audiobusio_pdmin_obj_t* self);
 uint32_t common_hal_audiobusio_pdmin_get_sample_rate(audiobusio_pdmin_obj_t* self);
+void common_hal_audiobusio_pdmin_start(audiobusio_pdmin_obj_t* self);
+void common_hal_audiobusio_pdmin_stop(audiobusio_pdmin_obj_t* self);
+bool common_hal_audiobusio_pdmin_get_recording(audiobusio_pdmin_obj_t* self);
+// Reads whole samples only and returns the number of bytes read.
+uint32_t common_hal_audiobusio_pdmin_read(audiobusio_pdmin_obj_t* self, uint8_t* data,
+    uint32_t length);
+uint32_t common_hal_audiobusio_pdmin_get_in_waiting(audiobusio_pdmin_obj_t* self);
+uint32_t common_hal_audiobusio_pdmin_get_overruns(audiobusio_pdmin_obj_t* self);
 // TODO(tannewt): Add record to file
 
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOBUSIO_AUDIOOUT_H
@@ -31,8 +31,15 @@
 
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/audiobusio/__init__.h"
+#if CIRCUITPY_AUDIOBUSIO_I2SOUT
 #include "shared-bindings/audiobusio/I2SOut.h"
+#endif
+#if CIRCUITPY_AUDIOBUSIO_PDMDECIMATOR
+#include "shared-bindings/audiobusio/PDMDecimator.h"
+#endif
+#if CIRCUITPY_AUDIOBUSIO_PDMIN
 #include "shared-bindings/audiobusio/PDMIn.h"
+#endif
 
 //| :mod:`audiobusio` --- Support for audio input and output over digital bus
 //| =========================================================================
@@ -53,6 +60,7 @@
 //|
 //|     I2SOut
 //|     PDMIn
+//|     PDMDecimator
 //|
 //| All libraries change hardware state and should be deinitialized when they
 //| are no longer needed. To do so, either call :py:meth:`!deinit` or use a
@@ -61,8 +69,15 @@
 
 STATIC const mp_rom_map_elem_t audiobusio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audiobusio) },
+    #if CIRCUITPY_AUDIOBUSIO_I2SOUT
     { MP_ROM_QSTR(MP_QSTR_I2SOut), MP_ROM_PTR(&audiobusio_i2sout_type) },
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO_PDMDECIMATOR
+    { MP_ROM_QSTR(MP_QSTR_PDMDecimator), MP_ROM_PTR(&audiobusio_pdmdecimator_type) },
+    #endif
+    #if CIRCUITPY_AUDIOBUSIO_PDMIN
     { MP_ROM_QSTR(MP_QSTR_PDMIn), MP_ROM_PTR(&audiobusio_pdmin_type) },
+    #endif
 };
 
 STATIC MP_DEFINE_CONST_DICT(audiobusio_module_globals, audiobusio_module_globals_table);
@@ -0,0 +1,162 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Biquad.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/runtime.h"
+#include "shared-bindings/audioio/__init__.h"
+#include "shared-bindings/audioio/Effect.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audioio
+//|
+//| :class:`Biquad` -- Filters a sample with a second order filter
+//| ===============================================================
+//|
+//| Biquad filters a sample as it plays. It can cut the frequencies above or below a cutoff, keep a
+//| band around a center frequency or boost or cut everything above or below a shelf frequency.
+//| Filtering is done in fixed point and the sample's format is kept.
+//|
+//| .. class:: Biquad(sample, *, mode=Biquad.LOWPASS, frequency, q=0.7071, gain=0.0, buffer_size=1024)
+//|
+//|   Create a Biquad that filters the given sample.
+//|
+//|   :param sample: The audio sample to filter, such as a `audioio.WaveFile` or another effect
+//|   :param int mode: `Biquad.LOWPASS`, `Biquad.HIGHPASS`, `Biquad.BANDPASS`, `Biquad.LOWSHELF`
+//|     or `Biquad.HIGHSHELF`
+//|   :param float frequency: The cutoff, center or shelf frequency in Hertz. It must be below half
+//|     the sample's sample rate.
+//|   :param float q: How sharp the filter is around frequency. Higher values ring more.
+//|   :param float gain: The boost in decibels of the shelf modes. Negative values cut.
+//|   :param int buffer_size: The total size in bytes of the buffers to filter into
+//|
+//|   Taking the hiss out of a recording::
+//|
+//|     import board
+//|     import audioio
+//|
+//|     a = audioio.AudioOut(board.A0)
+//|     music = audioio.WaveFile(open("music.wav", "rb"))
+//|     a.play(audioio.Biquad(music, mode=audioio.Biquad.LOWPASS, frequency=4000))
+//|
+STATIC mp_obj_t audioio_biquad_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_mode, ARG_frequency, ARG_q, ARG_gain, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_mode, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = AUDIOIO_BIQUAD_LOWPASS} },
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_q, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_gain, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audioio_validate_sample(sample);
+    mp_int_t mode = args[ARG_mode].u_int;
+    if (mode < AUDIOIO_BIQUAD_LOWPASS || mode > AUDIOIO_BIQUAD_HIGHSHELF) {
+        mp_raise_ValueError(translate("Invalid mode"));
+    }
+    mp_float_t frequency = mp_obj_get_float(args[ARG_frequency].u_obj);
+    audioio_validate_frequency(sample, frequency);
+    mp_float_t q = MICROPY_FLOAT_CONST(0.7071);
+    if (args[ARG_q].u_obj != mp_const_none) {
+        q = mp_obj_get_float(args[ARG_q].u_obj);
+    }
+    if (q <= 0) {
+        mp_raise_ValueError(translate("q must be positive"));
+    }
+    mp_float_t gain = 0;
+    if (args[ARG_gain].u_obj != mp_const_none) {
+        gain = mp_obj_get_float(args[ARG_gain].u_obj);
+    }
+
+    audioio_effect_obj_t *self = m_new_obj(audioio_effect_obj_t);
+    self->base.type = &audioio_biquad_type;
+    common_hal_audioio_biquad_construct(self, sample, mode, frequency, q, gain,
+                                        args[ARG_buffer_size].u_int);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: deinit()
+//|
+//|      Deinitialises the Biquad and releases its buffers for reuse.
+//|
+//|   .. method:: __enter__()
+//|
+//|      No-op used by Context Managers.
+//|
+//|   .. method:: __exit__()
+//|
+//|      Automatically deinitializes the Biquad when exiting a context. See
+//|      :ref:`lifetime-and-contextmanagers` for more info.
+//|
+//|   .. data:: LOWPASS
+//|
+//|     Passes frequencies below frequency.
+//|
+//|   .. data:: HIGHPASS
+//|
+//|     Passes frequencies above frequency.
+//|
+//|   .. data:: BANDPASS
+//|
+//|     Passes frequencies around frequency. Higher q narrows the band.
+//|
+//|   .. data:: LOWSHELF
+//|
+//|     Changes the level of frequencies below frequency by gain.
+//|
+//|   .. data:: HIGHSHELF
+//|
+//|     Changes the level of frequencies above frequency by gain.
+//|
+STATIC const mp_rom_map_elem_t audioio_biquad_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_effect___exit___obj) },
+
+    // Modes
+    { MP_ROM_QSTR(MP_QSTR_LOWPASS), MP_ROM_INT(AUDIOIO_BIQUAD_LOWPASS) },
+    { MP_ROM_QSTR(MP_QSTR_HIGHPASS), MP_ROM_INT(AUDIOIO_BIQUAD_HIGHPASS) },
+    { MP_ROM_QSTR(MP_QSTR_BANDPASS), MP_ROM_INT(AUDIOIO_BIQUAD_BANDPASS) },
+    { MP_ROM_QSTR(MP_QSTR_LOWSHELF), MP_ROM_INT(AUDIOIO_BIQUAD_LOWSHELF) },
+    { MP_ROM_QSTR(MP_QSTR_HIGHSHELF), MP_ROM_INT(AUDIOIO_BIQUAD_HIGHSHELF) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_biquad_locals_dict, audioio_biquad_locals_dict_table);
+
+const mp_obj_type_t audioio_biquad_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Biquad,
+    .make_new = audioio_biquad_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_biquad_locals_dict,
+};
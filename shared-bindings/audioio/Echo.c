@@ -0,0 +1,140 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Echo.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/runtime.h"
+#include "shared-bindings/audioio/__init__.h"
+#include "shared-bindings/audioio/Effect.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audioio
+//|
+//| :class:`Echo` -- Repeats a sample after a delay
+//| ================================================
+//|
+//| Echo mixes a sample with a delayed copy of itself. Each echo is fed back into the delay so it
+//| repeats, quieter each time. The delay line takes two bytes per sample so long delays need a lot
+//| of memory. The echoes stop when a sample that isn't looping ends.
+//|
+//| .. class:: Echo(sample, *, delay, feedback=0.5, mix=0.5, buffer_size=1024)
+//|
+//|   Create an Echo of the given sample.
+//|
+//|   :param sample: The audio sample to echo, such as a `audioio.WaveFile` or another effect
+//|   :param float delay: The time between echoes in seconds
+//|   :param float feedback: The level of each echo relative to the one before, from 0 up to but
+//|     not including 1
+//|   :param float mix: The level of the echoes relative to the sample, from 0 to 1
+//|   :param int buffer_size: The total size in bytes of the buffers to process into
+//|
+//|   A slapback echo on a drum loop::
+//|
+//|     import board
+//|     import audioio
+//|
+//|     a = audioio.AudioOut(board.A0)
+//|     drums = audioio.WaveFile(open("drums.wav", "rb"))
+//|     a.play(audioio.Echo(drums, delay=0.12, feedback=0.3), loop=True)
+//|
+STATIC mp_obj_t audioio_echo_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_delay, ARG_feedback, ARG_mix, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_delay, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_feedback, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_mix, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audioio_validate_sample(sample);
+    mp_float_t delay = mp_obj_get_float(args[ARG_delay].u_obj);
+    if (delay <= 0) {
+        mp_raise_ValueError(translate("delay must be positive"));
+    }
+    // The delay line holds every sample of the delay as two bytes. Keep its length in bytes within
+    // 32 bits so that converting and sizing it can't wrap.
+    mp_float_t line_length = delay * audiosample_sample_rate(sample) *
+                             audiosample_channel_count(sample);
+    if (line_length > (mp_float_t) (INT32_MAX / sizeof(int16_t))) {
+        mp_raise_ValueError(translate("delay is too long"));
+    }
+    mp_float_t feedback = MICROPY_FLOAT_CONST(0.5);
+    if (args[ARG_feedback].u_obj != mp_const_none) {
+        feedback = mp_obj_get_float(args[ARG_feedback].u_obj);
+    }
+    if (feedback < 0 || feedback >= 1) {
+        mp_raise_ValueError(translate("feedback must be at least 0 and below 1"));
+    }
+    mp_float_t mix = MICROPY_FLOAT_CONST(0.5);
+    if (args[ARG_mix].u_obj != mp_const_none) {
+        mix = mp_obj_get_float(args[ARG_mix].u_obj);
+    }
+    if (mix < 0 || mix > 1) {
+        mp_raise_ValueError(translate("mix must be between 0 and 1"));
+    }
+
+    audioio_effect_obj_t *self = m_new_obj(audioio_effect_obj_t);
+    self->base.type = &audioio_echo_type;
+    common_hal_audioio_echo_construct(self, sample, delay, feedback, mix,
+                                      args[ARG_buffer_size].u_int);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: deinit()
+//|
+//|      Deinitialises the Echo and releases its buffers for reuse.
+//|
+//|   .. method:: __enter__()
+//|
+//|      No-op used by Context Managers.
+//|
+//|   .. method:: __exit__()
+//|
+//|      Automatically deinitializes the Echo when exiting a context. See
+//|      :ref:`lifetime-and-contextmanagers` for more info.
+//|
+STATIC const mp_rom_map_elem_t audioio_echo_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_effect___exit___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_echo_locals_dict, audioio_echo_locals_dict_table);
+
+const mp_obj_type_t audioio_echo_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Echo,
+    .make_new = audioio_echo_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_echo_locals_dict,
+};
@@ -140,21 +140,57 @@ STATIC mp_obj_t audioio_mixer_obj___exit__(size_t n_args, const mp_obj_t *args)
 STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_mixer___exit___obj, 4, 4, audioio_mixer_obj___exit__);
 
 
-//|   .. method:: play(sample, *, voice=0, loop=False)
+STATIC mp_float_t get_level(mp_obj_t level_obj, mp_float_t default_level) {
+    if (level_obj == mp_const_none) {
+        return default_level;
+    }
+    mp_float_t level = mp_obj_get_float(level_obj);
+    if (level < 0 || level > 1) {
+        mp_raise_ValueError(translate("level must be between 0 and 1"));
+    }
+    return level;
+}
+
+STATIC mp_float_t get_pan(mp_obj_t pan_obj, mp_float_t default_pan) {
+    if (pan_obj == mp_const_none) {
+        return default_pan;
+    }
+    mp_float_t pan = mp_obj_get_float(pan_obj);
+    if (pan < -1 || pan > 1) {
+        mp_raise_ValueError(translate("pan must be between -1 and 1"));
+    }
+    return pan;
+}
+
+STATIC uint8_t get_voice(audioio_mixer_obj_t *self, mp_int_t voice) {
+    if (voice < 0 || voice >= self->voice_count) {
+        mp_raise_ValueError(translate("Voice index too high"));
+    }
+    return voice;
+}
+
+//|   .. method:: play(sample, *, voice=0, loop=False, level=1.0, pan=0.0)
 //|
 //|     Plays the sample once when loop=False and continuously when loop=True.
 //|     Does not block. Use `playing` to block.
 //|
-//|     Sample must be an `audioio.WaveFile`, `audioio.Mixer` or `audioio.RawSample`.
+//|     Sample must be an `audioio.WaveFile`, `audioio.Mixer`, `audioio.RawSample`,
+//|     `audioio.Resampler`, `audioio.Synthesizer` or an effect such as `audioio.Biquad`.
 //|
 //|     The sample must match the Mixer's encoding settings given in the constructor.
 //|
+//|     :param float level: Volume of the voice from 0.0 (silent) to 1.0 (unchanged)
+//|     :param float pan: Stereo position of the voice from -1.0 (left) to 1.0 (right). Ignored
+//|       when the Mixer is mono.
+//|
 STATIC mp_obj_t audioio_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_sample, ARG_voice, ARG_loop };
+    enum { ARG_sample, ARG_voice, ARG_loop, ARG_level, ARG_pan };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_sample,    MP_ARG_OBJ | MP_ARG_REQUIRED },
         { MP_QSTR_voice,     MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_loop,      MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_level,     MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_pan,       MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
     };
     audioio_mixer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
     raise_error_if_deinited(common_hal_audioio_mixer_deinited(self));
@@ -162,7 +198,9 @@ STATIC mp_obj_t audioio_mixer_obj_play(size_t n_args, const mp_obj_t *pos_args,
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     mp_obj_t sample = args[ARG_sample].u_obj;
-    common_hal_audioio_mixer_play(self, sample, args[ARG_voice].u_int, args[ARG_loop].u_bool);
+    common_hal_audioio_mixer_play(self, sample, get_voice(self, args[ARG_voice].u_int),
+                                  args[ARG_loop].u_bool, get_level(args[ARG_level].u_obj, 1.0),
+                                  get_pan(args[ARG_pan].u_obj, 0.0));
 
     return mp_const_none;
 }
@@ -182,11 +220,37 @@ STATIC mp_obj_t audioio_mixer_obj_stop_voice(size_t n_args, const mp_obj_t *pos_
     mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
     mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
-    common_hal_audioio_mixer_stop_voice(self, args[ARG_voice].u_int);
+    common_hal_audioio_mixer_stop_voice(self, get_voice(self, args[ARG_voice].u_int));
     return mp_const_none;
 }
 MP_DEFINE_CONST_FUN_OBJ_KW(audioio_mixer_stop_voice_obj, 1, audioio_mixer_obj_stop_voice);
 
+//|   .. method:: set_voice(voice, *, level=None, pan=None)
+//|
+//|     Changes the level and pan of the given voice while it plays. Settings that are None are
+//|     left unchanged. They are kept for the next sample played on the voice unless `play` is
+//|     given new ones.
+//|
+STATIC mp_obj_t audioio_mixer_obj_set_voice(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_voice, ARG_level, ARG_pan };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_voice, MP_ARG_INT | MP_ARG_REQUIRED },
+        { MP_QSTR_level, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_pan,   MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    audioio_mixer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    raise_error_if_deinited(common_hal_audioio_mixer_deinited(self));
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    uint8_t voice = get_voice(self, args[ARG_voice].u_int);
+    mp_float_t level = get_level(args[ARG_level].u_obj, common_hal_audioio_mixer_get_voice_level(self, voice));
+    mp_float_t pan = get_pan(args[ARG_pan].u_obj, common_hal_audioio_mixer_get_voice_pan(self, voice));
+    common_hal_audioio_mixer_set_voice(self, voice, level, pan);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audioio_mixer_set_voice_obj, 2, audioio_mixer_obj_set_voice);
+
 //|   .. attribute:: playing
 //|
 //|     True when any voice is being output. (read-only)
@@ -231,6 +295,7 @@ STATIC const mp_rom_map_elem_t audioio_mixer_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_mixer___exit___obj) },
     { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&audioio_mixer_play_obj) },
     { MP_ROM_QSTR(MP_QSTR_stop_voice), MP_ROM_PTR(&audioio_mixer_stop_voice_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_voice), MP_ROM_PTR(&audioio_mixer_set_voice_obj) },
 
     // Properties
     { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioio_mixer_playing_obj) },
@@ -43,8 +43,13 @@ void common_hal_audioio_mixer_construct(audioio_mixer_obj_t* self,
 
 void common_hal_audioio_mixer_deinit(audioio_mixer_obj_t* self);
 bool common_hal_audioio_mixer_deinited(audioio_mixer_obj_t* self);
-void common_hal_audioio_mixer_play(audioio_mixer_obj_t* self, mp_obj_t sample, uint8_t voice, bool loop);
+void common_hal_audioio_mixer_play(audioio_mixer_obj_t* self, mp_obj_t sample, uint8_t voice, bool loop,
+                                   mp_float_t level, mp_float_t pan);
 void common_hal_audioio_mixer_stop_voice(audioio_mixer_obj_t* self, uint8_t voice);
+void common_hal_audioio_mixer_set_voice(audioio_mixer_obj_t* self, uint8_t voice, mp_float_t level,
+                                        mp_float_t pan);
+mp_float_t common_hal_audioio_mixer_get_voice_level(audioio_mixer_obj_t* self, uint8_t voice);
+mp_float_t common_hal_audioio_mixer_get_voice_pan(audioio_mixer_obj_t* self, uint8_t voice);
 
 bool common_hal_audioio_mixer_get_playing(audioio_mixer_obj_t* self);
 uint32_t common_hal_audioio_mixer_get_sample_rate(audioio_mixer_obj_t* self);
@@ -0,0 +1,178 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/NullSink.h"
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audioio
+//|
+//| :class:`NullSink` -- Audio output that receives samples into memory
+//| ====================================================================
+//|
+//| Stands in for `AudioOut` on hosts without audio hardware. It fetches buffers from a sample in
+//| the same way audio DMA does, but only when asked to, so that samples and mixers can be tested
+//| and benchmarked. Only available in the unix port.
+//|
+//| .. code-block:: Python
+//|
+//|   import audioio
+//|
+//|   sink = audioio.NullSink()
+//|   sink.play(mixer)
+//|   output = bytearray(1024)
+//|   sink.readinto(output)
+//|
+//| .. class:: NullSink()
+//|
+//|   Create a NullSink that isn't playing anything.
+//|
+STATIC mp_obj_t audioio_nullsink_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 0, 0, false);
+
+    audioio_nullsink_obj_t *self = m_new_obj(audioio_nullsink_obj_t);
+    self->base.type = &audioio_nullsink_type;
+    common_hal_audioio_nullsink_construct(self);
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: play(sample, *, loop=False)
+//|
+//|     Starts receiving from the sample. When loop is True the sample restarts when it ends.
+//|
+STATIC mp_obj_t audioio_nullsink_obj_play(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_loop };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_loop,   MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    audioio_nullsink_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    common_hal_audioio_nullsink_play(self, args[ARG_sample].u_obj, args[ARG_loop].u_bool);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audioio_nullsink_play_obj, 1, audioio_nullsink_obj_play);
+
+//|   .. method:: stop()
+//|
+//|     Stops receiving from the sample.
+//|
+STATIC mp_obj_t audioio_nullsink_obj_stop(mp_obj_t self_in) {
+    audioio_nullsink_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_nullsink_stop(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_nullsink_stop_obj, audioio_nullsink_obj_stop);
+
+//|   .. method:: readinto(buffer)
+//|
+//|     Fills the buffer with the sample's output bytes, fetching buffers from the sample as needed.
+//|     Returns the number of bytes read, which is less than the buffer's length once the sample
+//|     ends.
+//|
+STATIC mp_obj_t audioio_nullsink_obj_readinto(mp_obj_t self_in, mp_obj_t buffer) {
+    audioio_nullsink_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(buffer, &bufinfo, MP_BUFFER_WRITE);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_nullsink_read(self, bufinfo.buf, bufinfo.len));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_nullsink_readinto_obj, audioio_nullsink_obj_readinto);
+
+//|   .. method:: skip(count)
+//|
+//|     Receives and discards up to count bytes. Returns the number of bytes received.
+//|
+STATIC mp_obj_t audioio_nullsink_obj_skip(mp_obj_t self_in, mp_obj_t count_in) {
+    audioio_nullsink_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_int_t count = mp_obj_get_int(count_in);
+    if (count < 0) {
+        mp_raise_ValueError(translate("Length must be non-negative"));
+    }
+
+    return mp_obj_new_int_from_uint(common_hal_audioio_nullsink_read(self, NULL, count));
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_nullsink_skip_obj, audioio_nullsink_obj_skip);
+
+//|   .. attribute:: playing
+//|
+//|     True while a sample is being received. (read-only)
+//|
+STATIC mp_obj_t audioio_nullsink_obj_get_playing(mp_obj_t self_in) {
+    audioio_nullsink_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_audioio_nullsink_get_playing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_nullsink_get_playing_obj, audioio_nullsink_obj_get_playing);
+
+const mp_obj_property_t audioio_nullsink_playing_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_nullsink_get_playing_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: bytes_received
+//|
+//|     Number of bytes received from samples since the sink was created. (read-only)
+//|
+STATIC mp_obj_t audioio_nullsink_obj_get_bytes_received(mp_obj_t self_in) {
+    audioio_nullsink_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_ull(common_hal_audioio_nullsink_get_bytes_received(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_nullsink_get_bytes_received_obj, audioio_nullsink_obj_get_bytes_received);
+
+const mp_obj_property_t audioio_nullsink_bytes_received_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_nullsink_get_bytes_received_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t audioio_nullsink_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_play), MP_ROM_PTR(&audioio_nullsink_play_obj) },
+    { MP_ROM_QSTR(MP_QSTR_stop), MP_ROM_PTR(&audioio_nullsink_stop_obj) },
+    { MP_ROM_QSTR(MP_QSTR_readinto), MP_ROM_PTR(&audioio_nullsink_readinto_obj) },
+    { MP_ROM_QSTR(MP_QSTR_skip), MP_ROM_PTR(&audioio_nullsink_skip_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioio_nullsink_playing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bytes_received), MP_ROM_PTR(&audioio_nullsink_bytes_received_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_nullsink_locals_dict, audioio_nullsink_locals_dict_table);
+
+const mp_obj_type_t audioio_nullsink_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_NullSink,
+    .make_new = audioio_nullsink_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_nullsink_locals_dict,
+};
@@ -0,0 +1,43 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_NULLSINK_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_NULLSINK_H
+
+#include "shared-module/audioio/NullSink.h"
+
+extern const mp_obj_type_t audioio_nullsink_type;
+
+void common_hal_audioio_nullsink_construct(audioio_nullsink_obj_t* self);
+void common_hal_audioio_nullsink_play(audioio_nullsink_obj_t* self, mp_obj_t sample, bool loop);
+void common_hal_audioio_nullsink_stop(audioio_nullsink_obj_t* self);
+bool common_hal_audioio_nullsink_get_playing(audioio_nullsink_obj_t* self);
+// Copies up to length bytes of output into buffer, or drops them when buffer is NULL. Returns the
+// number of bytes received, which is less than length once a sample that doesn't loop ends.
+uint32_t common_hal_audioio_nullsink_read(audioio_nullsink_obj_t* self, uint8_t* buffer, uint32_t length);
+uint64_t common_hal_audioio_nullsink_get_bytes_received(audioio_nullsink_obj_t* self);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO_NULLSINK_H
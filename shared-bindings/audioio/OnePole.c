@@ -0,0 +1,106 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/OnePole.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/runtime.h"
+#include "shared-bindings/audioio/__init__.h"
+#include "shared-bindings/audioio/Effect.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audioio
+//|
+//| :class:`OnePole` -- Gently filters a sample
+//| ============================================
+//|
+//| OnePole filters a sample with a first order filter that falls off slowly past its cutoff. It
+//| costs less CPU time than `audioio.Biquad` and suits taking the edge off a sound or removing an
+//| offset. The sample's format is kept.
+//|
+//| .. class:: OnePole(sample, *, frequency, highpass=False, buffer_size=1024)
+//|
+//|   Create a OnePole that filters the given sample.
+//|
+//|   :param sample: The audio sample to filter, such as a `audioio.WaveFile` or another effect
+//|   :param float frequency: The cutoff frequency in Hertz. It must be below half the sample's
+//|     sample rate.
+//|   :param bool highpass: Pass frequencies above frequency rather than below it
+//|   :param int buffer_size: The total size in bytes of the buffers to filter into
+//|
+STATIC mp_obj_t audioio_onepole_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_frequency, ARG_highpass, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_highpass, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audioio_validate_sample(sample);
+    mp_float_t frequency = mp_obj_get_float(args[ARG_frequency].u_obj);
+    audioio_validate_frequency(sample, frequency);
+
+    audioio_effect_obj_t *self = m_new_obj(audioio_effect_obj_t);
+    self->base.type = &audioio_onepole_type;
+    common_hal_audioio_onepole_construct(self, sample, frequency, args[ARG_highpass].u_bool,
+                                         args[ARG_buffer_size].u_int);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: deinit()
+//|
+//|      Deinitialises the OnePole and releases its buffers for reuse.
+//|
+//|   .. method:: __enter__()
+//|
+//|      No-op used by Context Managers.
+//|
+//|   .. method:: __exit__()
+//|
+//|      Automatically deinitializes the OnePole when exiting a context. See
+//|      :ref:`lifetime-and-contextmanagers` for more info.
+//|
+STATIC const mp_rom_map_elem_t audioio_onepole_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_effect_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_effect___exit___obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_onepole_locals_dict, audioio_onepole_locals_dict_table);
+
+const mp_obj_type_t audioio_onepole_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_OnePole,
+    .make_new = audioio_onepole_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_onepole_locals_dict,
+};
@@ -31,7 +31,7 @@
 #include "py/objproperty.h"
 #include "py/runtime.h"
 #include "shared-bindings/microcontroller/Pin.h"
-#include "shared-bindings/audioio/AudioOut.h"
+#include "shared-bindings/audioio/RawSample.h"
 #include "shared-bindings/util.h"
 #include "supervisor/shared/translate.h"
 
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Resampler.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/audioio/__init__.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audioio
+//|
+//| :class:`Resampler` -- Converts a sample to another sample rate
+//| ===============================================================
+//|
+//| Resampler converts a sample to a new sample rate as it plays so that samples with different
+//| rates can be mixed together or played at the rate of the output. The sample's other settings
+//| are kept.
+//|
+//| .. class:: Resampler(sample, *, sample_rate, quality=Resampler.LINEAR, buffer_size=1024)
+//|
+//|   Create a Resampler that plays the given sample at sample_rate. The sample's rate can be at
+//|   most 8 times sample_rate.
+//|
+//|   :param sample: The audio sample to convert, such as a `audioio.WaveFile` or an effect
+//|   :param int sample_rate: The sample rate to output
+//|   :param int quality: `Resampler.LINEAR` interpolates between neighbouring samples.
+//|     `Resampler.FIR` uses a 16 tap polyphase filter that removes more of the aliasing at the cost
+//|     of more CPU time.
+//|   :param int buffer_size: The total size in bytes of the buffers to resample into. Must be at
+//|     least 8.
+//|
+//|   Mixing a wave file recorded at 22050 Hz with 16000 Hz effects::
+//|
+//|     import board
+//|     import audioio
+//|
+//|     mixer = audioio.Mixer(voice_count=2, sample_rate=16000, channel_count=1,
+//|                           bits_per_sample=16, samples_signed=True)
+//|     a = audioio.AudioOut(board.A0)
+//|     a.play(mixer)
+//|
+//|     music = audioio.WaveFile(open("music-22khz.wav", "rb"))
+//|     mixer.play(audioio.Resampler(music, sample_rate=16000, quality=audioio.Resampler.FIR),
+//|                voice=0, loop=True)
+//|     mixer.play(audioio.WaveFile(open("drum.wav", "rb")), voice=1)
+//|
+STATIC mp_obj_t audioio_resampler_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_sample, ARG_sample_rate, ARG_quality, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_sample, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED },
+        { MP_QSTR_quality, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = AUDIOIO_RESAMPLER_LINEAR} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t sample = args[ARG_sample].u_obj;
+    audioio_validate_sample(sample);
+    mp_int_t sample_rate = args[ARG_sample_rate].u_int;
+    if (sample_rate < 1) {
+        mp_raise_ValueError(translate("Sample rate must be positive"));
+    }
+    mp_int_t quality = args[ARG_quality].u_int;
+    if (quality != AUDIOIO_RESAMPLER_LINEAR && quality != AUDIOIO_RESAMPLER_FIR) {
+        mp_raise_ValueError(translate("Invalid quality"));
+    }
+    // Each of the two buffers has to hold at least one word.
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 8) {
+        mp_raise_ValueError_varg(translate("%q must be >= %d"), MP_QSTR_buffer_size, 8);
+    }
+
+    audioio_resampler_obj_t *self = m_new_obj(audioio_resampler_obj_t);
+    self->base.type = &audioio_resampler_type;
+    common_hal_audioio_resampler_construct(self, sample, sample_rate, quality, buffer_size);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: deinit()
+//|
+//|      Deinitialises the Resampler and releases its buffers for reuse.
+//|
+STATIC mp_obj_t audioio_resampler_deinit(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_resampler_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_deinit_obj, audioio_resampler_deinit);
+
+//|   .. method:: __enter__()
+//|
+//|      No-op used by Context Managers.
+//|
+//  Provided by context manager helper.
+
+//|   .. method:: __exit__()
+//|
+//|      Automatically deinitializes the Resampler when exiting a context. See
+//|      :ref:`lifetime-and-contextmanagers` for more info.
+//|
+STATIC mp_obj_t audioio_resampler_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audioio_resampler_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_resampler___exit___obj, 4, 4, audioio_resampler_obj___exit__);
+
+//|   .. attribute:: sample_rate
+//|
+//|     The sample rate that the sample is converted to, in Hertz. (read-only)
+//|
+STATIC mp_obj_t audioio_resampler_obj_get_sample_rate(mp_obj_t self_in) {
+    audioio_resampler_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_resampler_deinited(self));
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_resampler_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_resampler_get_sample_rate_obj, audioio_resampler_obj_get_sample_rate);
+
+const mp_obj_property_t audioio_resampler_sample_rate_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_resampler_get_sample_rate_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. data:: LINEAR
+//|
+//|     Linear interpolation between samples.
+//|
+//|   .. data:: FIR
+//|
+//|     Polyphase windowed sinc filter.
+//|
+STATIC const mp_rom_map_elem_t audioio_resampler_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_resampler_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_resampler___exit___obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_resampler_sample_rate_obj) },
+
+    // Qualities
+    { MP_ROM_QSTR(MP_QSTR_LINEAR), MP_ROM_INT(AUDIOIO_RESAMPLER_LINEAR) },
+    { MP_ROM_QSTR(MP_QSTR_FIR), MP_ROM_INT(AUDIOIO_RESAMPLER_FIR) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_resampler_locals_dict, audioio_resampler_locals_dict_table);
+
+const mp_obj_type_t audioio_resampler_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Resampler,
+    .make_new = audioio_resampler_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_resampler_locals_dict,
+};
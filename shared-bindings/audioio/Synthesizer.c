@@ -0,0 +1,369 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Synthesizer.h"
+
+#include <stdint.h>
+
+#include "lib/utils/context_manager_helpers.h"
+#include "py/binary.h"
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "shared-bindings/util.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: audioio
+//|
+//| :class:`Synthesizer` -- Plays notes from a wavetable
+//| =====================================================
+//|
+//| Synthesizer generates tones from a single cycle waveform with an attack, decay, sustain and
+//| release envelope on each voice. Samples are rendered as 16 bit mono in C so tones, alarms and
+//| UI sounds need no sample data and no Python work while they play. It can be played directly or
+//| as a voice of a `audioio.Mixer`.
+//|
+//| .. class:: Synthesizer(*, voice_count=4, sample_rate=16000, waveform=None, envelope=None, samples_signed=True, buffer_size=1024)
+//|
+//|   Create a Synthesizer with all voices silent.
+//|
+//|   :param int voice_count: The number of notes that can play at once
+//|   :param int sample_rate: The sample rate of the output
+//|   :param array.array waveform: One cycle of the tone as an array of type ``'h'``. Its length
+//|     must be a power of two from 2 to 65536. It is copied, so later changes to the array aren't
+//|     heard. A sine is used when None.
+//|   :param tuple envelope: ``(attack, decay, sustain, release)``. See `envelope`.
+//|   :param bool samples_signed: Whether the output is signed or unsigned 16 bit
+//|   :param int buffer_size: The total size in bytes of the buffers to render into
+//|
+//|   Playing a chord::
+//|
+//|     import board
+//|     import audioio
+//|     import time
+//|
+//|     synth = audioio.Synthesizer(voice_count=3, sample_rate=16000, samples_signed=False)
+//|     a = audioio.AudioOut(board.A0)
+//|     a.play(synth)
+//|     for voice, frequency in enumerate((261.63, 329.63, 392.0)):
+//|         synth.note_on(frequency, voice=voice, level=0.3)
+//|     time.sleep(1)
+//|     for voice in range(3):
+//|         synth.note_off(voice)
+//|     while synth.playing:
+//|         pass
+//|
+STATIC void get_waveform(mp_obj_t waveform_obj, const int16_t** waveform, uint32_t* length) {
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(waveform_obj, &bufinfo, MP_BUFFER_READ);
+    if (bufinfo.typecode != 'h') {
+        mp_raise_ValueError(translate("waveform must be an array of type 'h'"));
+    }
+    uint32_t count = bufinfo.len / sizeof(int16_t);
+    if (count < 2 || count > 65536 || (count & (count - 1)) != 0) {
+        mp_raise_ValueError(translate("waveform length must be a power of two"));
+    }
+    *waveform = bufinfo.buf;
+    *length = count;
+}
+
+STATIC void set_envelope(audioio_synthesizer_obj_t *self, mp_obj_t envelope_obj) {
+    mp_obj_t *items;
+    mp_obj_get_array_fixed_n(envelope_obj, 4, &items);
+    mp_float_t attack = mp_obj_get_float(items[0]);
+    mp_float_t decay = mp_obj_get_float(items[1]);
+    mp_float_t sustain = mp_obj_get_float(items[2]);
+    mp_float_t release = mp_obj_get_float(items[3]);
+    if (attack < 0 || decay < 0 || release < 0 || sustain < 0 || sustain > 1) {
+        mp_raise_ValueError(translate("Invalid envelope"));
+    }
+    common_hal_audioio_synthesizer_set_envelope(self, attack, decay, sustain, release);
+}
+
+STATIC mp_obj_t audioio_synthesizer_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_voice_count, ARG_sample_rate, ARG_waveform, ARG_envelope, ARG_samples_signed, ARG_buffer_size };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_voice_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 4} },
+        { MP_QSTR_sample_rate, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 16000} },
+        { MP_QSTR_waveform, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_envelope, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+        { MP_QSTR_samples_signed, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = true} },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1024} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t voice_count = args[ARG_voice_count].u_int;
+    if (voice_count < 1 || voice_count > 255) {
+        mp_raise_ValueError(translate("Invalid voice count"));
+    }
+    mp_int_t sample_rate = args[ARG_sample_rate].u_int;
+    if (sample_rate < 1) {
+        mp_raise_ValueError(translate("Sample rate must be positive"));
+    }
+    const int16_t* waveform = NULL;
+    uint32_t waveform_length = 0;
+    mp_obj_t waveform_obj = args[ARG_waveform].u_obj;
+    if (waveform_obj != mp_const_none) {
+        get_waveform(waveform_obj, &waveform, &waveform_length);
+    }
+
+    audioio_synthesizer_obj_t *self = m_new_obj_var(audioio_synthesizer_obj_t, audioio_synthesizer_voice_t, voice_count);
+    self->base.type = &audioio_synthesizer_type;
+    common_hal_audioio_synthesizer_construct(self, voice_count, sample_rate,
+                                             args[ARG_samples_signed].u_bool,
+                                             args[ARG_buffer_size].u_int);
+    if (waveform != NULL) {
+        common_hal_audioio_synthesizer_set_waveform(self, waveform_obj, waveform, waveform_length);
+    }
+    if (args[ARG_envelope].u_obj != mp_const_none) {
+        set_envelope(self, args[ARG_envelope].u_obj);
+    }
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. method:: deinit()
+//|
+//|      Deinitialises the Synthesizer and releases any hardware resources for reuse.
+//|
+STATIC mp_obj_t audioio_synthesizer_deinit(mp_obj_t self_in) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_audioio_synthesizer_deinit(self);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(audioio_synthesizer_deinit_obj, audioio_synthesizer_deinit);
+
+//|   .. method:: __enter__()
+//|
+//|      No-op used by Context Managers.
+//|
+//  Provided by context manager helper.
+
+//|   .. method:: __exit__()
+//|
+//|      Automatically deinitializes the hardware when exiting a context. See
+//|      :ref:`lifetime-and-contextmanagers` for more info.
+//|
+STATIC mp_obj_t audioio_synthesizer_obj___exit__(size_t n_args, const mp_obj_t *args) {
+    (void)n_args;
+    common_hal_audioio_synthesizer_deinit(args[0]);
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(audioio_synthesizer___exit___obj, 4, 4, audioio_synthesizer_obj___exit__);
+
+STATIC uint8_t get_voice(audioio_synthesizer_obj_t *self, mp_int_t voice) {
+    if (voice < 0 || voice >= self->voice_count) {
+        mp_raise_ValueError(translate("Voice index too high"));
+    }
+    return voice;
+}
+
+//|   .. method:: note_on(frequency, *, voice=0, level=1.0)
+//|
+//|     Starts a note on the given voice at its attack. A voice that is still sounding ramps from
+//|     its current level so it doesn't click.
+//|
+//|     :param float frequency: Pitch of the note in Hertz, below half the sample rate
+//|     :param float level: Peak volume of the note from 0.0 (silent) to 1.0 (full scale). The
+//|       output saturates when the voices add up to more than 1.0.
+//|
+STATIC mp_obj_t audioio_synthesizer_obj_note_on(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_frequency, ARG_voice, ARG_level };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_frequency, MP_ARG_OBJ | MP_ARG_REQUIRED },
+        { MP_QSTR_voice,     MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
+        { MP_QSTR_level,     MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
+    };
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_float_t frequency = mp_obj_get_float(args[ARG_frequency].u_obj);
+    if (frequency <= 0 || frequency >= common_hal_audioio_synthesizer_get_sample_rate(self) / 2) {
+        mp_raise_ValueError(translate("frequency must be below half the sample rate"));
+    }
+    mp_float_t level = 1.0;
+    if (args[ARG_level].u_obj != mp_const_none) {
+        level = mp_obj_get_float(args[ARG_level].u_obj);
+        if (level < 0 || level > 1) {
+            mp_raise_ValueError(translate("level must be between 0 and 1"));
+        }
+    }
+    common_hal_audioio_synthesizer_note_on(self, get_voice(self, args[ARG_voice].u_int), frequency,
+                                           level);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audioio_synthesizer_note_on_obj, 2, audioio_synthesizer_obj_note_on);
+
+//|   .. method:: note_off(voice=0)
+//|
+//|     Releases the note on the given voice. It fades out over the envelope's release time.
+//|
+STATIC mp_obj_t audioio_synthesizer_obj_note_off(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_voice };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_voice, MP_ARG_INT, {.u_int = 0} },
+    };
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    common_hal_audioio_synthesizer_note_off(self, get_voice(self, args[ARG_voice].u_int));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(audioio_synthesizer_note_off_obj, 1, audioio_synthesizer_obj_note_off);
+
+//|   .. attribute:: waveform
+//|
+//|     One cycle of the tone as an array of type ``'h'`` with a power of two length, or None for
+//|     a sine. Setting it changes notes that are already playing. The array is copied when set,
+//|     so change it in place and set it again to hear the change.
+//|
+STATIC mp_obj_t audioio_synthesizer_obj_get_waveform(mp_obj_t self_in) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    return common_hal_audioio_synthesizer_get_waveform(self);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_synthesizer_get_waveform_obj, audioio_synthesizer_obj_get_waveform);
+
+STATIC mp_obj_t audioio_synthesizer_obj_set_waveform(mp_obj_t self_in, mp_obj_t waveform_obj) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    const int16_t* waveform = NULL;
+    uint32_t length = 0;
+    if (waveform_obj != mp_const_none) {
+        get_waveform(waveform_obj, &waveform, &length);
+    }
+    common_hal_audioio_synthesizer_set_waveform(self, waveform_obj, waveform, length);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_synthesizer_set_waveform_obj, audioio_synthesizer_obj_set_waveform);
+
+const mp_obj_property_t audioio_synthesizer_waveform_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_synthesizer_get_waveform_obj,
+              (mp_obj_t)&audioio_synthesizer_set_waveform_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: envelope
+//|
+//|     ``(attack, decay, sustain, release)`` used by notes started after it is set. The attack,
+//|     decay and release are in seconds. A note rises to its level over the attack, falls to
+//|     sustain times its level over the decay and holds until `note_off`. It then fades out over
+//|     the release. A sustain of 0 ends notes after their decay. Defaults to
+//|     ``(0.01, 0.1, 0.8, 0.1)``.
+//|
+STATIC mp_obj_t audioio_synthesizer_obj_get_envelope(mp_obj_t self_in) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    mp_float_t attack, decay, sustain, release;
+    common_hal_audioio_synthesizer_get_envelope(self, &attack, &decay, &sustain, &release);
+    mp_obj_t items[4] = {
+        mp_obj_new_float(attack),
+        mp_obj_new_float(decay),
+        mp_obj_new_float(sustain),
+        mp_obj_new_float(release),
+    };
+    return mp_obj_new_tuple(4, items);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_synthesizer_get_envelope_obj, audioio_synthesizer_obj_get_envelope);
+
+STATIC mp_obj_t audioio_synthesizer_obj_set_envelope(mp_obj_t self_in, mp_obj_t envelope_obj) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    set_envelope(self, envelope_obj);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(audioio_synthesizer_set_envelope_obj, audioio_synthesizer_obj_set_envelope);
+
+const mp_obj_property_t audioio_synthesizer_envelope_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_synthesizer_get_envelope_obj,
+              (mp_obj_t)&audioio_synthesizer_set_envelope_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: playing
+//|
+//|     True when any voice is sounding, including notes that are being released. (read-only)
+//|
+STATIC mp_obj_t audioio_synthesizer_obj_get_playing(mp_obj_t self_in) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    return mp_obj_new_bool(common_hal_audioio_synthesizer_get_playing(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_synthesizer_get_playing_obj, audioio_synthesizer_obj_get_playing);
+
+const mp_obj_property_t audioio_synthesizer_playing_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_synthesizer_get_playing_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: sample_rate
+//|
+//|     32 bit value that dictates how quickly samples are played in Hertz (cycles per second).
+//|
+STATIC mp_obj_t audioio_synthesizer_obj_get_sample_rate(mp_obj_t self_in) {
+    audioio_synthesizer_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_synthesizer_deinited(self));
+    return MP_OBJ_NEW_SMALL_INT(common_hal_audioio_synthesizer_get_sample_rate(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_synthesizer_get_sample_rate_obj, audioio_synthesizer_obj_get_sample_rate);
+
+const mp_obj_property_t audioio_synthesizer_sample_rate_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_synthesizer_get_sample_rate_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+STATIC const mp_rom_map_elem_t audioio_synthesizer_locals_dict_table[] = {
+    // Methods
+    { MP_ROM_QSTR(MP_QSTR_deinit), MP_ROM_PTR(&audioio_synthesizer_deinit_obj) },
+    { MP_ROM_QSTR(MP_QSTR___enter__), MP_ROM_PTR(&default___enter___obj) },
+    { MP_ROM_QSTR(MP_QSTR___exit__), MP_ROM_PTR(&audioio_synthesizer___exit___obj) },
+    { MP_ROM_QSTR(MP_QSTR_note_on), MP_ROM_PTR(&audioio_synthesizer_note_on_obj) },
+    { MP_ROM_QSTR(MP_QSTR_note_off), MP_ROM_PTR(&audioio_synthesizer_note_off_obj) },
+
+    // Properties
+    { MP_ROM_QSTR(MP_QSTR_waveform), MP_ROM_PTR(&audioio_synthesizer_waveform_obj) },
+    { MP_ROM_QSTR(MP_QSTR_envelope), MP_ROM_PTR(&audioio_synthesizer_envelope_obj) },
+    { MP_ROM_QSTR(MP_QSTR_playing), MP_ROM_PTR(&audioio_synthesizer_playing_obj) },
+    { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_synthesizer_sample_rate_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(audioio_synthesizer_locals_dict, audioio_synthesizer_locals_dict_table);
+
+const mp_obj_type_t audioio_synthesizer_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Synthesizer,
+    .make_new = audioio_synthesizer_make_new,
+    .locals_dict = (mp_obj_dict_t*)&audioio_synthesizer_locals_dict,
+};
@@ -39,13 +39,23 @@
 //| ========================================================
 //|
 //| A .wav file prepped for audio playback. Only mono and stereo files are supported. Samples must
-//| be 8 bit unsigned or 16 bit signed.
+//| be 8 bit unsigned or 16 bit signed PCM, 8 bit A-law or mu-law, or 4 bit IMA ADPCM. Compressed
+//| samples are decoded to 16 bit signed as they play. IMA ADPCM files are a quarter of the size
+//| of 16 bit PCM and are a good fit for long sounds on small flash chips.
 //|
-//| .. class:: WaveFile(file)
+//| .. class:: WaveFile(file, *, buffer_size=1536, buffer_count=3)
 //|
 //|   Load a .wav file for playback with `audioio.AudioOut` or `audiobusio.I2SOut`.
 //|
+//|   The file is read into a ring of ``buffer_count`` buffers. The output plays one and has the
+//|   next queued while the rest are loaded ahead from background tasks, so a slow read from flash
+//|   doesn't starve the output. Use more buffers if `underruns` climbs during playback. Buffers of
+//|   512 bytes or more let contiguous files be read a sector at a time without extra copies.
+//|
 //|   :param typing.BinaryIO file: Already opened wave file
+//|   :param int buffer_size: The total size in bytes of the buffers to load the file into. Each
+//|     buffer holds from 16 to 65535 bytes, the most that one DMA transfer can play.
+//|   :param int buffer_count: The number of buffers, from 2 to 8. Two buffers means no read ahead.
 //|
 //|   Playing a wave file from flash::
 //|
@@ -67,16 +77,33 @@
 //|       pass
 //|     print("stopped")
 //|
-STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 1, 1, false);
+STATIC mp_obj_t audioio_wavefile_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_file, ARG_buffer_size, ARG_buffer_count };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_file, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_buffer_size, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 1536} },
+        { MP_QSTR_buffer_count, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 3} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_obj_t file = args[ARG_file].u_obj;
+    if (!MP_OBJ_IS_TYPE(file, &mp_type_vfs_fat_fileio)) {
+        mp_raise_TypeError(translate("file must be a file opened in byte mode"));
+    }
+    mp_int_t buffer_count = args[ARG_buffer_count].u_int;
+    if (buffer_count < 2 || buffer_count > AUDIOIO_WAVEFILE_MAX_BUFFERS) {
+        mp_raise_ValueError(translate("buffer_count must be between 2 and 8"));
+    }
+    mp_int_t buffer_size = args[ARG_buffer_size].u_int;
+    if (buffer_size < 16 * buffer_count || buffer_size / buffer_count > 0xffff) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_buffer_size,
+                                 16 * buffer_count, 0xffff * buffer_count);
+    }
 
     audioio_wavefile_obj_t *self = m_new_obj(audioio_wavefile_obj_t);
     self->base.type = &audioio_wavefile_type;
-    if (MP_OBJ_IS_TYPE(args[0], &mp_type_fileio)) {
-        common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(args[0]));
-    } else {
-        mp_raise_TypeError(translate("file must be a file opened in byte mode"));
-    }
+    common_hal_audioio_wavefile_construct(self, MP_OBJ_TO_PTR(file), buffer_size, buffer_count);
 
     return MP_OBJ_FROM_PTR(self);
 }
@@ -174,6 +201,25 @@ const mp_obj_property_t audioio_wavefile_channel_count_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|   .. attribute:: underruns
+//|
+//|     Number of buffers that weren't loaded ahead and had to be read from the file when the
+//|     output asked for them. The first buffer after playback starts or loops is always read this
+//|     way and isn't counted. (read only)
+//|
+STATIC mp_obj_t audioio_wavefile_obj_get_underruns(mp_obj_t self_in) {
+    audioio_wavefile_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    raise_error_if_deinited(common_hal_audioio_wavefile_deinited(self));
+    return mp_obj_new_int_from_uint(common_hal_audioio_wavefile_get_underruns(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(audioio_wavefile_get_underruns_obj, audioio_wavefile_obj_get_underruns);
+
+const mp_obj_property_t audioio_wavefile_underruns_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&audioio_wavefile_get_underruns_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
 
 STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     // Methods
@@ -185,6 +231,7 @@ STATIC const mp_rom_map_elem_t audioio_wavefile_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_sample_rate), MP_ROM_PTR(&audioio_wavefile_sample_rate_obj) },
     { MP_ROM_QSTR(MP_QSTR_bits_per_sample), MP_ROM_PTR(&audioio_wavefile_bits_per_sample_obj) },
     { MP_ROM_QSTR(MP_QSTR_channel_count), MP_ROM_PTR(&audioio_wavefile_channel_count_obj) },
+    { MP_ROM_QSTR(MP_QSTR_underruns), MP_ROM_PTR(&audioio_wavefile_underruns_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(audioio_wavefile_locals_dict, audioio_wavefile_locals_dict_table);
 
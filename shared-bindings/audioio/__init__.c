@@ -31,10 +31,23 @@
 
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/audioio/__init__.h"
+#if CIRCUITPY_AUDIOIO_AUDIOOUT
 #include "shared-bindings/audioio/AudioOut.h"
+#endif
+#include "shared-bindings/audioio/Biquad.h"
+#include "shared-bindings/audioio/Echo.h"
+#include "shared-bindings/audioio/Limiter.h"
 #include "shared-bindings/audioio/Mixer.h"
+#if CIRCUITPY_AUDIOIO_NULLSINK
+#include "shared-bindings/audioio/NullSink.h"
+#endif
+#include "shared-bindings/audioio/OnePole.h"
 #include "shared-bindings/audioio/RawSample.h"
+#include "shared-bindings/audioio/Resampler.h"
+#include "shared-bindings/audioio/Synthesizer.h"
 #include "shared-bindings/audioio/WaveFile.h"
+#include "shared-module/audioio/__init__.h"
+#include "supervisor/shared/translate.h"
 
 //| :mod:`audioio` --- Support for audio input and output
 //| ======================================================
@@ -51,8 +64,15 @@
 //|     :maxdepth: 3
 //|
 //|     AudioOut
+//|     Biquad
+//|     Echo
+//|     Limiter
 //|     Mixer
+//|     NullSink
+//|     OnePole
 //|     RawSample
+//|     Resampler
+//|     Synthesizer
 //|     WaveFile
 //|
 //| All classes change hardware state and should be deinitialized when they
@@ -60,12 +80,49 @@
 //| call :py:meth:`!deinit` or use a context manager. See
 //| :ref:`lifetime-and-contextmanagers` for more info.
 //|
+//| `Biquad`, `OnePole`, `Echo` and `Limiter` are effects. Each one wraps another sample, including
+//| another effect, and processes it as it plays so they can be chained::
+//|
+//|   music = audioio.WaveFile(open("music.wav", "rb"))
+//|   chain = audioio.Limiter(audioio.Echo(audioio.Biquad(music, frequency=3000), delay=0.25))
+//|
+
+void audioio_validate_sample(mp_obj_t sample) {
+    if (!MP_OBJ_IS_TYPE(sample, &audioio_rawsample_type) &&
+        !MP_OBJ_IS_TYPE(sample, &audioio_wavefile_type) &&
+        !MP_OBJ_IS_TYPE(sample, &audioio_mixer_type) &&
+        !MP_OBJ_IS_TYPE(sample, &audioio_resampler_type) &&
+        !MP_OBJ_IS_TYPE(sample, &audioio_synthesizer_type) &&
+        !audioio_effect_is_effect(sample)) {
+        mp_raise_TypeError(translate("sample must be an audio sample"));
+    }
+}
+
+void audioio_validate_frequency(mp_obj_t sample, mp_float_t frequency) {
+    if (frequency <= 0) {
+        mp_raise_ValueError(translate("frequency must be positive"));
+    }
+    if (frequency * 2 >= audiosample_sample_rate(sample)) {
+        mp_raise_ValueError(translate("frequency must be below half the sample rate"));
+    }
+}
 
 STATIC const mp_rom_map_elem_t audioio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_audioio) },
+    #if CIRCUITPY_AUDIOIO_AUDIOOUT
     { MP_ROM_QSTR(MP_QSTR_AudioOut), MP_ROM_PTR(&audioio_audioout_type) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_Biquad), MP_ROM_PTR(&audioio_biquad_type) },
+    { MP_ROM_QSTR(MP_QSTR_Echo), MP_ROM_PTR(&audioio_echo_type) },
+    { MP_ROM_QSTR(MP_QSTR_Limiter), MP_ROM_PTR(&audioio_limiter_type) },
     { MP_ROM_QSTR(MP_QSTR_Mixer), MP_ROM_PTR(&audioio_mixer_type) },
+    #if CIRCUITPY_AUDIOIO_NULLSINK
+    { MP_ROM_QSTR(MP_QSTR_NullSink), MP_ROM_PTR(&audioio_nullsink_type) },
+    #endif
+    { MP_ROM_QSTR(MP_QSTR_OnePole), MP_ROM_PTR(&audioio_onepole_type) },
     { MP_ROM_QSTR(MP_QSTR_RawSample), MP_ROM_PTR(&audioio_rawsample_type) },
+    { MP_ROM_QSTR(MP_QSTR_Resampler), MP_ROM_PTR(&audioio_resampler_type) },
+    { MP_ROM_QSTR(MP_QSTR_Synthesizer), MP_ROM_PTR(&audioio_synthesizer_type) },
     { MP_ROM_QSTR(MP_QSTR_WaveFile), MP_ROM_PTR(&audioio_wavefile_type) },
 };
 
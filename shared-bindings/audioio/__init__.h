@@ -29,6 +29,9 @@
 
 #include "py/obj.h"
 
-// Nothing now.
+// Raises TypeError unless sample is one of the audio sample types.
+void audioio_validate_sample(mp_obj_t sample);
+// Raises ValueError unless frequency is positive and below half of the sample's sample rate.
+void audioio_validate_frequency(mp_obj_t sample, mp_float_t frequency);
 
 #endif  // MICROPY_INCLUDED_SHARED_BINDINGS_AUDIOIO___INIT___H
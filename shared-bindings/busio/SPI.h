@@ -52,6 +52,13 @@ extern void common_hal_busio_spi_unlock(busio_spi_obj_t *self);
 // Writes out the given data.
 extern bool common_hal_busio_spi_write(busio_spi_obj_t *self, const uint8_t *data, size_t len);
 
+// Starts writing and returns without waiting when the port can do so. data must stay valid until
+// common_hal_busio_spi_write_done returns true.
+extern bool common_hal_busio_spi_start_write(busio_spi_obj_t *self, const uint8_t *data, size_t len);
+
+// Returns true once the write started by common_hal_busio_spi_start_write has finished.
+extern bool common_hal_busio_spi_write_done(busio_spi_obj_t *self);
+
 // Reads in len bytes while outputting zeroes.
 extern bool common_hal_busio_spi_read(busio_spi_obj_t *self, uint8_t *data, size_t len, uint8_t write_value);
 
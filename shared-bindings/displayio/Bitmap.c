@@ -178,9 +178,143 @@ STATIC mp_obj_t bitmap_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t val
     return mp_const_none;
 }
 
+STATIC void check_value(displayio_bitmap_t *self, mp_int_t value) {
+    uint32_t bits = common_hal_displayio_bitmap_get_bits_per_value(self);
+    if (value < 0 || (bits < 32 && value >= 1 << bits)) {
+        mp_raise_ValueError(translate("pixel value requires too many bits"));
+    }
+}
+
+//|   .. method:: fill(value)
+//|
+//|     Sets every value in the bitmap to the given value.
+//|
+STATIC mp_obj_t displayio_bitmap_obj_fill(mp_obj_t self_in, mp_obj_t value_obj) {
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_int_t value = mp_obj_get_int(value_obj);
+    check_value(self, value);
+    common_hal_displayio_bitmap_fill(self, value);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_bitmap_fill_obj, displayio_bitmap_obj_fill);
+
+// Coordinates beyond int16_t would wrap around while blit clips them.
+STATIC int16_t blit_coordinate(mp_int_t value, qstr name) {
+    if (value < INT16_MIN || value > INT16_MAX) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), name, INT16_MIN, INT16_MAX);
+    }
+    return value;
+}
+
+//|   .. method:: blit(x, y, source_bitmap, *, x1=0, y1=0, x2=None, y2=None, skip_index=None)
+//|
+//|     Copies the area of ``source_bitmap`` from ``x1``, ``y1`` up to but not including ``x2``,
+//|     ``y2`` into this bitmap with its top left corner at ``x``, ``y``. The copy is clipped to
+//|     both bitmaps. ``source_bitmap`` may be this bitmap. Coordinates must be between -32768 and
+//|     32767.
+//|
+//|     :param int x: Horizontal position to copy to
+//|     :param int y: Vertical position to copy to
+//|     :param Bitmap source_bitmap: Bitmap to copy from
+//|     :param int x1: Left edge of the area to copy
+//|     :param int y1: Top edge of the area to copy
+//|     :param int x2: Right edge of the area to copy. Defaults to the source width.
+//|     :param int y2: Bottom edge of the area to copy. Defaults to the source height.
+//|     :param int skip_index: Source value that is not copied so this bitmap shows through
+//|
+STATIC mp_obj_t displayio_bitmap_obj_blit(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x, ARG_y, ARG_source_bitmap, ARG_x1, ARG_y1, ARG_x2, ARG_y2, ARG_skip_index };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_source_bitmap, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_x1, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_y1, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+        { MP_QSTR_x2, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_y2, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+        { MP_QSTR_skip_index, MP_ARG_KW_ONLY | MP_ARG_OBJ, {.u_obj = mp_const_none} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    mp_obj_t source_obj = args[ARG_source_bitmap].u_obj;
+    if (!MP_OBJ_IS_TYPE(source_obj, &displayio_bitmap_type)) {
+        mp_raise_TypeError(translate("source_bitmap must be a Bitmap"));
+    }
+    displayio_bitmap_t *source = MP_OBJ_TO_PTR(source_obj);
+
+    int16_t x = blit_coordinate(args[ARG_x].u_int, MP_QSTR_x);
+    int16_t y = blit_coordinate(args[ARG_y].u_int, MP_QSTR_y);
+    int16_t x1 = blit_coordinate(args[ARG_x1].u_int, MP_QSTR_x1);
+    int16_t y1 = blit_coordinate(args[ARG_y1].u_int, MP_QSTR_y1);
+    int16_t x2 = MIN(common_hal_displayio_bitmap_get_width(source), INT16_MAX);
+    if (args[ARG_x2].u_obj != mp_const_none) {
+        x2 = blit_coordinate(mp_obj_get_int(args[ARG_x2].u_obj), MP_QSTR_x2);
+    }
+    int16_t y2 = MIN(common_hal_displayio_bitmap_get_height(source), INT16_MAX);
+    if (args[ARG_y2].u_obj != mp_const_none) {
+        y2 = blit_coordinate(mp_obj_get_int(args[ARG_y2].u_obj), MP_QSTR_y2);
+    }
+    bool skip = args[ARG_skip_index].u_obj != mp_const_none;
+    uint32_t skip_index = 0;
+    if (skip) {
+        skip_index = mp_obj_get_int(args[ARG_skip_index].u_obj);
+    }
+
+    common_hal_displayio_bitmap_blit(self, x, y, source, x1, y1, x2, y2, skip, skip_index);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_bitmap_blit_obj, 4, displayio_bitmap_obj_blit);
+
+//|   .. method:: from_buffer(buffer, *, y=0)
+//|
+//|     Copies whole rows of values out of ``buffer`` starting at row ``y``. Each row starts on a
+//|     byte boundary. Values smaller than a byte are packed most significant bits first and larger
+//|     values are little endian, the same as uncompressed BMP pixel data without the row padding.
+//|
+//|     :param bytes buffer: Buffer holding one or more rows of values
+//|     :param int y: First row to copy into
+//|
+STATIC mp_obj_t displayio_bitmap_obj_from_buffer(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_buffer, ARG_y };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_buffer, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_y, MP_ARG_KW_ONLY | MP_ARG_INT, {.u_int = 0} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    displayio_bitmap_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(args[ARG_buffer].u_obj, &bufinfo, MP_BUFFER_READ);
+
+    uint32_t row_bytes = (common_hal_displayio_bitmap_get_width(self) *
+        common_hal_displayio_bitmap_get_bits_per_value(self) + 7) / 8;
+    mp_int_t y = args[ARG_y].u_int;
+    if (row_bytes == 0 || bufinfo.len % row_bytes != 0) {
+        mp_raise_ValueError(translate("Buffer must be a whole number of rows"));
+    }
+    uint32_t rows = bufinfo.len / row_bytes;
+    if (y < 0 || y + rows > common_hal_displayio_bitmap_get_height(self)) {
+        mp_raise_ValueError(translate("pixel coordinates out of bounds"));
+    }
+
+    uint8_t* data = bufinfo.buf;
+    for (uint32_t i = 0; i < rows; i++) {
+        common_hal_displayio_bitmap_load_row(self, y + i, data + i * row_bytes, row_bytes);
+    }
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_bitmap_from_buffer_obj, 2, displayio_bitmap_obj_from_buffer);
+
 STATIC const mp_rom_map_elem_t displayio_bitmap_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_bitmap_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_bitmap_width_obj) },
+    { MP_ROM_QSTR(MP_QSTR_fill), MP_ROM_PTR(&displayio_bitmap_fill_obj) },
+    { MP_ROM_QSTR(MP_QSTR_blit), MP_ROM_PTR(&displayio_bitmap_blit_obj) },
+    { MP_ROM_QSTR(MP_QSTR_from_buffer), MP_ROM_PTR(&displayio_bitmap_from_buffer_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_bitmap_locals_dict, displayio_bitmap_locals_dict_table);
 
@@ -34,8 +34,17 @@ extern const mp_obj_type_t displayio_bitmap_type;
 void common_hal_displayio_bitmap_construct(displayio_bitmap_t *self, uint32_t width,
     uint32_t height, uint32_t bits_per_value);
 
+// Copies one row of values packed like they are in a file: most significant bits first for sub-byte
+// values and little endian for larger ones. len must be the number of bytes in the row.
 void common_hal_displayio_bitmap_load_row(displayio_bitmap_t *self, uint16_t y, uint8_t* data,
                                           uint16_t len);
+void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value);
+// Copies the area x1, y1 to x2, y2 (exclusive) of source to x, y. Source values equal to skip_value
+// aren't copied when skip is true. Coordinates may be anywhere in the int16_t range and are clipped
+// to both bitmaps.
+void common_hal_displayio_bitmap_blit(displayio_bitmap_t *self, int32_t x, int32_t y,
+    displayio_bitmap_t *source, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+    bool skip, uint32_t skip_value);
 uint16_t common_hal_displayio_bitmap_get_height(displayio_bitmap_t *self);
 uint16_t common_hal_displayio_bitmap_get_width(displayio_bitmap_t *self);
 uint32_t common_hal_displayio_bitmap_get_bits_per_value(displayio_bitmap_t *self);
@@ -43,25 +43,36 @@
 //|
 //| Converts one color format to another.
 //|
-//| .. class:: ColorConverter()
+//| .. class:: ColorConverter(*, input_colorspace=Colorspace.RGB888, dither=False)
 //|
-//|   Create a ColorConverter object to convert color formats. Only supports RGB888 to RGB565
-//|   currently.
+//|   Create a ColorConverter object to convert colors in the given `Colorspace` to the RGB565
+//|   that displays use.
 //|
-// TODO(tannewt): Add support for other color formats.
+//|   :param Colorspace input_colorspace: The format of the colors to convert
+//|   :param bool dither: Adds an ordered dither to hide the banding of smooth gradients
 //|
 STATIC mp_obj_t displayio_colorconverter_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    mp_arg_check_num(n_args, kw_args, 0, 0, false);
+    enum { ARG_input_colorspace, ARG_dither };
+
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_input_colorspace, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_rom_obj = &displayio_colorspace_rgb888_obj} },
+        { MP_QSTR_dither, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
 
     displayio_colorconverter_t *self = m_new_obj(displayio_colorconverter_t);
     self->base.type = &displayio_colorconverter_type;
-    common_hal_displayio_colorconverter_construct(self);
+    common_hal_displayio_colorconverter_construct(self,
+        displayio_colorspace_from_obj(args[ARG_input_colorspace].u_obj), args[ARG_dither].u_bool);
 
     return MP_OBJ_FROM_PTR(self);
 }
 
 //|   .. method:: convert(color)
 //|
+//|     Converts the given color to RGB565.
+//|
 STATIC mp_obj_t displayio_colorconverter_obj_convert(mp_obj_t self_in, mp_obj_t color_obj) {
     displayio_colorconverter_t *self = MP_OBJ_TO_PTR(self_in);
 
@@ -75,8 +86,52 @@ STATIC mp_obj_t displayio_colorconverter_obj_convert(mp_obj_t self_in, mp_obj_t
 }
 MP_DEFINE_CONST_FUN_OBJ_2(displayio_colorconverter_convert_obj, displayio_colorconverter_obj_convert);
 
+//|   .. attribute:: input_colorspace
+//|
+//|     The `Colorspace` of the colors being converted. (read only)
+//|
+STATIC mp_obj_t displayio_colorconverter_obj_get_input_colorspace(mp_obj_t self_in) {
+    displayio_colorconverter_t *self = MP_OBJ_TO_PTR(self_in);
+    return displayio_colorspace_to_obj(common_hal_displayio_colorconverter_get_input_colorspace(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_colorconverter_get_input_colorspace_obj, displayio_colorconverter_obj_get_input_colorspace);
+
+const mp_obj_property_t displayio_colorconverter_input_colorspace_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_colorconverter_get_input_colorspace_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: dither
+//|
+//|     When true the color converter dithers the output by adding an ordered pattern of noise to
+//|     each color before reducing it to RGB565.
+//|
+STATIC mp_obj_t displayio_colorconverter_obj_get_dither(mp_obj_t self_in) {
+    displayio_colorconverter_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_bool(common_hal_displayio_colorconverter_get_dither(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_colorconverter_get_dither_obj, displayio_colorconverter_obj_get_dither);
+
+STATIC mp_obj_t displayio_colorconverter_obj_set_dither(mp_obj_t self_in, mp_obj_t dither) {
+    displayio_colorconverter_t *self = MP_OBJ_TO_PTR(self_in);
+    common_hal_displayio_colorconverter_set_dither(self, mp_obj_is_true(dither));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_colorconverter_set_dither_obj, displayio_colorconverter_obj_set_dither);
+
+const mp_obj_property_t displayio_colorconverter_dither_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_colorconverter_get_dither_obj,
+              (mp_obj_t)&displayio_colorconverter_set_dither_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 STATIC const mp_rom_map_elem_t displayio_colorconverter_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_convert), MP_ROM_PTR(&displayio_colorconverter_convert_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dither), MP_ROM_PTR(&displayio_colorconverter_dither_obj) },
+    { MP_ROM_QSTR(MP_QSTR_input_colorspace), MP_ROM_PTR(&displayio_colorconverter_input_colorspace_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_colorconverter_locals_dict, displayio_colorconverter_locals_dict_table);
 
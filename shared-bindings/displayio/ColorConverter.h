@@ -31,7 +31,12 @@
 
 extern const mp_obj_type_t displayio_colorconverter_type;
 
-void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t* self);
+void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t* self,
+    displayio_colorspace_t input_colorspace, bool dither);
 bool common_hal_displayio_colorconverter_convert(displayio_colorconverter_t *colorconverter, uint32_t input_color, uint16_t* output_color);
 
+displayio_colorspace_t common_hal_displayio_colorconverter_get_input_colorspace(displayio_colorconverter_t* self);
+bool common_hal_displayio_colorconverter_get_dither(displayio_colorconverter_t* self);
+void common_hal_displayio_colorconverter_set_dither(displayio_colorconverter_t* self, bool dither);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_COLORCONVERTER_H
@@ -0,0 +1,125 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/Colorspace.h"
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: displayio
+//|
+//| :class:`Colorspace` -- defines the format of a color value
+//| ===========================================================
+//|
+//| .. class:: displayio.Colorspace
+//|
+//|     Enum-like class to define the format of the colors given to a `ColorConverter`.
+//|
+//|     .. data:: RGB888
+//|
+//|       8 bits each of red, green and blue as 0xRRGGBB
+//|
+//|     .. data:: RGB565
+//|
+//|       5 bits of red, 6 bits of green and 5 bits of blue
+//|
+//|     .. data:: RGB555
+//|
+//|       5 bits each of red, green and blue
+//|
+//|     .. data:: L8
+//|
+//|       8 bit grayscale
+//|
+const displayio_colorspace_obj_t displayio_colorspace_rgb888_obj = {
+    { &displayio_colorspace_type },
+};
+
+const displayio_colorspace_obj_t displayio_colorspace_rgb565_obj = {
+    { &displayio_colorspace_type },
+};
+
+const displayio_colorspace_obj_t displayio_colorspace_rgb555_obj = {
+    { &displayio_colorspace_type },
+};
+
+const displayio_colorspace_obj_t displayio_colorspace_l8_obj = {
+    { &displayio_colorspace_type },
+};
+
+displayio_colorspace_t displayio_colorspace_from_obj(mp_obj_t obj) {
+    if (obj == MP_ROM_PTR(&displayio_colorspace_rgb888_obj)) {
+        return DISPLAYIO_COLORSPACE_RGB888;
+    } else if (obj == MP_ROM_PTR(&displayio_colorspace_rgb565_obj)) {
+        return DISPLAYIO_COLORSPACE_RGB565;
+    } else if (obj == MP_ROM_PTR(&displayio_colorspace_rgb555_obj)) {
+        return DISPLAYIO_COLORSPACE_RGB555;
+    } else if (obj == MP_ROM_PTR(&displayio_colorspace_l8_obj)) {
+        return DISPLAYIO_COLORSPACE_L8;
+    }
+    mp_raise_TypeError(translate("input_colorspace must be a Colorspace"));
+}
+
+mp_obj_t displayio_colorspace_to_obj(displayio_colorspace_t colorspace) {
+    switch (colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+            return (mp_obj_t) MP_ROM_PTR(&displayio_colorspace_rgb565_obj);
+        case DISPLAYIO_COLORSPACE_RGB555:
+            return (mp_obj_t) MP_ROM_PTR(&displayio_colorspace_rgb555_obj);
+        case DISPLAYIO_COLORSPACE_L8:
+            return (mp_obj_t) MP_ROM_PTR(&displayio_colorspace_l8_obj);
+        case DISPLAYIO_COLORSPACE_RGB888:
+        default:
+            return (mp_obj_t) MP_ROM_PTR(&displayio_colorspace_rgb888_obj);
+    }
+}
+
+STATIC const mp_rom_map_elem_t displayio_colorspace_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_RGB888), MP_ROM_PTR(&displayio_colorspace_rgb888_obj) },
+    { MP_ROM_QSTR(MP_QSTR_RGB565), MP_ROM_PTR(&displayio_colorspace_rgb565_obj) },
+    { MP_ROM_QSTR(MP_QSTR_RGB555), MP_ROM_PTR(&displayio_colorspace_rgb555_obj) },
+    { MP_ROM_QSTR(MP_QSTR_L8), MP_ROM_PTR(&displayio_colorspace_l8_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(displayio_colorspace_locals_dict, displayio_colorspace_locals_dict_table);
+
+STATIC void displayio_colorspace_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    qstr colorspace = MP_QSTR_RGB888;
+    if (self_in == MP_ROM_PTR(&displayio_colorspace_rgb565_obj)) {
+        colorspace = MP_QSTR_RGB565;
+    } else if (self_in == MP_ROM_PTR(&displayio_colorspace_rgb555_obj)) {
+        colorspace = MP_QSTR_RGB555;
+    } else if (self_in == MP_ROM_PTR(&displayio_colorspace_l8_obj)) {
+        colorspace = MP_QSTR_L8;
+    }
+    mp_printf(print, "%q.%q.%q", MP_QSTR_displayio, MP_QSTR_Colorspace, colorspace);
+}
+
+const mp_obj_type_t displayio_colorspace_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_Colorspace,
+    .print = displayio_colorspace_print,
+    .locals_dict = (mp_obj_t)&displayio_colorspace_locals_dict,
+};
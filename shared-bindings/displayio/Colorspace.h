@@ -0,0 +1,53 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_COLORSPACE_H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_COLORSPACE_H
+
+#include "py/obj.h"
+
+typedef enum {
+    DISPLAYIO_COLORSPACE_RGB888,
+    DISPLAYIO_COLORSPACE_RGB565,
+    DISPLAYIO_COLORSPACE_RGB555,
+    DISPLAYIO_COLORSPACE_L8,
+} displayio_colorspace_t;
+
+typedef struct {
+    mp_obj_base_t base;
+} displayio_colorspace_obj_t;
+
+extern const mp_obj_type_t displayio_colorspace_type;
+
+extern const displayio_colorspace_obj_t displayio_colorspace_rgb888_obj;
+extern const displayio_colorspace_obj_t displayio_colorspace_rgb565_obj;
+extern const displayio_colorspace_obj_t displayio_colorspace_rgb555_obj;
+extern const displayio_colorspace_obj_t displayio_colorspace_l8_obj;
+
+displayio_colorspace_t displayio_colorspace_from_obj(mp_obj_t obj);
+mp_obj_t displayio_colorspace_to_obj(displayio_colorspace_t colorspace);
+
+#endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYIO_COLORSPACE_H
@@ -51,7 +51,7 @@
 //| Most people should not use this class directly. Use a specific display driver instead that will
 //| contain the initialization sequence at minimum.
 //|
-//| .. class:: Display(display_bus, init_sequence, *, width, height, colstart=0, rowstart=0, rotation=0, color_depth=16, set_column_command=0x2a, set_row_command=0x2b, write_ram_command=0x2c, set_vertical_scroll=0, backlight_pin=None, brightness=1.0, auto_brightness=False, single_byte_bounds=False, data_as_commands=False)
+//| .. class:: Display(display_bus, init_sequence, *, width, height, colstart=0, rowstart=0, rotation=0, color_depth=16, set_column_command=0x2a, set_row_command=0x2b, write_ram_command=0x2c, set_vertical_scroll=0, memory_height=0, backlight_pin=None, brightness=1.0, auto_brightness=False, single_byte_bounds=False, data_as_commands=False)
 //|
 //|   Create a Display object on the given display bus (`displayio.FourWire` or `displayio.ParallelBus`).
 //|
@@ -90,7 +90,12 @@
 //|   :param int set_column_command: Command used to set the start and end columns to update
 //|   :param int set_row_command: Command used so set the start and end rows to update
 //|   :param int write_ram_command: Command used to write pixels values into the update region
-//|   :param int set_vertical_scroll: Command used to set the first row to show
+//|   :param int set_vertical_scroll: Command used to set the first row to show. When given, a
+//|     `terminalio.Terminal` shown in the root group scrolls the panel rather than being redrawn.
+//|     Only used when memory_height is given, rotation is 0 and rowstart is 0.
+//|   :param int memory_height: The number of rows in the panel's memory, which may be more than
+//|     are shown. The panel's scroll area has to account for every row so scrolling is off when
+//|     this is 0.
 //|   :param microcontroller.Pin backlight_pin: Pin connected to the display's backlight
 //|   :param bool brightness: Initial display brightness. This value is ignored if auto_brightness is True.
 //|   :param bool auto_brightness: If True, brightness is controlled via an ambient light sensor or other mechanism.
@@ -98,7 +103,7 @@
 //|   :param bool data_as_commands: Treat all init and boundary data as SPI commands. Certain displays require this.
 //|
 STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
-    enum { ARG_display_bus, ARG_init_sequence, ARG_width, ARG_height, ARG_colstart, ARG_rowstart, ARG_rotation, ARG_color_depth, ARG_set_column_command, ARG_set_row_command, ARG_write_ram_command, ARG_set_vertical_scroll, ARG_backlight_pin, ARG_brightness, ARG_auto_brightness, ARG_single_byte_bounds, ARG_data_as_commands };
+    enum { ARG_display_bus, ARG_init_sequence, ARG_width, ARG_height, ARG_colstart, ARG_rowstart, ARG_rotation, ARG_color_depth, ARG_set_column_command, ARG_set_row_command, ARG_write_ram_command, ARG_set_vertical_scroll, ARG_memory_height, ARG_backlight_pin, ARG_brightness, ARG_auto_brightness, ARG_single_byte_bounds, ARG_data_as_commands };
     static const mp_arg_t allowed_args[] = {
         { MP_QSTR_display_bus, MP_ARG_REQUIRED | MP_ARG_OBJ },
         { MP_QSTR_init_sequence, MP_ARG_REQUIRED | MP_ARG_OBJ },
@@ -112,6 +117,7 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
         { MP_QSTR_set_row_command, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0x2b} },
         { MP_QSTR_write_ram_command, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0x2c} },
         { MP_QSTR_set_vertical_scroll, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0x0} },
+        { MP_QSTR_memory_height, MP_ARG_INT | MP_ARG_KW_ONLY, {.u_int = 0} },
         { MP_QSTR_backlight_pin, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = mp_const_none} },
         { MP_QSTR_brightness, MP_ARG_OBJ | MP_ARG_KW_ONLY, {.u_obj = MP_OBJ_NEW_SMALL_INT(1)} },
         { MP_QSTR_auto_brightness, MP_ARG_BOOL | MP_ARG_KW_ONLY, {.u_bool = false} },
@@ -126,13 +132,15 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
     mp_buffer_info_t bufinfo;
     mp_get_buffer_raise(args[ARG_init_sequence].u_obj, &bufinfo, MP_BUFFER_READ);
 
+    const mcu_pin_obj_t* backlight_pin = NULL;
+    #if CIRCUITPY_PULSEIO
     mp_obj_t backlight_pin_obj = args[ARG_backlight_pin].u_obj;
     assert_pin(backlight_pin_obj, true);
-    const mcu_pin_obj_t* backlight_pin = NULL;
     if (backlight_pin_obj != NULL && backlight_pin_obj != mp_const_none) {
         backlight_pin = MP_OBJ_TO_PTR(backlight_pin_obj);
         assert_pin_free(backlight_pin);
     }
+    #endif
 
     mp_float_t brightness = mp_obj_get_float(args[ARG_brightness].u_obj);
 
@@ -141,6 +149,12 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
         mp_raise_ValueError(translate("Display rotation must be in 90 degree increments"));
     }
 
+    mp_int_t memory_height = args[ARG_memory_height].u_int;
+    if (memory_height != 0 && (memory_height < args[ARG_height].u_int || memory_height > 0xffff)) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_memory_height,
+            args[ARG_height].u_int, 0xffff);
+    }
+
     displayio_display_obj_t *self = NULL;
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         if (displays[i].display.base.type == NULL ||
@@ -159,6 +173,7 @@ STATIC mp_obj_t displayio_display_make_new(const mp_obj_type_t *type, size_t n_a
         args[ARG_color_depth].u_int, args[ARG_set_column_command].u_int, args[ARG_set_row_command].u_int,
         args[ARG_write_ram_command].u_int,
         args[ARG_set_vertical_scroll].u_int,
+        memory_height,
         bufinfo.buf, bufinfo.len,
         MP_OBJ_TO_PTR(backlight_pin),
         brightness,
@@ -205,10 +220,24 @@ STATIC mp_obj_t displayio_display_obj_refresh_soon(mp_obj_t self_in) {
 }
 MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_refresh_soon_obj, displayio_display_obj_refresh_soon);
 
+//|   .. method:: refresh()
+//|
+//|     Draws everything that has changed right away and returns once it has been sent to the
+//|     display. Use this with `auto_refresh` set to False to decide exactly when frames are drawn.
+//|
+STATIC mp_obj_t displayio_display_obj_refresh(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    common_hal_displayio_display_refresh(self);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_refresh_obj, displayio_display_obj_refresh);
+
 //|   .. method:: wait_for_frame()
 //|
 //|     Waits until the next frame has been transmitted to the display unless the wait count is
 //|     behind the rendered frames. In that case, this will return immediately with the wait count.
+//|     When `auto_refresh` is False no frames are drawn in the background so this draws one right
+//|     away, like `refresh`, and returns once it has been sent.
 //|
 STATIC mp_obj_t displayio_display_obj_wait_for_frame(mp_obj_t self_in) {
     displayio_display_obj_t *self = native_display(self_in);
@@ -279,6 +308,170 @@ const mp_obj_property_t displayio_display_auto_brightness_obj = {
               (mp_obj_t)&mp_const_none_obj},
 };
 
+//|   .. attribute:: auto_refresh
+//|
+//|     True when the display refreshes in the background at `target_frames_per_second`. When
+//|     False, the display is only updated by `refresh`.
+//|
+STATIC mp_obj_t displayio_display_obj_get_auto_refresh(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_bool(common_hal_displayio_display_get_auto_refresh(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_auto_refresh_obj, displayio_display_obj_get_auto_refresh);
+
+STATIC mp_obj_t displayio_display_obj_set_auto_refresh(mp_obj_t self_in, mp_obj_t auto_refresh) {
+    displayio_display_obj_t *self = native_display(self_in);
+    common_hal_displayio_display_set_auto_refresh(self, mp_obj_is_true(auto_refresh));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_display_set_auto_refresh_obj, displayio_display_obj_set_auto_refresh);
+
+const mp_obj_property_t displayio_display_auto_refresh_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_auto_refresh_obj,
+              (mp_obj_t)&displayio_display_set_auto_refresh_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: target_frames_per_second
+//|
+//|     How often background refreshes start. 0 refreshes as often as possible. Defaults to 30.
+//|
+STATIC mp_obj_t displayio_display_obj_get_target_frames_per_second(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_display_get_target_frames_per_second(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_target_frames_per_second_obj, displayio_display_obj_get_target_frames_per_second);
+
+STATIC mp_obj_t displayio_display_obj_set_target_frames_per_second(mp_obj_t self_in, mp_obj_t target_frames_per_second) {
+    displayio_display_obj_t *self = native_display(self_in);
+    mp_int_t fps = mp_obj_get_int(target_frames_per_second);
+    if (fps < 0 || fps > 1000) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_target_frames_per_second, 0, 1000);
+    }
+    common_hal_displayio_display_set_target_frames_per_second(self, fps);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_display_set_target_frames_per_second_obj, displayio_display_obj_set_target_frames_per_second);
+
+const mp_obj_property_t displayio_display_target_frames_per_second_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_target_frames_per_second_obj,
+              (mp_obj_t)&displayio_display_set_target_frames_per_second_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: max_refresh_time
+//|
+//|     The longest a single background refresh may take in seconds, or None for no limit. A frame
+//|     that takes longer is finished over the following background refreshes so that other work
+//|     gets to run in between.
+//|
+STATIC mp_obj_t displayio_display_obj_get_max_refresh_time(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    uint32_t max_refresh_time = common_hal_displayio_display_get_max_refresh_time(self);
+    if (max_refresh_time == 0) {
+        return mp_const_none;
+    }
+    return mp_obj_new_float(max_refresh_time / 1000000.0);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_max_refresh_time_obj, displayio_display_obj_get_max_refresh_time);
+
+STATIC mp_obj_t displayio_display_obj_set_max_refresh_time(mp_obj_t self_in, mp_obj_t max_refresh_time) {
+    displayio_display_obj_t *self = native_display(self_in);
+    uint32_t max_refresh_time_us = 0;
+    if (max_refresh_time != mp_const_none) {
+        mp_float_t seconds = mp_obj_get_float(max_refresh_time);
+        if (seconds <= 0 || seconds > 60) {
+            mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_max_refresh_time, 0, 60);
+        }
+        max_refresh_time_us = seconds * 1000000;
+        if (max_refresh_time_us == 0) {
+            max_refresh_time_us = 1;
+        }
+    }
+    common_hal_displayio_display_set_max_refresh_time(self, max_refresh_time_us);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_display_set_max_refresh_time_obj, displayio_display_obj_set_max_refresh_time);
+
+const mp_obj_property_t displayio_display_max_refresh_time_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_max_refresh_time_obj,
+              (mp_obj_t)&displayio_display_set_max_refresh_time_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: last_render_time
+//|
+//|     Seconds spent drawing pixels for the last complete frame. (read only)
+//|
+STATIC mp_obj_t displayio_display_obj_get_last_render_time(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_float(common_hal_displayio_display_get_last_render_time(self) / 1000000.0);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_last_render_time_obj, displayio_display_obj_get_last_render_time);
+
+const mp_obj_property_t displayio_display_last_render_time_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_last_render_time_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: last_send_time
+//|
+//|     Seconds of the last complete frame spent on anything other than drawing, mostly waiting
+//|     for the display bus. (read only)
+//|
+STATIC mp_obj_t displayio_display_obj_get_last_send_time(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_float(common_hal_displayio_display_get_last_send_time(self) / 1000000.0);
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_last_send_time_obj, displayio_display_obj_get_last_send_time);
+
+const mp_obj_property_t displayio_display_last_send_time_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_last_send_time_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: pixels_sent
+//|
+//|     Total number of pixels sent to the display. (read only)
+//|
+STATIC mp_obj_t displayio_display_obj_get_pixels_sent(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_display_get_pixels_sent(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_pixels_sent_obj, displayio_display_obj_get_pixels_sent);
+
+const mp_obj_property_t displayio_display_pixels_sent_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_pixels_sent_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: frames_skipped
+//|
+//|     Total number of frames missed at `target_frames_per_second` because earlier frames took
+//|     too long. (read only)
+//|
+STATIC mp_obj_t displayio_display_obj_get_frames_skipped(mp_obj_t self_in) {
+    displayio_display_obj_t *self = native_display(self_in);
+    return mp_obj_new_int_from_uint(common_hal_displayio_display_get_frames_skipped(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_display_get_frames_skipped_obj, displayio_display_obj_get_frames_skipped);
+
+const mp_obj_property_t displayio_display_frames_skipped_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_display_get_frames_skipped_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
 //|   .. attribute:: width
 //|
 //|	Gets the width of the board
@@ -337,11 +530,20 @@ const mp_obj_property_t displayio_display_bus_obj = {
 STATIC const mp_rom_map_elem_t displayio_display_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_show), MP_ROM_PTR(&displayio_display_show_obj) },
     { MP_ROM_QSTR(MP_QSTR_refresh_soon), MP_ROM_PTR(&displayio_display_refresh_soon_obj) },
+    { MP_ROM_QSTR(MP_QSTR_refresh), MP_ROM_PTR(&displayio_display_refresh_obj) },
     { MP_ROM_QSTR(MP_QSTR_wait_for_frame), MP_ROM_PTR(&displayio_display_wait_for_frame_obj) },
 
     { MP_ROM_QSTR(MP_QSTR_brightness), MP_ROM_PTR(&displayio_display_brightness_obj) },
     { MP_ROM_QSTR(MP_QSTR_auto_brightness), MP_ROM_PTR(&displayio_display_auto_brightness_obj) },
 
+    { MP_ROM_QSTR(MP_QSTR_auto_refresh), MP_ROM_PTR(&displayio_display_auto_refresh_obj) },
+    { MP_ROM_QSTR(MP_QSTR_target_frames_per_second), MP_ROM_PTR(&displayio_display_target_frames_per_second_obj) },
+    { MP_ROM_QSTR(MP_QSTR_max_refresh_time), MP_ROM_PTR(&displayio_display_max_refresh_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_render_time), MP_ROM_PTR(&displayio_display_last_render_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_last_send_time), MP_ROM_PTR(&displayio_display_last_send_time_obj) },
+    { MP_ROM_QSTR(MP_QSTR_pixels_sent), MP_ROM_PTR(&displayio_display_pixels_sent_obj) },
+    { MP_ROM_QSTR(MP_QSTR_frames_skipped), MP_ROM_PTR(&displayio_display_frames_skipped_obj) },
+
     { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_display_width_obj) },
     { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_display_height_obj) },
     { MP_ROM_QSTR(MP_QSTR_bus), MP_ROM_PTR(&displayio_display_bus_obj) },
@@ -40,7 +40,7 @@ void common_hal_displayio_display_construct(displayio_display_obj_t* self,
     mp_obj_t bus, uint16_t width, uint16_t height,
     int16_t colstart, int16_t rowstart, uint16_t rotation, uint16_t color_depth,
     uint8_t set_column_command, uint8_t set_row_command, uint8_t write_ram_command, uint8_t set_vertical_scroll,
-    uint8_t* init_sequence, uint16_t init_sequence_len, const mcu_pin_obj_t* backlight_pin,
+    uint16_t memory_height, uint8_t* init_sequence, uint16_t init_sequence_len, const mcu_pin_obj_t* backlight_pin,
     mp_float_t brightness, bool auto_brightness,
     bool single_byte_bounds, bool data_as_commands);
 
@@ -49,17 +49,51 @@ int32_t common_hal_displayio_display_wait_for_frame(displayio_display_obj_t* sel
 void common_hal_displayio_display_show(displayio_display_obj_t* self, displayio_group_t* root_group);
 
 void common_hal_displayio_display_refresh_soon(displayio_display_obj_t* self);
+void common_hal_displayio_display_refresh(displayio_display_obj_t* self);
+
+bool common_hal_displayio_display_get_auto_refresh(displayio_display_obj_t* self);
+void common_hal_displayio_display_set_auto_refresh(displayio_display_obj_t* self, bool auto_refresh);
+
+// 0 means refresh as often as possible.
+uint16_t common_hal_displayio_display_get_target_frames_per_second(displayio_display_obj_t* self);
+void common_hal_displayio_display_set_target_frames_per_second(displayio_display_obj_t* self,
+    uint16_t target_frames_per_second);
+
+// Times are in microseconds. A max_refresh_time of 0 means no limit.
+uint32_t common_hal_displayio_display_get_max_refresh_time(displayio_display_obj_t* self);
+void common_hal_displayio_display_set_max_refresh_time(displayio_display_obj_t* self, uint32_t max_refresh_time);
+uint32_t common_hal_displayio_display_get_last_render_time(displayio_display_obj_t* self);
+uint32_t common_hal_displayio_display_get_last_send_time(displayio_display_obj_t* self);
+uint32_t common_hal_displayio_display_get_pixels_sent(displayio_display_obj_t* self);
+uint32_t common_hal_displayio_display_get_frames_skipped(displayio_display_obj_t* self);
 
 bool displayio_display_begin_transaction(displayio_display_obj_t* self);
 void displayio_display_end_transaction(displayio_display_obj_t* self);
 
 // The second point of the region is exclusive.
 void displayio_display_set_region_to_update(displayio_display_obj_t* self, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+// Returns the first row after y1, and no later than y2, that doesn't directly follow the row above it
+// in panel memory because the panel is scrolled. A region passed to
+// displayio_display_set_region_to_update must not cross it.
+uint16_t displayio_display_get_scroll_break(displayio_display_obj_t* self, uint16_t y1, uint16_t y2);
 bool displayio_display_frame_queued(displayio_display_obj_t* self);
+// Milliseconds between frames or 0 when there is no target frame rate.
+uint32_t displayio_display_frame_interval_ms(displayio_display_obj_t* self);
 
-bool displayio_display_refresh_queued(displayio_display_obj_t* self);
+// Collects the areas, in display coordinates, that need to be redrawn. Returns false when there
+// are none.
+bool displayio_display_get_refresh_areas(displayio_display_obj_t* self, displayio_area_list_t* areas);
 void displayio_display_finish_refresh(displayio_display_obj_t* self);
-void displayio_display_send_pixels(displayio_display_obj_t* self, uint32_t* pixels, uint32_t length);
+// length is in bytes.
+void displayio_display_send_pixels(displayio_display_obj_t* self, uint8_t* pixels, uint32_t length);
+// Starts sending pixels and returns while they go out, when the bus supports it. done is called
+// with context once pixels may be reused. Only one send can be in progress at a time.
+void displayio_display_begin_send_pixels(displayio_display_obj_t* self, uint8_t* pixels, uint32_t length,
+    display_bus_send_done done, void* context);
+// Returns true while pixels from displayio_display_begin_send_pixels are going out.
+bool displayio_display_send_in_progress(displayio_display_obj_t* self);
+// Returns true when something other than this display may use its bus between transactions.
+bool displayio_display_bus_shared(displayio_display_obj_t* self);
 
 bool common_hal_displayio_display_get_auto_brightness(displayio_display_obj_t* self);
 void common_hal_displayio_display_set_auto_brightness(displayio_display_obj_t* self, bool auto_brightness);
@@ -46,4 +46,9 @@ void common_hal_displayio_fourwire_send(mp_obj_t self, bool command, uint8_t *da
 
 void common_hal_displayio_fourwire_end_transaction(mp_obj_t self);
 
+void common_hal_displayio_fourwire_begin_send(mp_obj_t self, uint8_t *data, uint32_t data_length,
+    display_bus_send_done done, void* context);
+
+bool common_hal_displayio_fourwire_send_in_progress(mp_obj_t self);
+
 #endif // MICROPY_INCLUDED_SHARED_BINDINGS_DISPLAYBUSIO_FOURWIRE_H
@@ -0,0 +1,195 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/displayio/MemoryBus.h"
+
+#include <stdint.h>
+
+#include "py/objproperty.h"
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-module/displayio/__init__.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: displayio
+//|
+//| :class:`MemoryBus` -- Display bus that draws into memory
+//| ==========================================================================
+//|
+//| Stands in for a display bus such as `FourWire` on hosts without display hardware. It
+//| understands the MIPI DCS column, row, memory write and vertical scroll commands used by `Display`
+//| and keeps the pixels it is sent in an RGB565 framebuffer. Other commands, such as those in an
+//| init sequence, are ignored. Only available in the unix port.
+//|
+//| .. code-block:: Python
+//|
+//|   import displayio
+//|
+//|   bus = displayio.MemoryBus(width=320, height=240)
+//|   display = displayio.Display(bus, b"", width=320, height=240)
+//|   display.auto_refresh = False
+//|   display.show(group)
+//|   display.refresh()
+//|   with open("frame.ppm", "wb") as f:
+//|       bus.dump_ppm(f)
+//|
+//| .. class:: MemoryBus(*, width, height)
+//|
+//|   Create a MemoryBus with a framebuffer of the given size. Like other display buses it is in use
+//|   until `displayio.release_displays()` is called.
+//|
+//|   :param int width: Width of the framebuffer in pixels
+//|   :param int height: Height of the framebuffer in pixels
+//|
+STATIC mp_obj_t displayio_memorybus_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_width, ARG_height };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_width, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, },
+        { MP_QSTR_height, MP_ARG_INT | MP_ARG_KW_ONLY | MP_ARG_REQUIRED, },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    mp_int_t width = args[ARG_width].u_int;
+    mp_int_t height = args[ARG_height].u_int;
+    if (width <= 0 || width > 0xffff) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_width, 1, 0xffff);
+    }
+    if (height <= 0 || height > 0xffff) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), MP_QSTR_height, 1, 0xffff);
+    }
+
+    displayio_memorybus_obj_t* self = NULL;
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
+        if (displays[i].memory_bus.base.type == NULL ||
+            displays[i].memory_bus.base.type == &mp_type_NoneType) {
+            self = &displays[i].memory_bus;
+            self->base.type = &displayio_memorybus_type;
+            break;
+        }
+    }
+    if (self == NULL) {
+        mp_raise_RuntimeError(translate("Too many display busses"));
+    }
+
+    common_hal_displayio_memorybus_construct(self, width, height);
+    return self;
+}
+
+//|   .. method:: send(command, data)
+//|
+//|     Sends the given command value followed by the full set of data.
+//|
+STATIC mp_obj_t displayio_memorybus_obj_send(mp_obj_t self, mp_obj_t command_obj, mp_obj_t data_obj) {
+    mp_int_t command_int = MP_OBJ_SMALL_INT_VALUE(command_obj);
+    if (!MP_OBJ_IS_SMALL_INT(command_obj) || command_int > 255 || command_int < 0) {
+        mp_raise_ValueError(translate("Command must be an int between 0 and 255"));
+    }
+    uint8_t command = command_int;
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(data_obj, &bufinfo, MP_BUFFER_READ);
+
+    if (!common_hal_displayio_memorybus_begin_transaction(self)) {
+        mp_raise_RuntimeError(translate("Display bus in use"));
+    }
+    common_hal_displayio_memorybus_send(self, true, &command, 1);
+    common_hal_displayio_memorybus_send(self, false, ((uint8_t*) bufinfo.buf), bufinfo.len);
+    common_hal_displayio_memorybus_end_transaction(self);
+
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_3(displayio_memorybus_send_obj, displayio_memorybus_obj_send);
+
+//|   .. method:: dump_ppm(stream)
+//|
+//|     Writes the framebuffer to the given stream as a binary PPM image. Rows are written in the
+//|     order they are shown, which differs from memory order once the framebuffer is scrolled.
+//|
+STATIC mp_obj_t displayio_memorybus_obj_dump_ppm(mp_obj_t self_in, mp_obj_t stream) {
+    displayio_memorybus_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    mp_get_stream_raise(stream, MP_STREAM_OP_WRITE);
+
+    common_hal_displayio_memorybus_dump_ppm(self, stream);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_memorybus_dump_ppm_obj, displayio_memorybus_obj_dump_ppm);
+
+//|   .. attribute:: bytes_sent
+//|
+//|     Number of bytes, commands included, sent to the bus since it was created. (read only)
+//|
+STATIC mp_obj_t displayio_memorybus_obj_get_bytes_sent(mp_obj_t self_in) {
+    displayio_memorybus_obj_t *self = MP_OBJ_TO_PTR(self_in);
+    return mp_obj_new_int_from_ull(common_hal_displayio_memorybus_get_bytes_sent(self));
+}
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_memorybus_get_bytes_sent_obj, displayio_memorybus_obj_get_bytes_sent);
+
+const mp_obj_property_t displayio_memorybus_bytes_sent_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_memorybus_get_bytes_sent_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. method:: __getitem__(index)
+//|
+//|     Returns the RGB565 color at the given x,y tuple.
+//|
+//|     This allows you to::
+//|
+//|       print(bus[0,1])
+//|
+STATIC mp_obj_t memorybus_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t value_obj) {
+    if (value_obj != MP_OBJ_SENTINEL) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    displayio_memorybus_obj_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_obj_t* items;
+    mp_obj_get_array_fixed_n(index_obj, 2, &items);
+    mp_int_t x = mp_obj_get_int(items[0]);
+    mp_int_t y = mp_obj_get_int(items[1]);
+    if (x < 0 || y < 0 || x >= self->width || y >= self->height) {
+        mp_raise_IndexError(translate("pixel coordinates out of bounds"));
+    }
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_memorybus_get_pixel(self, x, y));
+}
+
+STATIC const mp_rom_map_elem_t displayio_memorybus_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_send), MP_ROM_PTR(&displayio_memorybus_send_obj) },
+    { MP_ROM_QSTR(MP_QSTR_dump_ppm), MP_ROM_PTR(&displayio_memorybus_dump_ppm_obj) },
+    { MP_ROM_QSTR(MP_QSTR_bytes_sent), MP_ROM_PTR(&displayio_memorybus_bytes_sent_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(displayio_memorybus_locals_dict, displayio_memorybus_locals_dict_table);
+
+const mp_obj_type_t displayio_memorybus_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_MemoryBus,
+    .make_new = displayio_memorybus_make_new,
+    .subscr = memorybus_subscr,
+    .locals_dict = (mp_obj_dict_t*)&displayio_memorybus_locals_dict,
+};
@@ -40,7 +40,8 @@
 //|
 //| Loads values straight from disk. This minimizes memory use but can lead to
 //| much slower pixel load times. These load times may result in frame tearing where only part of
-//| the image is visible.
+//| the image is visible. A few decoded rows are kept in memory, so drawing the bitmap without
+//| scaling it up or rotating the display is the fastest way to load it.
 //|
 //| It's easiest to use on a board with a built in display such as the `Hallowing M0 Express
 //| <https://www.adafruit.com/product/3900>`_.
@@ -82,7 +83,8 @@
 STATIC mp_obj_t displayio_ondiskbitmap_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
     mp_arg_check_num(n_args, kw_args, 1, 1, false);
 
-    if (!MP_OBJ_IS_TYPE(pos_args[0], &mp_type_fileio)) {
+    // The bitmap is read with FatFs directly so other file types won't do.
+    if (!MP_OBJ_IS_TYPE(pos_args[0], &mp_type_vfs_fat_fileio)) {
         mp_raise_TypeError(translate("file must be a file opened in byte mode"));
     }
 
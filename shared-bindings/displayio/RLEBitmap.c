@@ -0,0 +1,156 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/RLEBitmap.h"
+
+#include <stdint.h>
+
+#include "py/runtime.h"
+#include "py/objproperty.h"
+#include "supervisor/shared/translate.h"
+
+//| .. currentmodule:: displayio
+//|
+//| :class:`RLEBitmap` -- Read-only run-length encoded bitmap
+//| ==========================================================================
+//|
+//| Reads values from run-length encoded data without decoding it into memory first. Large
+//| backgrounds with areas of a single color take a fraction of the memory of a `Bitmap`. Use
+//| ``tools/bitmap_to_rle.py`` to convert BMP and PNG files.
+//|
+//| .. code-block:: Python
+//|
+//|   import board
+//|   import displayio
+//|
+//|   with open("/background.rle", "rb") as f:
+//|       background = displayio.RLEBitmap(f.read())
+//|
+//|   palette = displayio.Palette(2)
+//|   palette[0] = 0x000000
+//|   palette[1] = 0xffffff
+//|
+//|   splash = displayio.Group()
+//|   splash.append(displayio.TileGrid(background, pixel_shader=palette))
+//|   board.DISPLAY.show(splash)
+//|
+//| .. class:: RLEBitmap(buffer)
+//|
+//|   Create an RLEBitmap that reads its values from the given encoded data. A `bytes` buffer is
+//|   used directly. Any other buffer, such as a `bytearray`, is copied so later changes to it
+//|   don't affect the bitmap.
+//|
+//|   :param bytes buffer: The encoded bitmap
+//|
+STATIC mp_obj_t displayio_rlebitmap_make_new(const mp_obj_type_t *type, size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    mp_arg_check_num(n_args, kw_args, 1, 1, false);
+
+    mp_buffer_info_t bufinfo;
+    mp_get_buffer_raise(pos_args[0], &bufinfo, MP_BUFFER_READ);
+
+    displayio_rlebitmap_t *self = m_new_obj(displayio_rlebitmap_t);
+    self->base.type = &displayio_rlebitmap_type;
+    common_hal_displayio_rlebitmap_construct(self, pos_args[0], bufinfo.buf, bufinfo.len);
+
+    return MP_OBJ_FROM_PTR(self);
+}
+
+//|   .. attribute:: width
+//|
+//|      Width of the bitmap. (read only)
+//|
+STATIC mp_obj_t displayio_rlebitmap_obj_get_width(mp_obj_t self_in) {
+    displayio_rlebitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_rlebitmap_get_width(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_rlebitmap_get_width_obj, displayio_rlebitmap_obj_get_width);
+
+const mp_obj_property_t displayio_rlebitmap_width_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_rlebitmap_get_width_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. attribute:: height
+//|
+//|      Height of the bitmap. (read only)
+//|
+STATIC mp_obj_t displayio_rlebitmap_obj_get_height(mp_obj_t self_in) {
+    displayio_rlebitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_rlebitmap_get_height(self));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(displayio_rlebitmap_get_height_obj, displayio_rlebitmap_obj_get_height);
+
+const mp_obj_property_t displayio_rlebitmap_height_obj = {
+    .base.type = &mp_type_property,
+    .proxy = {(mp_obj_t)&displayio_rlebitmap_get_height_obj,
+              (mp_obj_t)&mp_const_none_obj,
+              (mp_obj_t)&mp_const_none_obj},
+};
+
+//|   .. method:: __getitem__(index)
+//|
+//|     Returns the value at the given x,y tuple.
+//|
+//|     This allows you to::
+//|
+//|       print(bitmap[0,1])
+//|
+STATIC mp_obj_t rlebitmap_subscr(mp_obj_t self_in, mp_obj_t index_obj, mp_obj_t value_obj) {
+    if (value_obj != MP_OBJ_SENTINEL) {
+        mp_raise_RuntimeError(translate("Read-only object"));
+    }
+    displayio_rlebitmap_t *self = MP_OBJ_TO_PTR(self_in);
+
+    mp_obj_t* items;
+    mp_obj_get_array_fixed_n(index_obj, 2, &items);
+    mp_int_t x = mp_obj_get_int(items[0]);
+    mp_int_t y = mp_obj_get_int(items[1]);
+    if (x < 0 || y < 0 || x >= common_hal_displayio_rlebitmap_get_width(self) ||
+        y >= common_hal_displayio_rlebitmap_get_height(self)) {
+        mp_raise_IndexError(translate("pixel coordinates out of bounds"));
+    }
+    return MP_OBJ_NEW_SMALL_INT(common_hal_displayio_rlebitmap_get_pixel(self, x, y));
+}
+
+STATIC const mp_rom_map_elem_t displayio_rlebitmap_locals_dict_table[] = {
+    { MP_ROM_QSTR(MP_QSTR_height), MP_ROM_PTR(&displayio_rlebitmap_height_obj) },
+    { MP_ROM_QSTR(MP_QSTR_width), MP_ROM_PTR(&displayio_rlebitmap_width_obj) },
+};
+STATIC MP_DEFINE_CONST_DICT(displayio_rlebitmap_locals_dict, displayio_rlebitmap_locals_dict_table);
+
+const mp_obj_type_t displayio_rlebitmap_type = {
+    { &mp_type_type },
+    .name = MP_QSTR_RLEBitmap,
+    .make_new = displayio_rlebitmap_make_new,
+    .subscr = rlebitmap_subscr,
+    .locals_dict = (mp_obj_dict_t*)&displayio_rlebitmap_locals_dict,
+};
@@ -110,8 +110,99 @@ STATIC mp_obj_t displayio_shape_obj_set_boundary(size_t n_args, const mp_obj_t *
 }
 MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio_shape_set_boundary_obj, 4, 4, displayio_shape_obj_set_boundary);
 
+// Lengths are limited to what the shape can hold.
+static uint16_t get_length(mp_obj_t obj, qstr name) {
+    mp_int_t length = mp_obj_get_int(obj);
+    if (length < 0 || length > 0xffff) {
+        mp_raise_ValueError_varg(translate("%q must be between %d and %d"), name, 0, 0xffff);
+    }
+    return length;
+}
+
+//|   .. method:: set_circle(x, y, radius)
+//|
+//|     Sets every row's boundary so that the shape is a filled circle centered on ``x``, ``y``.
+//|     The circle may extend past the edges of the shape. Mirrored shapes only use the part of
+//|     the circle that isn't mirrored.
+//|
+//|     :param int x: Horizontal position of the center
+//|     :param int y: Vertical position of the center
+//|     :param int radius: Radius in pixels
+//|
+STATIC mp_obj_t displayio_shape_obj_set_circle(size_t n_args, const mp_obj_t *args) {
+    (void) n_args;
+    displayio_shape_t *self = MP_OBJ_TO_PTR(args[0]);
+    common_hal_displayio_shape_set_circle(self, mp_obj_get_int(args[1]), mp_obj_get_int(args[2]),
+        get_length(args[3], MP_QSTR_radius));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(displayio_shape_set_circle_obj, 4, 4, displayio_shape_obj_set_circle);
+
+//|   .. method:: set_rounded_rectangle(x, y, width, height, radius)
+//|
+//|     Sets every row's boundary so that the shape is a filled rectangle with its top left corner
+//|     at ``x``, ``y`` and corners rounded to ``radius``. The radius is limited to half of the
+//|     smaller side.
+//|
+//|     :param int x: Left edge of the rectangle
+//|     :param int y: Top edge of the rectangle
+//|     :param int width: Width of the rectangle
+//|     :param int height: Height of the rectangle
+//|     :param int radius: Radius of the corners in pixels
+//|
+STATIC mp_obj_t displayio_shape_obj_set_rounded_rectangle(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    enum { ARG_x, ARG_y, ARG_width, ARG_height, ARG_radius };
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_x, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_y, MP_ARG_REQUIRED | MP_ARG_INT },
+        { MP_QSTR_width, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_height, MP_ARG_REQUIRED | MP_ARG_OBJ },
+        { MP_QSTR_radius, MP_ARG_REQUIRED | MP_ARG_OBJ },
+    };
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args - 1, pos_args + 1, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+    displayio_shape_t *self = MP_OBJ_TO_PTR(pos_args[0]);
+
+    common_hal_displayio_shape_set_rounded_rectangle(self, args[ARG_x].u_int, args[ARG_y].u_int,
+        get_length(args[ARG_width].u_obj, MP_QSTR_width),
+        get_length(args[ARG_height].u_obj, MP_QSTR_height),
+        get_length(args[ARG_radius].u_obj, MP_QSTR_radius));
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(displayio_shape_set_rounded_rectangle_obj, 6, displayio_shape_obj_set_rounded_rectangle);
+
+//|   .. method:: set_polygon(points)
+//|
+//|     Sets every row's boundary so that the shape is a filled convex polygon. Pixels are inside
+//|     when their centers are. Each row can only hold one span so concave polygons are filled out
+//|     to their outermost edges.
+//|
+//|     :param list points: Sequence of ``(x, y)`` corners in order around the polygon
+//|
+STATIC mp_obj_t displayio_shape_obj_set_polygon(mp_obj_t self_in, mp_obj_t points_obj) {
+    displayio_shape_t *self = MP_OBJ_TO_PTR(self_in);
+    size_t point_count;
+    mp_obj_t* items;
+    mp_obj_get_array(points_obj, &point_count, &items);
+
+    int16_t* points = m_new(int16_t, 2 * point_count);
+    for (size_t i = 0; i < point_count; i++) {
+        mp_obj_t* point;
+        mp_obj_get_array_fixed_n(items[i], 2, &point);
+        points[2 * i] = mp_obj_get_int(point[0]);
+        points[2 * i + 1] = mp_obj_get_int(point[1]);
+    }
+    common_hal_displayio_shape_set_polygon(self, points, point_count);
+    m_del(int16_t, points, 2 * point_count);
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_2(displayio_shape_set_polygon_obj, displayio_shape_obj_set_polygon);
+
 STATIC const mp_rom_map_elem_t displayio_shape_locals_dict_table[] = {
     { MP_ROM_QSTR(MP_QSTR_set_boundary), MP_ROM_PTR(&displayio_shape_set_boundary_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_circle), MP_ROM_PTR(&displayio_shape_set_circle_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_rounded_rectangle), MP_ROM_PTR(&displayio_shape_set_rounded_rectangle_obj) },
+    { MP_ROM_QSTR(MP_QSTR_set_polygon), MP_ROM_PTR(&displayio_shape_set_polygon_obj) },
 };
 STATIC MP_DEFINE_CONST_DICT(displayio_shape_locals_dict, displayio_shape_locals_dict_table);
 
@@ -36,6 +36,7 @@
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
+#include "shared-bindings/displayio/RLEBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/displayio/Shape.h"
 #include "supervisor/shared/translate.h"
@@ -58,7 +59,7 @@
 //|
 //|   tile_width and tile_height match the height of the bitmap by default.
 //|
-//|   :param displayio.Bitmap bitmap: The bitmap storing one or more tiles.
+//|   :param displayio.Bitmap bitmap: The bitmap storing one or more tiles. May also be a `Shape`, `OnDiskBitmap` or `RLEBitmap`.
 //|   :param displayio.Palette pixel_shader: The pixel shader that produces colors from values
 //|   :param int width: Width of the grid in tiles.
 //|   :param int height: Height of the grid in tiles.
@@ -103,6 +104,11 @@ STATIC mp_obj_t displayio_tilegrid_make_new(const mp_obj_type_t *type, size_t n_
         native = bitmap;
         bitmap_width = bmp->width;
         bitmap_height = bmp->height;
+    } else if (MP_OBJ_IS_TYPE(bitmap, &displayio_rlebitmap_type)) {
+        displayio_rlebitmap_t* bmp = MP_OBJ_TO_PTR(bitmap);
+        native = bitmap;
+        bitmap_width = bmp->width;
+        bitmap_height = bmp->height;
     } else {
         mp_raise_TypeError_varg(translate("unsupported %q type"), MP_QSTR_bitmap);
     }
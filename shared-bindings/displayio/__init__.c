@@ -32,14 +32,23 @@
 #include "shared-bindings/displayio/__init__.h"
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
+#include "shared-bindings/displayio/Colorspace.h"
 #include "shared-bindings/displayio/Display.h"
-#include "shared-bindings/displayio/FourWire.h"
 #include "shared-bindings/displayio/Group.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
-#include "shared-bindings/displayio/ParallelBus.h"
+#include "shared-bindings/displayio/RLEBitmap.h"
 #include "shared-bindings/displayio/Shape.h"
 #include "shared-bindings/displayio/TileGrid.h"
+#if CIRCUITPY_BUSIO
+#include "shared-bindings/displayio/FourWire.h"
+#endif
+#if CIRCUITPY_DIGITALIO
+#include "shared-bindings/displayio/ParallelBus.h"
+#endif
+#if CIRCUITPY_DISPLAYIO_MEMORYBUS
+#include "shared-bindings/displayio/MemoryBus.h"
+#endif
 
 //| :mod:`displayio` --- Native display driving
 //| =========================================================================
@@ -58,12 +67,14 @@
 //|
 //|     Bitmap
 //|     ColorConverter
+//|     Colorspace
 //|     Display
 //|     FourWire
 //|     Group
 //|     OnDiskBitmap
 //|     Palette
 //|     ParallelBus
+//|     RLEBitmap
 //|     Shape
 //|     TileGrid
 //|
@@ -88,15 +99,24 @@ STATIC const mp_rom_map_elem_t displayio_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_displayio) },
     { MP_ROM_QSTR(MP_QSTR_Bitmap), MP_ROM_PTR(&displayio_bitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_ColorConverter), MP_ROM_PTR(&displayio_colorconverter_type) },
+    { MP_ROM_QSTR(MP_QSTR_Colorspace), MP_ROM_PTR(&displayio_colorspace_type) },
     { MP_ROM_QSTR(MP_QSTR_Display), MP_ROM_PTR(&displayio_display_type) },
     { MP_ROM_QSTR(MP_QSTR_Group), MP_ROM_PTR(&displayio_group_type) },
     { MP_ROM_QSTR(MP_QSTR_OnDiskBitmap), MP_ROM_PTR(&displayio_ondiskbitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Palette), MP_ROM_PTR(&displayio_palette_type) },
+    { MP_ROM_QSTR(MP_QSTR_RLEBitmap), MP_ROM_PTR(&displayio_rlebitmap_type) },
     { MP_ROM_QSTR(MP_QSTR_Shape), MP_ROM_PTR(&displayio_shape_type) },
     { MP_ROM_QSTR(MP_QSTR_TileGrid), MP_ROM_PTR(&displayio_tilegrid_type) },
 
+    #if CIRCUITPY_BUSIO
     { MP_ROM_QSTR(MP_QSTR_FourWire), MP_ROM_PTR(&displayio_fourwire_type) },
+    #endif
+    #if CIRCUITPY_DIGITALIO
     { MP_ROM_QSTR(MP_QSTR_ParallelBus), MP_ROM_PTR(&displayio_parallelbus_type) },
+    #endif
+    #if CIRCUITPY_DISPLAYIO_MEMORYBUS
+    { MP_ROM_QSTR(MP_QSTR_MemoryBus), MP_ROM_PTR(&displayio_memorybus_type) },
+    #endif
 
     { MP_ROM_QSTR(MP_QSTR_release_displays), MP_ROM_PTR(&displayio_release_displays_obj) },
 };
@@ -0,0 +1,205 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdint.h>
+
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "shared-bindings/fft/__init__.h"
+#include "supervisor/shared/translate.h"
+
+//| :mod:`fft` --- Fast Fourier transforms of sample buffers
+//| ========================================================
+//|
+//| .. module:: fft
+//|   :synopsis: Fast Fourier transforms of sample buffers
+//|   :platform: SAMD21, SAMD51
+//|
+//| The `fft` module computes spectra of real signals held in arrays, such as ones recorded with
+//| `audiobusio.PDMIn`. Everything works in place on the given buffers so nothing is allocated while
+//| analysing.
+//|
+//| Arrays of type ``'h'`` are transformed with 16 bit fixed point math and arrays of type ``'f'``
+//| with floating point. The floating point versions are left out of builds without a floating
+//| point unit.
+//|
+//| Lengths must be a power of two from 16 to 2048.
+//|
+//| Finding the loudest frequency in a recording::
+//|
+//|   import array
+//|   import audiobusio
+//|   import board
+//|   import fft
+//|
+//|   samples = array.array('H', [0] * 256)
+//|   spectrum = array.array('h', [0] * 256)
+//|   mic = audiobusio.PDMIn(board.MICROPHONE_CLOCK, board.MICROPHONE_DATA, sample_rate=16000)
+//|   mic.record(samples, len(samples))
+//|   for i in range(len(samples)):
+//|       spectrum[i] = samples[i] - 32768
+//|   fft.window(spectrum)
+//|   fft.rfft(spectrum)
+//|   fft.magnitude(spectrum, spectrum)
+//|   loudest = max(range(1, 128), key=lambda k: spectrum[k])
+//|   print(loudest * 16000 / 256, "Hz")
+//|
+
+// Returns the typecode of buffer after checking it is one that can be transformed.
+STATIC char get_samples(mp_obj_t buffer, mp_buffer_info_t* bufinfo, uint32_t* length) {
+    mp_get_buffer_raise(buffer, bufinfo, MP_BUFFER_RW);
+    #if CIRCUITPY_FFT_FLOAT
+    if (bufinfo->typecode != 'h' && bufinfo->typecode != 'f') {
+        mp_raise_ValueError(translate("Array must have type 'h' or 'f'"));
+    }
+    #else
+    if (bufinfo->typecode != 'h') {
+        mp_raise_ValueError(translate("Array must have type 'h'"));
+    }
+    #endif
+    uint32_t count = bufinfo->len / (bufinfo->typecode == 'h' ? sizeof(int16_t) : sizeof(float));
+    if (count < FFT_MIN_LENGTH || count > FFT_MAX_LENGTH || (count & (count - 1)) != 0) {
+        mp_raise_ValueError(translate("FFT length must be a power of two from 16 to 2048"));
+    }
+    *length = count;
+    return bufinfo->typecode;
+}
+
+//| .. function:: rfft(buffer)
+//|
+//|   Replaces the samples in buffer with their spectrum. The first two values are the real parts of
+//|   the zero frequency and middle bins, which have no imaginary part. They are followed by the real
+//|   and imaginary parts of the bins in between. Bin k is at k times the sample rate divided by the
+//|   length.
+//|
+//|   Spectra of ``'h'`` arrays are divided by the length so that they fit in 16 bits. A full scale
+//|   sine wave that falls on a bin has a magnitude of 16384 there.
+//|
+STATIC mp_obj_t fft_rfft(mp_obj_t buffer) {
+    mp_buffer_info_t bufinfo;
+    uint32_t length;
+    if (get_samples(buffer, &bufinfo, &length) == 'h') {
+        shared_modules_fft_rfft_q15(bufinfo.buf, length);
+    }
+    #if CIRCUITPY_FFT_FLOAT
+    else {
+        shared_modules_fft_rfft_float(bufinfo.buf, length);
+    }
+    #endif
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_1(fft_rfft_obj, fft_rfft);
+
+//| .. function:: window(buffer, window=HANN)
+//|
+//|   Multiplies the samples in buffer by a window that fades them in and out. This keeps the edges
+//|   of the buffer from spreading energy across the spectrum.
+//|
+//|   :param int window: `HANN`, `HAMMING` or `BLACKMAN`
+//|
+STATIC mp_obj_t fft_window(size_t n_args, const mp_obj_t *args) {
+    fft_window_t window = FFT_WINDOW_HANN;
+    if (n_args > 1) {
+        mp_int_t value = mp_obj_get_int(args[1]);
+        if (value < FFT_WINDOW_HANN || value > FFT_WINDOW_BLACKMAN) {
+            mp_raise_ValueError(translate("Invalid window"));
+        }
+        window = value;
+    }
+    mp_buffer_info_t bufinfo;
+    uint32_t length;
+    if (get_samples(args[0], &bufinfo, &length) == 'h') {
+        shared_modules_fft_window_q15(bufinfo.buf, length, window);
+    }
+    #if CIRCUITPY_FFT_FLOAT
+    else {
+        shared_modules_fft_window_float(bufinfo.buf, length, window);
+    }
+    #endif
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(fft_window_obj, 1, 2, fft_window);
+
+//| .. function:: magnitude(spectrum, output)
+//|
+//|   Writes the magnitudes of the bins of a spectrum from `rfft` into output, from the zero
+//|   frequency bin up to the one before the middle. output must have the same type as spectrum and
+//|   room for half as many values. It may be spectrum itself.
+//|
+STATIC mp_obj_t fft_magnitude(mp_obj_t spectrum, mp_obj_t output) {
+    mp_buffer_info_t bufinfo;
+    uint32_t length;
+    char typecode = get_samples(spectrum, &bufinfo, &length);
+    mp_buffer_info_t output_bufinfo;
+    mp_get_buffer_raise(output, &output_bufinfo, MP_BUFFER_WRITE);
+    if (output_bufinfo.typecode != typecode) {
+        mp_raise_ValueError(translate("Output must have the same type as the spectrum"));
+    }
+    size_t size = typecode == 'h' ? sizeof(int16_t) : sizeof(float);
+    if (output_bufinfo.len / size < length / 2) {
+        mp_raise_ValueError(translate("Output buffer too small"));
+    }
+    if (typecode == 'h') {
+        shared_modules_fft_magnitude_q15(bufinfo.buf, output_bufinfo.buf, length);
+    }
+    #if CIRCUITPY_FFT_FLOAT
+    else {
+        shared_modules_fft_magnitude_float(bufinfo.buf, output_bufinfo.buf, length);
+    }
+    #endif
+    return mp_const_none;
+}
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(fft_magnitude_obj, fft_magnitude);
+
+//| .. data:: HANN
+//|
+//|   Raised cosine window.
+//|
+//| .. data:: HAMMING
+//|
+//|   Raised cosine window that doesn't reach zero. It has a narrower peak than `HANN` but its
+//|   leakage falls off more slowly.
+//|
+//| .. data:: BLACKMAN
+//|
+//|   Window with a wider peak and much less leakage than `HANN`.
+//|
+STATIC const mp_rom_map_elem_t fft_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_fft) },
+    { MP_ROM_QSTR(MP_QSTR_rfft), MP_ROM_PTR(&fft_rfft_obj) },
+    { MP_ROM_QSTR(MP_QSTR_window), MP_ROM_PTR(&fft_window_obj) },
+    { MP_ROM_QSTR(MP_QSTR_magnitude), MP_ROM_PTR(&fft_magnitude_obj) },
+    { MP_ROM_QSTR(MP_QSTR_HANN), MP_ROM_INT(FFT_WINDOW_HANN) },
+    { MP_ROM_QSTR(MP_QSTR_HAMMING), MP_ROM_INT(FFT_WINDOW_HAMMING) },
+    { MP_ROM_QSTR(MP_QSTR_BLACKMAN), MP_ROM_INT(FFT_WINDOW_BLACKMAN) },
+};
+
+STATIC MP_DEFINE_CONST_DICT(fft_module_globals, fft_module_globals_table);
+
+const mp_obj_module_t fft_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&fft_module_globals,
+};
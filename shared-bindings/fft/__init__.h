@@ -0,0 +1,56 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_BINDINGS_FFT___INIT___H
+#define MICROPY_INCLUDED_SHARED_BINDINGS_FFT___INIT___H
+
+#include <stdint.h>
+
+// Transforms and windows work on a power of two samples from FFT_MIN_LENGTH to FFT_MAX_LENGTH.
+#define FFT_MIN_LENGTH (16)
+#define FFT_MAX_LENGTH (2048)
+
+typedef enum {
+    FFT_WINDOW_HANN,
+    FFT_WINDOW_HAMMING,
+    FFT_WINDOW_BLACKMAN,
+} fft_window_t;
+
+// The transforms work in place. The result is packed into the input as the real parts of the
+// first and middle bins followed by the real and imaginary parts of the bins in between. The fixed
+// point transform scales the result by 1 / length so it can't overflow.
+void shared_modules_fft_rfft_q15(int16_t* data, uint32_t length);
+void shared_modules_fft_window_q15(int16_t* data, uint32_t length, fft_window_t window);
+// Writes length / 2 magnitudes, the first bin to the one before the middle. output may be spectrum.
+void shared_modules_fft_magnitude_q15(const int16_t* spectrum, int16_t* output, uint32_t length);
+
+#if CIRCUITPY_FFT_FLOAT
+void shared_modules_fft_rfft_float(float* data, uint32_t length);
+void shared_modules_fft_window_float(float* data, uint32_t length, fft_window_t window);
+void shared_modules_fft_magnitude_float(const float* spectrum, float* output, uint32_t length);
+#endif
+
+#endif  // MICROPY_INCLUDED_SHARED_BINDINGS_FFT___INIT___H
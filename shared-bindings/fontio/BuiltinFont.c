@@ -52,8 +52,8 @@
 
 //|   .. attribute:: bitmap
 //|
-//|     Bitmap containing all font glyphs starting with ASCII and followed by unicode. Use
-//|     `get_glyph` in most cases. This is useful for use with `displayio.TileGrid` and
+//|     Bitmap containing all font glyphs starting with ASCII and followed by unicode in codepoint
+//|     order. Use `get_glyph` in most cases. This is useful for use with `displayio.TileGrid` and
 //|     `terminalio.Terminal`.
 //|
 STATIC mp_obj_t fontio_builtinfont_obj_get_bitmap(mp_obj_t self_in) {
@@ -29,37 +29,60 @@
 #include "py/objarray.h"
 #include "py/runtime.h"
 #include "PixelBuf.h"
+#include <math.h>
 #include <string.h>
 
 void pixelbuf_set_pixel_int(uint8_t *buf, mp_int_t value, pixelbuf_byteorder_obj_t *byteorder) {
     buf[byteorder->byteorder.r] = value >> 16 & 0xff;
     buf[byteorder->byteorder.g] = (value >> 8) & 0xff;
     buf[byteorder->byteorder.b] = value & 0xff;
-    if (byteorder->bpp == 4 && byteorder->has_white && 
-            (buf[byteorder->byteorder.r] == buf[byteorder->byteorder.g] && 
-                buf[byteorder->byteorder.r] == buf[byteorder->byteorder.b])) {
-        buf[byteorder->byteorder.w] = buf[byteorder->byteorder.r];
-        buf[byteorder->byteorder.r] = buf[byteorder->byteorder.g] = buf[byteorder->byteorder.b] = 0;
+    if (byteorder->bpp == 4 && byteorder->has_white) {
+        if (buf[byteorder->byteorder.r] == buf[byteorder->byteorder.g] &&
+                buf[byteorder->byteorder.r] == buf[byteorder->byteorder.b]) {
+            buf[byteorder->byteorder.w] = buf[byteorder->byteorder.r];
+            buf[byteorder->byteorder.r] = buf[byteorder->byteorder.g] = buf[byteorder->byteorder.b] = 0;
+        } else {
+            buf[byteorder->byteorder.w] = 0;
+        }
+    }
+}
+
+void pixelbuf_fill_brightness_lut(uint8_t *lut, mp_float_t brightness, mp_float_t gamma) {
+    for (uint i = 0; i < 256; i++) {
+        mp_float_t value = i;
+        if (gamma != 1) {
+            value = MICROPY_FLOAT_C_FUN(pow)(i / MICROPY_FLOAT_CONST(255.0), gamma) * 255;
+        }
+        lut[i] = value * brightness;
     }
 }
 
-void pixelbuf_set_pixel(uint8_t *buf, uint8_t *rawbuf, float brightness, mp_obj_t *item, pixelbuf_byteorder_obj_t *byteorder, bool dotstar) {
+void pixelbuf_apply_brightness(uint8_t *buf, const uint8_t *rawbuf, size_t len, const uint8_t *lut, bool dotstar) {
+    if (lut == NULL) {
+        if (buf != rawbuf) {
+            memcpy(buf, rawbuf, len);
+        }
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        // Per-pixel luminance bytes in dotstar mode are copied as is.
+        if (dotstar && i % 4 == 0) {
+            buf[i] = rawbuf[i];
+        } else {
+            buf[i] = lut[rawbuf[i]];
+        }
+    }
+}
+
+void pixelbuf_set_pixel(uint8_t *buf, uint8_t *rawbuf, const uint8_t *lut, mp_obj_t *item, pixelbuf_byteorder_obj_t *byteorder, bool dotstar) {
+    // Store the unscaled values in rawbuf when there is one and scale them into buf afterwards.
+    uint8_t *target = rawbuf ? rawbuf : buf;
+    bool set_w;
     if (MP_OBJ_IS_INT(item)) {
-        uint8_t *target = rawbuf ? rawbuf : buf;
         pixelbuf_set_pixel_int(target, mp_obj_get_int_truncated(item), byteorder);
-         if (dotstar) {
-            buf[0] = DOTSTAR_LED_START_FULL_BRIGHT;
-            if (rawbuf) 
-                rawbuf[0] = DOTSTAR_LED_START_FULL_BRIGHT;
-         }
-        if (rawbuf) {
-            buf[byteorder->byteorder.r] = rawbuf[byteorder->byteorder.r] * brightness;
-            buf[byteorder->byteorder.g] = rawbuf[byteorder->byteorder.g] * brightness;
-            buf[byteorder->byteorder.b] = rawbuf[byteorder->byteorder.b] * brightness;
-        } else {
-            buf[byteorder->byteorder.r] *= brightness;
-            buf[byteorder->byteorder.g] *= brightness;
-            buf[byteorder->byteorder.b] *= brightness;
+        set_w = byteorder->has_white;
+        if (dotstar) {
+            target[0] = DOTSTAR_LED_START_FULL_BRIGHT;
         }
     } else {
         mp_obj_t *items;
@@ -67,53 +90,121 @@ void pixelbuf_set_pixel(uint8_t *buf, uint8_t *rawbuf, float brightness, mp_obj_
         mp_obj_get_array(item, &len, &items);
         if (len != byteorder->bpp && !dotstar) 
             mp_raise_ValueError_varg(translate("Expected tuple of length %d, got %d"), byteorder->bpp, len);
+        set_w = len > 3;
 
-        buf[byteorder->byteorder.r] = mp_obj_get_int_truncated(items[PIXEL_R]) * brightness;
-        buf[byteorder->byteorder.g] = mp_obj_get_int_truncated(items[PIXEL_G]) * brightness;
-        buf[byteorder->byteorder.b] = mp_obj_get_int_truncated(items[PIXEL_B]) * brightness;
-        if (rawbuf) {
-            rawbuf[byteorder->byteorder.r] = mp_obj_get_int_truncated(items[PIXEL_R]);
-            rawbuf[byteorder->byteorder.g] = mp_obj_get_int_truncated(items[PIXEL_G]);
-            rawbuf[byteorder->byteorder.b] = mp_obj_get_int_truncated(items[PIXEL_B]);
-        }
+        target[byteorder->byteorder.r] = mp_obj_get_int_truncated(items[PIXEL_R]);
+        target[byteorder->byteorder.g] = mp_obj_get_int_truncated(items[PIXEL_G]);
+        target[byteorder->byteorder.b] = mp_obj_get_int_truncated(items[PIXEL_B]);
         if (len > 3) {
             if (dotstar) {
-                buf[byteorder->byteorder.w] = DOTSTAR_LED_START | DOTSTAR_BRIGHTNESS(mp_obj_get_float(items[PIXEL_W]));
-                if (rawbuf)
-                    rawbuf[byteorder->byteorder.w] = buf[byteorder->byteorder.w];
+                target[byteorder->byteorder.w] = DOTSTAR_LED_START | DOTSTAR_BRIGHTNESS(mp_obj_get_float(items[PIXEL_W]));
             } else {
-                buf[byteorder->byteorder.w] = mp_obj_get_int_truncated(items[PIXEL_W]) * brightness;
-                if (rawbuf)
-                    rawbuf[byteorder->byteorder.w] = mp_obj_get_int_truncated(items[PIXEL_W]);
+                target[byteorder->byteorder.w] = mp_obj_get_int_truncated(items[PIXEL_W]);
             }
         } else if (dotstar) {
-            buf[byteorder->byteorder.w] = DOTSTAR_LED_START_FULL_BRIGHT;
-            if (rawbuf)
-                rawbuf[byteorder->byteorder.w] = DOTSTAR_LED_START_FULL_BRIGHT;
+            target[byteorder->byteorder.w] = DOTSTAR_LED_START_FULL_BRIGHT;
+        }
+    }
+    // buf is NULL when brightness is only applied on show().
+    if (buf == NULL) {
+        return;
+    }
+    if (buf != target) {
+        memcpy(buf, target, dotstar ? 4 : byteorder->bpp);
+    }
+    if (lut != NULL) {
+        buf[byteorder->byteorder.r] = lut[target[byteorder->byteorder.r]];
+        buf[byteorder->byteorder.g] = lut[target[byteorder->byteorder.g]];
+        buf[byteorder->byteorder.b] = lut[target[byteorder->byteorder.b]];
+        // Without rawbuf, scaling a value that wasn't just set would scale it again.
+        if (byteorder->bpp == 4 && !dotstar && (set_w || rawbuf != NULL)) {
+            buf[byteorder->byteorder.w] = lut[target[byteorder->byteorder.w]];
+        }
+    }
+}
+
+void pixelbuf_fill(uint8_t *buf, size_t pixels, size_t step) {
+    // Copy the first pixel over the rest, doubling the copied run each time.
+    size_t filled = step;
+    size_t len = pixels * step;
+    while (filled < len) {
+        size_t n = filled < len - filled ? filled : len - filled;
+        memcpy(buf + filled, buf, n);
+        filled += n;
+    }
+}
+
+STATIC void reverse_pixels(uint8_t *buf, size_t start, size_t end, size_t step) {
+    uint8_t *left = buf + start * step;
+    uint8_t *right = buf + (end - 1) * step;
+    while (left < right) {
+        for (size_t i = 0; i < step; i++) {
+            uint8_t temp = left[i];
+            left[i] = right[i];
+            right[i] = temp;
+        }
+        left += step;
+        right -= step;
+    }
+}
+
+void pixelbuf_rotate(uint8_t *buf, size_t pixels, size_t step, mp_int_t n) {
+    if (pixels == 0) {
+        return;
+    }
+    // Rotating right by n is rotating left by pixels - n. Rotate left in place by reversing both
+    // parts and then the whole buffer.
+    size_t left = (pixels - (n % (mp_int_t)pixels)) % pixels;
+    if (left == 0) {
+        return;
+    }
+    reverse_pixels(buf, 0, left, step);
+    reverse_pixels(buf, left, pixels, step);
+    reverse_pixels(buf, 0, pixels, step);
+}
+
+void pixelbuf_shift(uint8_t *buf, size_t pixels, size_t step, mp_int_t n, bool dotstar) {
+    size_t count = n < 0 ? -n : n;
+    if (count > pixels) {
+        count = pixels;
+    }
+    size_t kept = (pixels - count) * step;
+    uint8_t *cleared;
+    if (n > 0) {
+        memmove(buf + count * step, buf, kept);
+        cleared = buf;
+    } else {
+        memmove(buf, buf + count * step, kept);
+        cleared = buf + kept;
+    }
+    memset(cleared, 0, count * step);
+    if (dotstar) {
+        for (size_t i = 0; i < count * step; i += 4) {
+            cleared[i] = DOTSTAR_LED_START_FULL_BRIGHT;
         }
     }
 }
 
 mp_obj_t *pixelbuf_get_pixel_array(uint8_t *buf, uint len, pixelbuf_byteorder_obj_t *byteorder, uint8_t step, bool dotstar) {
-    mp_obj_t elems[len];
+    mp_obj_tuple_t *t = MP_OBJ_TO_PTR(mp_obj_new_tuple(len, NULL));
     for (uint i = 0; i < len; i++) {
-        elems[i] = pixelbuf_get_pixel(buf + (i * step), byteorder, dotstar);
+        t->items[i] = pixelbuf_get_pixel(buf + (i * step), byteorder, dotstar);
     }
-    return mp_obj_new_tuple(len, elems);
+    return MP_OBJ_FROM_PTR(t);
 }
 
 mp_obj_t *pixelbuf_get_pixel(uint8_t *buf, pixelbuf_byteorder_obj_t *byteorder, bool dotstar) {
     mp_obj_t elems[byteorder->bpp];
    
-    elems[0] = mp_obj_new_int(buf[byteorder->byteorder.r]);
-    elems[1] = mp_obj_new_int(buf[byteorder->byteorder.g]);
-    elems[2] = mp_obj_new_int(buf[byteorder->byteorder.b]);
+    elems[0] = MP_OBJ_NEW_SMALL_INT(buf[byteorder->byteorder.r]);
+    elems[1] = MP_OBJ_NEW_SMALL_INT(buf[byteorder->byteorder.g]);
+    elems[2] = MP_OBJ_NEW_SMALL_INT(buf[byteorder->byteorder.b]);
     if (byteorder->bpp > 3)
     {
         if (dotstar)
             elems[3] = mp_obj_new_float(DOTSTAR_GET_BRIGHTNESS(buf[byteorder->byteorder.w]));
         else
-            elems[3] = mp_obj_new_int(buf[byteorder->byteorder.w]);
+            elems[3] = MP_OBJ_NEW_SMALL_INT(buf[byteorder->byteorder.w]);
     }
 
     return mp_obj_new_tuple(byteorder->bpp, elems);
@@ -42,9 +42,20 @@
 #define DOTSTAR_GET_BRIGHTNESS(value) ((value & 0b00011111) / 31.0)
 #define DOTSTAR_LED_START_FULL_BRIGHT 0xFF
 
-void pixelbuf_set_pixel(uint8_t *buf, uint8_t *rawbuf, float brightness, mp_obj_t *item, pixelbuf_byteorder_obj_t *byteorder, bool dotstar);
+// Fills lut with the scaled value for each possible channel value. A gamma of 1 is linear.
+void pixelbuf_fill_brightness_lut(uint8_t *lut, mp_float_t brightness, mp_float_t gamma);
+// Scales len bytes of rawbuf into buf. lut is NULL when no scaling is needed. buf and rawbuf may be
+// the same.
+void pixelbuf_apply_brightness(uint8_t *buf, const uint8_t *rawbuf, size_t len, const uint8_t *lut, bool dotstar);
+void pixelbuf_set_pixel(uint8_t *buf, uint8_t *rawbuf, const uint8_t *lut, mp_obj_t *item, pixelbuf_byteorder_obj_t *byteorder, bool dotstar);
 mp_obj_t *pixelbuf_get_pixel(uint8_t *buf, pixelbuf_byteorder_obj_t *byteorder, bool dotstar);
 mp_obj_t *pixelbuf_get_pixel_array(uint8_t *buf, uint len, pixelbuf_byteorder_obj_t *byteorder, uint8_t step, bool dotstar);
 void pixelbuf_set_pixel_int(uint8_t *buf, mp_int_t value, pixelbuf_byteorder_obj_t *byteorder);
+// Copies the first pixel over all of the others.
+void pixelbuf_fill(uint8_t *buf, size_t pixels, size_t step);
+// Moves every pixel n places towards the end, wrapping around.
+void pixelbuf_rotate(uint8_t *buf, size_t pixels, size_t step, mp_int_t n);
+// Moves every pixel n places towards the end and turns off the pixels left behind.
+void pixelbuf_shift(uint8_t *buf, size_t pixels, size_t step, mp_int_t n, bool dotstar);
 
 #endif
@@ -28,78 +28,124 @@
 #include "__init__.h"
 
 
-// Get the color of the pixel on the layer.
-uint16_t get_layer_pixel(layer_obj_t *layer, uint16_t x, uint16_t y) {
-
-    // Shift by the layer's position offset.
-    x -= layer->x;
-    y -= layer->y;
-
-    // Bounds check.
-    if ((x < 0) || (x >= layer->width << 4) ||
-            (y < 0) || (y >= layer->height << 4)) {
-        return TRANSPARENT;
-    }
-
-    // Get the tile from the grid location or from sprite frame.
-    uint8_t frame = layer->frame;
-    if (layer->map) {
-        uint8_t tx = x >> 4;
-        uint8_t ty = y >> 4;
-
-        frame = layer->map[(ty * layer->width + tx) >> 1];
-        if (tx & 0x01) {
-            frame &= 0x0f;
-        } else {
-            frame >>= 4;
-        }
-    }
-
-    // Get the position within the tile.
-    x &= 0x0f;
-    y &= 0x0f;
-
-    // Rotate the image.
-    uint8_t ty = y; // Temporary variable for swapping.
+// Decode row y of the frame's graphic, as rotated, into colors.
+static void get_layer_strip(layer_obj_t *layer, uint8_t frame, uint8_t y, uint16_t *strip) {
+    // Position of the first pixel in the graphic and the step to the next one.
+    int8_t gx = 0;
+    int8_t gy = y;
+    int8_t dx = 1;
+    int8_t dy = 0;
     switch (layer->rotation) {
         case 1: // 90 degrees clockwise
-            y = 15 - x;
-            x = ty;
+            gx = y;
+            gy = 15;
+            dx = 0;
+            dy = -1;
             break;
         case 2: // 180 degrees
-            y = 15 - ty;
-            x = 15 - x;
+            gx = 15;
+            gy = 15 - y;
+            dx = -1;
             break;
         case 3: // 90 degrees counter-clockwise
-            y = x;
-            x = 15 - ty;
+            gx = 15 - y;
+            gy = 0;
+            dx = 0;
+            dy = 1;
             break;
         case 4: // 0 degrees, mirrored
-            x = 15 - x;
+            gx = 15;
+            dx = -1;
             break;
         case 5: // 90 degrees clockwise, mirrored
-            y = x;
-            x = ty;
+            gx = y;
+            gy = 0;
+            dx = 0;
+            dy = 1;
             break;
         case 6: // 180 degrees, mirrored
-            y = 15 - ty;
+            gy = 15 - y;
             break;
         case 7: // 90 degrees counter-clockwise, mirrored
-            y = 15 - x;
-            x = 15 - ty;
+            gx = 15 - y;
+            gy = 15;
+            dx = 0;
+            dy = -1;
             break;
         default: // 0 degrees
             break;
     }
 
-    // Get the value of the pixel.
-    uint8_t pixel = layer->graphic[(frame << 7) + (y << 3) + (x >> 1)];
-    if (x & 0x01) {
-        pixel &= 0x0f;
-    } else {
-        pixel >>= 4;
+    const uint8_t *graphic = layer->graphic + (frame << 7);
+    for (uint8_t x = 0; x < 16; ++x) {
+        // Get the value of the pixel.
+        uint8_t pixel = graphic[(gy << 3) + (gx >> 1)];
+        if (gx & 0x01) {
+            pixel &= 0x0f;
+        } else {
+            pixel >>= 4;
+        }
+        // Convert to 16-bit color using the palette.
+        strip[x] = layer->palette[pixel << 1] | layer->palette[(pixel << 1) + 1] << 8;
+        gx += dx;
+        gy += dy;
     }
+}
 
-    // Convert to 16-bit color using the palette.
-    return layer->palette[pixel << 1] | layer->palette[(pixel << 1) + 1] << 8;
+// Fill in the transparent pixels of a row of the screen with the layer.
+uint16_t fill_layer_row(layer_obj_t *layer, int16_t x0, int16_t y, uint16_t width,
+        uint16_t *row) {
+
+    // Shift by the layer's position offset.
+    int32_t ly = y - layer->y;
+    int32_t lx0 = x0 - layer->x;
+
+    // Bounds check.
+    if ((ly < 0) || (ly >= layer->height << 4)) {
+        return 0;
+    }
+    int32_t start = lx0 > 0 ? lx0 : 0;
+    int32_t end = lx0 + width;
+    if (end > layer->width << 4) {
+        end = layer->width << 4;
+    }
+
+    // Consecutive tiles often use the same frame so keep the last one decoded.
+    uint16_t strip[16];
+    int16_t strip_frame = -1;
+    uint16_t filled = 0;
+    int32_t lx = start;
+    while (lx < end) {
+        // Get the tile from the grid location or from sprite frame.
+        uint8_t tx = lx >> 4;
+        uint8_t frame = layer->frame;
+        if (layer->map) {
+            uint8_t ty = ly >> 4;
+
+            frame = layer->map[(ty * layer->width + tx) >> 1];
+            if (tx & 0x01) {
+                frame &= 0x0f;
+            } else {
+                frame >>= 4;
+            }
+        }
+        if (frame != strip_frame) {
+            get_layer_strip(layer, frame, ly & 0x0f, strip);
+            strip_frame = frame;
+        }
+
+        int32_t tile_end = (tx + 1) << 4;
+        if (tile_end > end) {
+            tile_end = end;
+        }
+        uint16_t *pixel = row + (lx - lx0);
+        for (; lx < tile_end; ++lx, ++pixel) {
+            uint16_t c = strip[lx & 0x0f];
+            if (*pixel == TRANSPARENT && c != TRANSPARENT) {
+                *pixel = c;
+                filled += 1;
+            }
+        }
+    }
+    return filled;
 }
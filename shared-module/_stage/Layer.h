@@ -43,6 +43,9 @@ typedef struct {
     uint8_t rotation;
 } layer_obj_t;
 
-uint16_t get_layer_pixel(layer_obj_t *layer, uint16_t x, uint16_t y);
+// Fill in the pixels of row that are still TRANSPARENT with the layer's pixels on line y of the
+// screen. The row starts at x0 and is width pixels long. Returns how many pixels were filled in.
+uint16_t fill_layer_row(layer_obj_t *layer, int16_t x0, int16_t y, uint16_t width,
+        uint16_t *row);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE__STAGE_LAYER
@@ -28,40 +28,69 @@
 #include "__init__.h"
 
 
-// Get the color of the pixel on the text.
-uint16_t get_text_pixel(text_obj_t *text, uint16_t x, uint16_t y) {
-
-    // Shift by the text's position offset.
-    x -= text->x;
-    y -= text->y;
-
-    // Bounds check.
-    if ((x < 0) || (x >= text->width << 3) ||
-            (y < 0) || (y >= text->height << 3)) {
-        return TRANSPARENT;
-    }
-
-    // Get the tile from the grid location or from sprite frame.
-    uint8_t tx = x >> 3;
-    uint8_t ty = y >> 3;
-    uint8_t c = text->chars[ty * text->width + tx];
+// Decode row y of the character, including its color offset, into colors.
+static void get_text_strip(text_obj_t *text, uint8_t c, uint8_t y, uint16_t *strip) {
     uint8_t color_offset = 0;
     if (c & 0x80) {
         color_offset = 4;
     }
     c &= 0x7f;
-    if (!c) {
-        return TRANSPARENT;
+
+    const uint8_t *font = text->font + (c << 4) + (y << 1);
+    for (uint8_t x = 0; x < 8; ++x) {
+        // Get the value of the pixel.
+        uint8_t pixel = ((font[x >> 2] >> ((x & 0x03) << 1)) & 0x03) + color_offset;
+        // Convert to 16-bit color using the palette.
+        strip[x] = text->palette[pixel << 1] | text->palette[(pixel << 1) + 1] << 8;
     }
+}
 
-    // Get the position within the char.
-    x &= 0x07;
-    y &= 0x07;
+// Fill in the transparent pixels of a row of the screen with the text.
+uint16_t fill_text_row(text_obj_t *text, int16_t x0, int16_t y, uint16_t width,
+        uint16_t *row) {
 
-    // Get the value of the pixel.
-    uint8_t pixel = text->font[(c << 4) + (y << 1) + (x >> 2)];
-    pixel = ((pixel >> ((x & 0x03) << 1)) & 0x03) + color_offset;
+    // Shift by the text's position offset.
+    int32_t ty = y - text->y;
+    int32_t tx0 = x0 - text->x;
 
-    // Convert to 16-bit color using the palette.
-    return text->palette[pixel << 1] | text->palette[(pixel << 1) + 1] << 8;
+    // Bounds check.
+    if ((ty < 0) || (ty >= text->height << 3)) {
+        return 0;
+    }
+    int32_t start = tx0 > 0 ? tx0 : 0;
+    int32_t end = tx0 + width;
+    if (end > text->width << 3) {
+        end = text->width << 3;
+    }
+
+    const uint8_t *chars = text->chars + (ty >> 3) * text->width;
+    uint16_t strip[8];
+    int16_t strip_char = -1;
+    uint16_t filled = 0;
+    int32_t tx = start;
+    while (tx < end) {
+        uint8_t c = chars[tx >> 3];
+        int32_t char_end = ((tx >> 3) + 1) << 3;
+        if (char_end > end) {
+            char_end = end;
+        }
+        // Character 0 is blank.
+        if (!(c & 0x7f)) {
+            tx = char_end;
+            continue;
+        }
+        if (c != strip_char) {
+            get_text_strip(text, c, ty & 0x07, strip);
+            strip_char = c;
+        }
+        uint16_t *pixel = row + (tx - tx0);
+        for (; tx < char_end; ++tx, ++pixel) {
+            uint16_t color = strip[tx & 0x07];
+            if (*pixel == TRANSPARENT && color != TRANSPARENT) {
+                *pixel = color;
+                filled += 1;
+            }
+        }
+    }
+    return filled;
 }
@@ -41,6 +41,8 @@ typedef struct {
     uint8_t width, height;
 } text_obj_t;
 
-uint16_t get_text_pixel(text_obj_t *text, uint16_t x, uint16_t y);
+// Like fill_layer_row, but for the text.
+uint16_t fill_text_row(text_obj_t *text, int16_t x0, int16_t y, uint16_t width,
+        uint16_t *row);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE__STAGE_TEXT
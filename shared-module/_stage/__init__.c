@@ -36,21 +36,32 @@ void render_stage(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
         uint16_t *buffer, size_t buffer_size,
         displayio_display_obj_t *display) {
 
+    if (x1 <= x0) {
+        return;
+    }
+    uint16_t width = x1 - x0;
+    uint16_t row[width];
+
     size_t index = 0;
     for (uint16_t y = y0; y < y1; ++y) {
-        for (uint16_t x = x0; x < x1; ++x) {
-            for (size_t layer = 0; layer < layers_size; ++layer) {
-                uint16_t c = TRANSPARENT;
-                layer_obj_t *obj = MP_OBJ_TO_PTR(layers[layer]);
-                if (obj->base.type == &mp_type_layer) {
-                    c = get_layer_pixel(obj, x, y);
-                } else if (obj->base.type == &mp_type_text) {
-                    c = get_text_pixel((text_obj_t *)obj, x, y);
-                }
-                if (c != TRANSPARENT) {
-                    buffer[index] = c;
-                    break;
-                }
+        for (uint16_t x = 0; x < width; ++x) {
+            row[x] = TRANSPARENT;
+        }
+        // The layers go from front to back, so each one only fills in the pixels that are still
+        // transparent, and the rest can be skipped once there are none left.
+        uint16_t transparent = width;
+        for (size_t layer = 0; layer < layers_size && transparent > 0; ++layer) {
+            layer_obj_t *obj = MP_OBJ_TO_PTR(layers[layer]);
+            if (obj->base.type == &mp_type_layer) {
+                transparent -= fill_layer_row(obj, x0, y, width, row);
+            } else if (obj->base.type == &mp_type_text) {
+                transparent -= fill_text_row((text_obj_t *)obj, x0, y, width, row);
+            }
+        }
+        for (uint16_t x = 0; x < width; ++x) {
+            // Pixels without any layer keep what was in the buffer.
+            if (row[x] != TRANSPARENT) {
+                buffer[index] = row[x];
             }
             index += 1;
             // The buffer is full, send it.
@@ -0,0 +1,272 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audiobusio/PDMDecimator.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+
+// The first eight bits of each CIC decimation are summed by table lookup. The table for nibble n
+// holds the taps of a third order, eight wide boxcar that fall on the nth nibble of the last three
+// bytes, counting from the newest. A byte of ones sums to 512 over its three bytes.
+STATIC const uint8_t cic_nibble_taps[6][16] = {
+    {0, 1, 3, 4, 6, 7, 9, 10, 10, 11, 13, 14, 16, 17, 19, 20},
+    {0, 15, 21, 36, 28, 43, 49, 64, 36, 51, 57, 72, 64, 79, 85, 100},
+    {0, 42, 46, 88, 48, 90, 94, 136, 48, 90, 94, 136, 96, 138, 142, 184},
+    {0, 46, 42, 88, 36, 82, 78, 124, 28, 74, 70, 116, 64, 110, 106, 152},
+    {0, 21, 15, 36, 10, 31, 25, 46, 6, 27, 21, 42, 16, 37, 31, 52},
+    {0, 3, 1, 4, 0, 3, 1, 4, 0, 3, 1, 4, 0, 3, 1, 4},
+};
+
+// First half and center of the symmetric Q15 filter that takes the CIC output down to the sample
+// rate. It flattens the CIC droop up to 0.4 of the sample rate and is at least 50dB down from 0.6
+// of the sample rate on, so little aliases when every other sample is dropped. It was designed by
+// weighted least squares for 32x CIC decimation. The droop barely changes for the other ratios.
+STATIC const int16_t compensation_taps[AUDIOBUSIO_PDM_FIR_TAPS / 2 + 1] = {
+    -19, 51, 122, -95, -311, 147, 643, -192, -1199, 199, 2162, -78, -4141, -716, 10944, 17734
+};
+
+// CIC outputs replaced with silence after a reset while the filter fills with real data.
+#define CIC_SETTLING_OUTPUTS (4)
+
+void common_hal_audiobusio_pdmdecimator_construct(audiobusio_pdmdecimator_obj_t* self,
+                                                  uint16_t oversample, uint8_t bit_depth,
+                                                  uint32_t buffer_size) {
+    self->oversample = oversample;
+    self->bit_depth = bit_depth;
+
+    // The table lookup decimates by eight and the CIC integrators and combs by the rest of half
+    // of the oversampling. A third order CIC decimating by 2 ** k outputs 0 to 2 ** 3k.
+    self->cic_decimation = oversample / 16;
+    uint8_t cic_bits = 0;
+    while ((1 << cic_bits) < oversample / 2) {
+        cic_bits++;
+    }
+    cic_bits *= 3;
+    self->scale_left = cic_bits < 16 ? 16 - cic_bits : 0;
+    self->scale_right = cic_bits > 16 ? cic_bits - 16 : 0;
+
+    uint32_t ring_size = 2;
+    while (ring_size < buffer_size) {
+        ring_size <<= 1;
+    }
+    self->ring = m_malloc(ring_size, false);
+    self->ring_size = ring_size;
+
+    audiobusio_pdmdecimator_reset(self);
+}
+
+bool common_hal_audiobusio_pdmdecimator_deinited(audiobusio_pdmdecimator_obj_t* self) {
+    return self->ring == NULL;
+}
+
+void common_hal_audiobusio_pdmdecimator_deinit(audiobusio_pdmdecimator_obj_t* self) {
+    self->ring = NULL;
+}
+
+void audiobusio_pdmdecimator_reset(audiobusio_pdmdecimator_obj_t* self) {
+    self->cic_count = self->cic_decimation;
+    self->settling = CIC_SETTLING_OUTPUTS;
+    self->previous[0] = 0;
+    self->previous[1] = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+        self->integrator[i] = 0;
+        self->comb[i] = 0;
+    }
+    memset(self->history, 0, sizeof(self->history));
+    self->history_index = 0;
+    self->odd = false;
+    self->write_index = 0;
+    self->read_index = 0;
+    self->overruns = 0;
+}
+
+uint32_t audiobusio_pdmdecimator_decimate(audiobusio_pdmdecimator_obj_t* self, const uint8_t* pdm,
+                                          uint32_t length, audiobusio_pdm_layout_t layout,
+                                          uint8_t* output) {
+    bool halfwords = layout == AUDIOBUSIO_PDM_LOW_HALFWORDS;
+    uint32_t byte_count = halfwords ? length / 2 : length;
+    uint8_t* output8 = output;
+    uint16_t* output16 = (uint16_t*) output;
+    bool eight_bit = self->bit_depth == 8;
+
+    // Work on copies of the state so the compiler can keep it in registers.
+    uint8_t previous0 = self->previous[0];
+    uint8_t previous1 = self->previous[1];
+    uint32_t integrator0 = self->integrator[0];
+    uint32_t integrator1 = self->integrator[1];
+    uint32_t integrator2 = self->integrator[2];
+    uint32_t cic_count = self->cic_count;
+    uint32_t cic_decimation = self->cic_decimation;
+    uint32_t settling = self->settling;
+    int32_t* history = self->history;
+    uint32_t history_index = self->history_index;
+    bool odd = self->odd;
+    uint32_t produced = 0;
+
+    for (uint32_t i = 0; i < byte_count; i++) {
+        // The low halfword of a little endian word has its first, most significant, byte at 1.
+        uint8_t b = halfwords ? pdm[((i >> 1) << 2) + 1 - (i & 1)] : pdm[i];
+        uint32_t sum = cic_nibble_taps[0][b & 0xf] + cic_nibble_taps[1][b >> 4] +
+                       cic_nibble_taps[2][previous0 & 0xf] + cic_nibble_taps[3][previous0 >> 4] +
+                       cic_nibble_taps[4][previous1 & 0xf] + cic_nibble_taps[5][previous1 >> 4];
+        previous1 = previous0;
+        previous0 = b;
+        // Unsigned overflow in the integrators cancels out in the combs.
+        integrator0 += sum;
+        integrator1 += integrator0;
+        integrator2 += integrator1;
+        if (--cic_count != 0) {
+            continue;
+        }
+        cic_count = cic_decimation;
+        uint32_t comb0 = integrator2 - self->comb[0];
+        self->comb[0] = integrator2;
+        uint32_t comb1 = comb0 - self->comb[1];
+        self->comb[1] = comb0;
+        uint32_t comb2 = comb1 - self->comb[2];
+        self->comb[2] = comb1;
+
+        // Q15 around the middle of the CIC's range.
+        int32_t x = 0;
+        if (settling > 0) {
+            settling--;
+        } else {
+            x = (((int32_t) comb2 << self->scale_left) >> self->scale_right) - 32768;
+        }
+        history[history_index] = x;
+        history[history_index + AUDIOBUSIO_PDM_FIR_TAPS] = x;
+        history_index++;
+        if (history_index == AUDIOBUSIO_PDM_FIR_TAPS) {
+            history_index = 0;
+        }
+        odd = !odd;
+        if (odd) {
+            continue;
+        }
+
+        const int32_t* taps = history + history_index;
+        int32_t value = compensation_taps[AUDIOBUSIO_PDM_FIR_TAPS / 2] * taps[AUDIOBUSIO_PDM_FIR_TAPS / 2];
+        for (uint32_t t = 0; t < AUDIOBUSIO_PDM_FIR_TAPS / 2; t++) {
+            value += compensation_taps[t] * (taps[t] + taps[AUDIOBUSIO_PDM_FIR_TAPS - 1 - t]);
+        }
+        value >>= 15;
+        if (value > 32767) {
+            value = 32767;
+        } else if (value < -32768) {
+            value = -32768;
+        }
+        uint16_t sample = value + 0x8000;
+        if (eight_bit) {
+            output8[produced] = sample >> 8;
+        } else {
+            output16[produced] = sample;
+        }
+        produced++;
+    }
+
+    self->previous[0] = previous0;
+    self->previous[1] = previous1;
+    self->integrator[0] = integrator0;
+    self->integrator[1] = integrator1;
+    self->integrator[2] = integrator2;
+    self->cic_count = cic_count;
+    self->settling = settling;
+    self->history_index = history_index;
+    self->odd = odd;
+    return produced;
+}
+
+void audiobusio_pdmdecimator_push(audiobusio_pdmdecimator_obj_t* self, const uint8_t* pdm,
+                                  uint32_t length, audiobusio_pdm_layout_t layout) {
+    uint16_t samples[32];
+    uint8_t bytes_per_sample = self->bit_depth / 8;
+    // Decimate a piece at a time small enough that it can't overfill samples even when the last
+    // call left a partial sample.
+    uint32_t piece = (MP_ARRAY_SIZE(samples) - 1) * self->oversample / 8;
+    if (layout == AUDIOBUSIO_PDM_LOW_HALFWORDS) {
+        piece *= 2;
+    }
+    uint32_t mask = self->ring_size - 1;
+    while (length > 0) {
+        uint32_t pdm_length = length < piece ? length : piece;
+        uint32_t count = audiobusio_pdmdecimator_decimate(self, pdm, pdm_length, layout,
+                                                          (uint8_t*) samples) * bytes_per_sample;
+        pdm += pdm_length;
+        length -= pdm_length;
+
+        uint32_t write_index = self->write_index;
+        uint32_t free = self->ring_size - (write_index - self->read_index);
+        if (count > free) {
+            self->overruns += (count - free) / bytes_per_sample;
+            count = free;
+        }
+        uint32_t start = write_index & mask;
+        uint32_t first = self->ring_size - start;
+        if (first > count) {
+            first = count;
+        }
+        memcpy(self->ring + start, samples, first);
+        memcpy(self->ring, ((uint8_t*) samples) + first, count - first);
+        // Publish the samples only once they are in the ring.
+        self->write_index = write_index + count;
+    }
+}
+
+void common_hal_audiobusio_pdmdecimator_write(audiobusio_pdmdecimator_obj_t* self,
+                                              const uint8_t* pdm, uint32_t length) {
+    audiobusio_pdmdecimator_push(self, pdm, length, AUDIOBUSIO_PDM_BYTES);
+}
+
+uint32_t common_hal_audiobusio_pdmdecimator_read(audiobusio_pdmdecimator_obj_t* self,
+                                                 uint8_t* data, uint32_t length) {
+    uint32_t read_index = self->read_index;
+    uint32_t available = self->write_index - read_index;
+    if (length > available) {
+        length = available;
+    }
+    length -= length % (self->bit_depth / 8);
+    uint32_t start = read_index & (self->ring_size - 1);
+    uint32_t first = self->ring_size - start;
+    if (first > length) {
+        first = length;
+    }
+    memcpy(data, self->ring + start, first);
+    memcpy(data + first, self->ring, length - first);
+    // Free the space only once the samples are copied out.
+    self->read_index = read_index + length;
+    return length;
+}
+
+uint32_t common_hal_audiobusio_pdmdecimator_get_in_waiting(audiobusio_pdmdecimator_obj_t* self) {
+    return self->write_index - self->read_index;
+}
+
+uint32_t common_hal_audiobusio_pdmdecimator_get_overruns(audiobusio_pdmdecimator_obj_t* self) {
+    return self->overruns;
+}
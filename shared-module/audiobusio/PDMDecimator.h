@@ -0,0 +1,94 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO_PDMDECIMATOR_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO_PDMDECIMATOR_H
+
+#include "py/obj.h"
+
+// Supported oversampling ratios. Each must be a power of two.
+#define AUDIOBUSIO_PDM_MIN_OVERSAMPLE (16)
+#define AUDIOBUSIO_PDM_MAX_OVERSAMPLE (256)
+// Taps of the compensation filter that does the last decimation by two.
+#define AUDIOBUSIO_PDM_FIR_TAPS (31)
+
+// How PDM bits are packed into the buffers given to the decimator. Bits are read most significant
+// first in both.
+typedef enum {
+    // Every byte holds eight bits.
+    AUDIOBUSIO_PDM_BYTES,
+    // Only the low 16 bits of each 32 bit word hold bits. This is how the SAMD I2S peripheral
+    // writes PDM2 data.
+    AUDIOBUSIO_PDM_LOW_HALFWORDS,
+} audiobusio_pdm_layout_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    uint16_t oversample;
+    uint8_t bit_depth;
+
+    // The first stage is a third order CIC filter running on whole bytes. Its output is scaled
+    // to Q15 by shifting left by scale_left and then right by scale_right.
+    uint8_t cic_decimation; // bytes per CIC output
+    uint8_t cic_count;
+    uint8_t settling;
+    uint8_t scale_left;
+    uint8_t scale_right;
+    uint8_t previous[2]; // The last two bytes, newest first.
+    uint32_t integrator[3];
+    uint32_t comb[3];
+
+    // The CIC outputs twice the sample rate. history holds the last AUDIOBUSIO_PDM_FIR_TAPS of them
+    // twice over so the taps are always contiguous from history + history_index.
+    int32_t history[AUDIOBUSIO_PDM_FIR_TAPS * 2];
+    uint8_t history_index;
+    bool odd;
+
+    // Single producer, single consumer ring of decimated samples. The indices run freely and
+    // are masked with ring_size - 1, so ring_size is a power of two.
+    uint8_t* ring;
+    uint32_t ring_size;
+    volatile uint32_t write_index;
+    volatile uint32_t read_index;
+    volatile uint32_t overruns; // samples dropped because the ring was full
+} audiobusio_pdmdecimator_obj_t;
+
+// Clears the filters and the ring.
+void audiobusio_pdmdecimator_reset(audiobusio_pdmdecimator_obj_t* self);
+
+// Decimates length bytes of PDM data into output as unsigned samples of the decimator's bit depth.
+// output must have room for length * 8 / oversample + 1 samples. Returns the number of samples
+// written.
+uint32_t audiobusio_pdmdecimator_decimate(audiobusio_pdmdecimator_obj_t* self, const uint8_t* pdm,
+                                          uint32_t length, audiobusio_pdm_layout_t layout,
+                                          uint8_t* output);
+
+// Decimates into the ring. Samples that don't fit are dropped and counted in overruns. This is the
+// producer side of the ring and may be called from a background task.
+void audiobusio_pdmdecimator_push(audiobusio_pdmdecimator_obj_t* self, const uint8_t* pdm,
+                                  uint32_t length, audiobusio_pdm_layout_t layout);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOBUSIO_PDMDECIMATOR_H
@@ -0,0 +1,142 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Biquad.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+// Converts a coefficient normalized by a0 to Q28, checking that it fits.
+static int32_t fixed_coefficient(mp_float_t value, mp_float_t a0) {
+    mp_float_t scaled = value / a0 * (1 << AUDIOIO_BIQUAD_COEFFICIENT_BITS);
+    mp_float_t limit = MICROPY_FLOAT_CONST(2147483647.0);
+    if (scaled >= limit || scaled <= -limit) {
+        mp_raise_ValueError(translate("Filter settings are out of range"));
+    }
+    return MICROPY_FLOAT_C_FUN(floor)(scaled + MICROPY_FLOAT_CONST(0.5));
+}
+
+void common_hal_audioio_biquad_construct(audioio_effect_obj_t* self, mp_obj_t sample,
+                                         audioio_biquad_mode_t mode, mp_float_t frequency,
+                                         mp_float_t q, mp_float_t gain, uint32_t buffer_size) {
+    audioio_effect_construct(self, AUDIOIO_EFFECT_BIQUAD, sample, buffer_size);
+    audioio_biquad_t* filter = &self->biquad;
+    memset(filter, 0, sizeof(audioio_biquad_t));
+    filter->mode = mode;
+
+    // Coefficients from Robert Bristow-Johnson's Audio EQ Cookbook.
+    mp_float_t w0 = 2 * AUDIOIO_EFFECT_PI * frequency / self->sample_rate;
+    mp_float_t cos_w0 = MICROPY_FLOAT_C_FUN(cos)(w0);
+    mp_float_t alpha = MICROPY_FLOAT_C_FUN(sin)(w0) / (2 * q);
+    mp_float_t a = MICROPY_FLOAT_C_FUN(pow)(10, gain / 40);
+    mp_float_t shelf = 2 * MICROPY_FLOAT_C_FUN(sqrt)(a) * alpha;
+    mp_float_t b0, b1, b2, a0, a1, a2;
+    if (mode == AUDIOIO_BIQUAD_LOWPASS) {
+        b0 = (1 - cos_w0) / 2;
+        b1 = 1 - cos_w0;
+        b2 = b0;
+        a0 = 1 + alpha;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha;
+    } else if (mode == AUDIOIO_BIQUAD_HIGHPASS) {
+        b0 = (1 + cos_w0) / 2;
+        b1 = -(1 + cos_w0);
+        b2 = b0;
+        a0 = 1 + alpha;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha;
+    } else if (mode == AUDIOIO_BIQUAD_BANDPASS) {
+        // Unity gain at the center frequency.
+        b0 = alpha;
+        b1 = 0;
+        b2 = -alpha;
+        a0 = 1 + alpha;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha;
+    } else if (mode == AUDIOIO_BIQUAD_LOWSHELF) {
+        b0 = a * ((a + 1) - (a - 1) * cos_w0 + shelf);
+        b1 = 2 * a * ((a - 1) - (a + 1) * cos_w0);
+        b2 = a * ((a + 1) - (a - 1) * cos_w0 - shelf);
+        a0 = (a + 1) + (a - 1) * cos_w0 + shelf;
+        a1 = -2 * ((a - 1) + (a + 1) * cos_w0);
+        a2 = (a + 1) + (a - 1) * cos_w0 - shelf;
+    } else {
+        b0 = a * ((a + 1) + (a - 1) * cos_w0 + shelf);
+        b1 = -2 * a * ((a - 1) + (a + 1) * cos_w0);
+        b2 = a * ((a + 1) + (a - 1) * cos_w0 - shelf);
+        a0 = (a + 1) - (a - 1) * cos_w0 + shelf;
+        a1 = 2 * ((a - 1) - (a + 1) * cos_w0);
+        a2 = (a + 1) - (a - 1) * cos_w0 - shelf;
+    }
+    filter->b0 = fixed_coefficient(b0, a0);
+    filter->b1 = fixed_coefficient(b1, a0);
+    filter->b2 = fixed_coefficient(b2, a0);
+    filter->a1 = fixed_coefficient(a1, a0);
+    filter->a2 = fixed_coefficient(a2, a0);
+}
+
+// Direct form I with 64 bit sums. Keeping the output history in more bits than the output stops
+// low cutoffs from settling short of the input.
+void audioio_biquad_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames) {
+    audioio_biquad_t* filter = &self->biquad;
+    const int32_t round = 1 << (AUDIOIO_BIQUAD_COEFFICIENT_BITS - 1);
+    const int32_t high = INT16_MAX << AUDIOIO_BIQUAD_HISTORY_BITS;
+    const int32_t low = INT16_MIN * (1 << AUDIOIO_BIQUAD_HISTORY_BITS);
+    uint8_t channels = self->channel_count;
+    for (uint8_t c = 0; c < channels; c++) {
+        int32_t x1 = filter->x1[c];
+        int32_t x2 = filter->x2[c];
+        int32_t y1 = filter->y1[c];
+        int32_t y2 = filter->y2[c];
+        int16_t* s = samples + c;
+        for (uint32_t i = 0; i < frames; i++) {
+            int32_t x0 = s[i * channels];
+            int64_t sum = ((int64_t) filter->b0 * x0 +
+                           (int64_t) filter->b1 * x1 +
+                           (int64_t) filter->b2 * x2) * (1 << AUDIOIO_BIQUAD_HISTORY_BITS);
+            sum -= (int64_t) filter->a1 * y1 + (int64_t) filter->a2 * y2;
+            int32_t y0 = (sum + round) >> AUDIOIO_BIQUAD_COEFFICIENT_BITS;
+            if (y0 > high) {
+                y0 = high;
+            } else if (y0 < low) {
+                y0 = low;
+            }
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            s[i * channels] = (y0 + (1 << (AUDIOIO_BIQUAD_HISTORY_BITS - 1))) >> AUDIOIO_BIQUAD_HISTORY_BITS;
+        }
+        filter->x1[c] = x1;
+        filter->x2[c] = x2;
+        filter->y1[c] = y1;
+        filter->y2[c] = y2;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Echo.h"
+#include "shared-bindings/audioio/Effect.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+void common_hal_audioio_echo_construct(audioio_effect_obj_t* self, mp_obj_t sample,
+                                       mp_float_t delay, mp_float_t feedback, mp_float_t mix,
+                                       uint32_t buffer_size) {
+    audioio_effect_construct(self, AUDIOIO_EFFECT_ECHO, sample, buffer_size);
+    audioio_echo_t* echo = &self->echo;
+    uint32_t frames = MICROPY_FLOAT_C_FUN(floor)(delay * self->sample_rate + MICROPY_FLOAT_CONST(0.5));
+    if (frames < 1) {
+        frames = 1;
+    }
+    echo->line_length = frames * self->channel_count;
+    echo->line = m_malloc(echo->line_length * sizeof(int16_t), false);
+    if (echo->line == NULL) {
+        common_hal_audioio_effect_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate delay line"));
+    }
+    memset(echo->line, 0, echo->line_length * sizeof(int16_t));
+    echo->position = 0;
+    echo->feedback = MICROPY_FLOAT_C_FUN(floor)(feedback * 32768 + MICROPY_FLOAT_CONST(0.5));
+    echo->mix = MICROPY_FLOAT_C_FUN(floor)(mix * 32768 + MICROPY_FLOAT_CONST(0.5));
+}
+
+static inline int16_t saturate(int32_t value) {
+    if (value > INT16_MAX) {
+        return INT16_MAX;
+    } else if (value < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return value;
+}
+
+// Each sample is mixed with the delay line and written back into it with the feedback so that
+// every echo is quieter than the last.
+void audioio_echo_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames) {
+    audioio_echo_t* echo = &self->echo;
+    int16_t* line = echo->line;
+    uint32_t position = echo->position;
+    uint32_t count = frames * self->channel_count;
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t delayed = line[position];
+        int32_t x = samples[i];
+        samples[i] = saturate(x + ((delayed * echo->mix) >> 15));
+        line[position] = saturate(x + ((delayed * echo->feedback) >> 15));
+        position += 1;
+        if (position == echo->line_length) {
+            position = 0;
+        }
+    }
+    echo->position = position;
+}
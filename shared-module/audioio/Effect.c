@@ -0,0 +1,158 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-module/audioio/Effect.h"
+
+#include <stdint.h>
+
+#include "py/runtime.h"
+#include "shared-bindings/audioio/Biquad.h"
+#include "shared-bindings/audioio/Echo.h"
+#include "shared-bindings/audioio/Effect.h"
+#include "shared-bindings/audioio/Limiter.h"
+#include "shared-bindings/audioio/OnePole.h"
+
+void audioio_effect_construct(audioio_effect_obj_t* self, audioio_effect_kind_t kind,
+                              mp_obj_t sample, uint32_t buffer_size) {
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->samples_signed,
+                                     &max_buffer_length, &spacing);
+    self->sample = sample;
+    self->kind = kind;
+    self->sample_rate = audiosample_sample_rate(sample);
+    self->bits_per_sample = audiosample_bits_per_sample(sample);
+    self->channel_count = audiosample_channel_count(sample);
+
+    audioio_buffer_pair_construct(&self->buffers, buffer_size, self->bits_per_sample);
+
+    audioio_effect_reset_buffer(self, false, 0);
+}
+
+void common_hal_audioio_effect_deinit(audioio_effect_obj_t* self) {
+    self->buffers.first_buffer = NULL;
+    self->buffers.second_buffer = NULL;
+    if (self->kind == AUDIOIO_EFFECT_ECHO) {
+        self->echo.line = NULL;
+    }
+}
+
+bool common_hal_audioio_effect_deinited(audioio_effect_obj_t* self) {
+    return self->buffers.first_buffer == NULL;
+}
+
+bool audioio_effect_is_effect(mp_obj_t obj) {
+    return MP_OBJ_IS_TYPE(obj, &audioio_biquad_type) ||
+           MP_OBJ_IS_TYPE(obj, &audioio_onepole_type) ||
+           MP_OBJ_IS_TYPE(obj, &audioio_echo_type) ||
+           MP_OBJ_IS_TYPE(obj, &audioio_limiter_type);
+}
+
+void audioio_effect_reset_buffer(audioio_effect_obj_t* self,
+                                 bool single_channel,
+                                 uint8_t channel) {
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->source_length = 0;
+    self->source_more_data = true;
+    audioio_buffer_pair_reset(&self->buffers);
+}
+
+// Fills out with up to frames frames of the sample, processed and packed into its format. Returns
+// the number of frames produced, which is less than frames once the sample has ended.
+static uint32_t fill(void* self_in, uint8_t* out, uint32_t frames) {
+    audioio_effect_obj_t* self = self_in;
+    // We know the buffer is aligned because it was allocated on the heap.
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    int16_t* samples = (int16_t*) out;
+    #pragma GCC diagnostic pop
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    uint32_t produced = 0;
+    while (produced < frames) {
+        if (self->source_length < frame_size) {
+            if (!self->source_more_data) {
+                break;
+            }
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0,
+                &self->source_buffer, &self->source_length);
+            self->source_more_data = result == GET_BUFFER_MORE_DATA;
+            if (result == GET_BUFFER_ERROR || self->source_length == 0) {
+                // Stop rather than spin on a sample that doesn't produce any data.
+                self->source_length = 0;
+                self->source_more_data = false;
+            }
+            continue;
+        }
+        uint32_t available = self->source_length / frame_size;
+        if (available > frames - produced) {
+            available = frames - produced;
+        }
+        audioio_convert_to_s16(samples + produced * self->channel_count, self->source_buffer,
+                               available * self->channel_count, 1, self->bits_per_sample,
+                               self->samples_signed);
+        self->source_buffer += available * frame_size;
+        self->source_length -= available * frame_size;
+        produced += available;
+    }
+
+    if (self->kind == AUDIOIO_EFFECT_BIQUAD) {
+        audioio_biquad_process(self, samples, produced);
+    } else if (self->kind == AUDIOIO_EFFECT_ONE_POLE) {
+        audioio_one_pole_process(self, samples, produced);
+    } else if (self->kind == AUDIOIO_EFFECT_ECHO) {
+        audioio_echo_process(self, samples, produced);
+    } else if (self->kind == AUDIOIO_EFFECT_LIMITER) {
+        audioio_limiter_process(self, samples, produced);
+    }
+
+    audioio_pack_from_s16(out, produced * self->channel_count, self->bits_per_sample,
+                          self->samples_signed);
+    return produced;
+}
+
+audioio_get_buffer_result_t audioio_effect_get_buffer(audioio_effect_obj_t* self,
+                                                      bool single_channel,
+                                                      uint8_t channel,
+                                                      uint8_t** buffer,
+                                                      uint32_t* buffer_length) {
+    return audioio_buffer_pair_get_buffer(&self->buffers, self, fill, self->bits_per_sample,
+                                          self->channel_count, single_channel, channel, buffer,
+                                          buffer_length);
+}
+
+void audioio_effect_get_buffer_structure(audioio_effect_obj_t* self, bool single_channel,
+                                         bool* single_buffer, bool* samples_signed,
+                                         uint32_t* max_buffer_length, uint8_t* spacing) {
+    *single_buffer = false;
+    *samples_signed = self->samples_signed;
+    *max_buffer_length = self->buffers.len;
+    if (single_channel) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_EFFECT_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_EFFECT_H
+
+#include "py/obj.h"
+
+#include "shared-module/audioio/__init__.h"
+
+// Effects are all the same object with a kind picking how the sample is processed. Each kind's
+// construct and process functions live in the file named after its class.
+typedef enum {
+    AUDIOIO_EFFECT_BIQUAD,
+    AUDIOIO_EFFECT_ONE_POLE,
+    AUDIOIO_EFFECT_ECHO,
+    AUDIOIO_EFFECT_LIMITER,
+} audioio_effect_kind_t;
+
+typedef enum {
+    AUDIOIO_BIQUAD_LOWPASS,
+    AUDIOIO_BIQUAD_HIGHPASS,
+    AUDIOIO_BIQUAD_BANDPASS,
+    AUDIOIO_BIQUAD_LOWSHELF,
+    AUDIOIO_BIQUAD_HIGHSHELF,
+} audioio_biquad_mode_t;
+
+#define AUDIOIO_EFFECT_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// Biquad coefficients are Q28 so that they can reach +/-8 and the output history keeps this many
+// bits below the sample's resolution.
+#define AUDIOIO_BIQUAD_COEFFICIENT_BITS (28)
+#define AUDIOIO_BIQUAD_HISTORY_BITS (8)
+
+// The limiter picks its gain once per block of this many frames.
+#define AUDIOIO_LIMITER_BLOCK_SHIFT (4)
+#define AUDIOIO_LIMITER_BLOCK (1 << AUDIOIO_LIMITER_BLOCK_SHIFT)
+
+typedef struct {
+    audioio_biquad_mode_t mode;
+    int32_t b0;
+    int32_t b1;
+    int32_t b2;
+    int32_t a1;
+    int32_t a2;
+    // Last two inputs and outputs of each channel.
+    int32_t x1[2];
+    int32_t x2[2];
+    int32_t y1[2];
+    int32_t y2[2];
+} audioio_biquad_t;
+
+typedef struct {
+    bool highpass;
+    // Q16 fraction of the distance to the input that the output moves each frame.
+    int32_t coefficient;
+    // Q15 lowpassed level of each channel.
+    int32_t level[2];
+} audioio_one_pole_t;
+
+typedef struct {
+    // Ring of interleaved samples that are played again line_length samples after they were
+    // written.
+    int16_t* line;
+    uint32_t line_length; // in samples
+    uint32_t position;
+    // Q15 so that 1.0 is 32768.
+    int32_t feedback;
+    int32_t mix;
+} audioio_echo_t;
+
+typedef struct {
+    int32_t threshold;
+    // Q15 gain applied at the start of the next block.
+    int32_t gain;
+    // Q16 fraction of the distance back to full gain recovered each block.
+    int32_t release;
+} audioio_limiter_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t sample;
+    audioio_effect_kind_t kind;
+    audioio_buffer_pair_t buffers;
+    uint8_t bits_per_sample;
+    bool samples_signed;
+    uint8_t channel_count;
+    uint32_t sample_rate;
+
+    // Unread part of the last buffer from the sample.
+    uint8_t* source_buffer;
+    uint32_t source_length;
+    bool source_more_data;
+
+    union {
+        audioio_biquad_t biquad;
+        audioio_one_pole_t one_pole;
+        audioio_echo_t echo;
+        audioio_limiter_t limiter;
+    };
+} audioio_effect_obj_t;
+
+// Sets up the parts shared by every kind. Effects play in the sample's format.
+void audioio_effect_construct(audioio_effect_obj_t* self, audioio_effect_kind_t kind,
+                              mp_obj_t sample, uint32_t buffer_size);
+bool audioio_effect_is_effect(mp_obj_t obj);
+
+// Kernels process frames of signed 16 bit interleaved samples in place. Their state carries over
+// from one buffer to the next and when the sample loops.
+void audioio_biquad_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames);
+void audioio_one_pole_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames);
+void audioio_echo_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames);
+void audioio_limiter_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames);
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_effect_reset_buffer(audioio_effect_obj_t* self,
+                                 bool single_channel,
+                                 uint8_t channel);
+audioio_get_buffer_result_t audioio_effect_get_buffer(audioio_effect_obj_t* self,
+                                                      bool single_channel,
+                                                      uint8_t channel,
+                                                      uint8_t** buffer,
+                                                      uint32_t* buffer_length); // length in bytes
+void audioio_effect_get_buffer_structure(audioio_effect_obj_t* self, bool single_channel,
+                                         bool* single_buffer, bool* samples_signed,
+                                         uint32_t* max_buffer_length, uint8_t* spacing);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_EFFECT_H
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Limiter.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#include "py/runtime.h"
+
+void common_hal_audioio_limiter_construct(audioio_effect_obj_t* self, mp_obj_t sample,
+                                          mp_float_t threshold, mp_float_t release,
+                                          uint32_t buffer_size) {
+    audioio_effect_construct(self, AUDIOIO_EFFECT_LIMITER, sample, buffer_size);
+    audioio_limiter_t* limiter = &self->limiter;
+    limiter->threshold = MICROPY_FLOAT_C_FUN(floor)(threshold * INT16_MAX + MICROPY_FLOAT_CONST(0.5));
+    if (limiter->threshold < 1) {
+        limiter->threshold = 1;
+    }
+    limiter->gain = 1 << 15;
+    mp_float_t recovered = 1 - MICROPY_FLOAT_C_FUN(exp)(-AUDIOIO_LIMITER_BLOCK / (release * self->sample_rate));
+    limiter->release = MICROPY_FLOAT_C_FUN(floor)(recovered * 65536 + MICROPY_FLOAT_CONST(0.5));
+    if (limiter->release < 1) {
+        limiter->release = 1;
+    }
+}
+
+// The gain for each block is picked from the block's peak before the block is scaled, so the
+// output never goes over the threshold. When the peak is over the threshold the gain drops at the
+// start of the block. Otherwise it ramps back towards full gain across the block.
+void audioio_limiter_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames) {
+    audioio_limiter_t* limiter = &self->limiter;
+    uint8_t channels = self->channel_count;
+    int32_t gain = limiter->gain;
+    for (uint32_t start = 0; start < frames; start += AUDIOIO_LIMITER_BLOCK) {
+        uint32_t block = frames - start;
+        if (block > AUDIOIO_LIMITER_BLOCK) {
+            block = AUDIOIO_LIMITER_BLOCK;
+        }
+        int16_t* s = samples + start * channels;
+        uint32_t count = block * channels;
+        int32_t peak = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t magnitude = s[i] < 0 ? -s[i] : s[i];
+            if (magnitude > peak) {
+                peak = magnitude;
+            }
+        }
+        int32_t target = 1 << 15;
+        if (peak > limiter->threshold) {
+            target = (limiter->threshold << 15) / peak;
+        }
+        int32_t step;
+        if (target <= gain) {
+            gain = target;
+            step = 0;
+        } else {
+            // Round up so that the gain always gets back to full.
+            step = ((int64_t) (target - gain) * limiter->release + 0xffff) >> 16;
+        }
+        if (gain == 1 << 15 && step == 0) {
+            continue;
+        }
+        for (uint32_t i = 0; i < block; i++) {
+            int32_t g = gain + ((step * i) >> AUDIOIO_LIMITER_BLOCK_SHIFT);
+            for (uint8_t c = 0; c < channels; c++) {
+                s[i * channels + c] = (s[i * channels + c] * g) >> 15;
+            }
+        }
+        gain += (step * block) >> AUDIOIO_LIMITER_BLOCK_SHIFT;
+    }
+    limiter->gain = gain;
+}
@@ -27,6 +27,7 @@
 #include "shared-bindings/audioio/Mixer.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include "py/runtime.h"
 #include "shared-module/audioio/__init__.h"
@@ -61,6 +62,7 @@ void common_hal_audioio_mixer_construct(audioio_mixer_obj_t* self,
 
     for (uint8_t i = 0; i < self->voice_count; i++) {
         self->voice[i].sample = NULL;
+        common_hal_audioio_mixer_set_voice(self, i, 1.0, 0.0);
     }
 }
 
@@ -77,7 +79,8 @@ uint32_t common_hal_audioio_mixer_get_sample_rate(audioio_mixer_obj_t* self) {
     return self->sample_rate;
 }
 
-void common_hal_audioio_mixer_play(audioio_mixer_obj_t* self, mp_obj_t sample, uint8_t v, bool loop) {
+void common_hal_audioio_mixer_play(audioio_mixer_obj_t* self, mp_obj_t sample, uint8_t v, bool loop,
+                                   mp_float_t level, mp_float_t pan) {
     if (v >= self->voice_count) {
         mp_raise_ValueError(translate("Voice index too high"));
     }
@@ -99,6 +102,7 @@ void common_hal_audioio_mixer_play(audioio_mixer_obj_t* self, mp_obj_t sample, u
     if (samples_signed != self->samples_signed) {
         mp_raise_ValueError(translate("The sample's signedness does not match the mixer's"));
     }
+    common_hal_audioio_mixer_set_voice(self, v, level, pan);
     audioio_mixer_voice_t* voice = &self->voice[v];
     voice->sample = sample;
     voice->loop = loop;
@@ -114,6 +118,45 @@ void common_hal_audioio_mixer_stop_voice(audioio_mixer_obj_t* self, uint8_t voic
     self->voice[voice].sample = NULL;
 }
 
+// Converts a gain from 0.0 to 1.0 to Q15. 1.0 is stored as the largest Q15 value because the
+// scaling kernels multiply by a signed halfword. Voices at exactly 1.0 aren't scaled at all.
+static int16_t q15_gain(mp_float_t gain) {
+    int32_t q15 = (int32_t) (gain * 32768 + (mp_float_t) 0.5);
+    if (q15 > INT16_MAX) {
+        q15 = INT16_MAX;
+    }
+    return q15;
+}
+
+void common_hal_audioio_mixer_set_voice(audioio_mixer_obj_t* self, uint8_t v, mp_float_t level,
+                                        mp_float_t pan) {
+    audioio_mixer_voice_t* voice = &self->voice[v];
+    voice->level = level;
+    voice->pan = pan;
+
+    // Panning attenuates the opposite channel and leaves the panned to channel at level.
+    mp_float_t left = level;
+    mp_float_t right = level;
+    if (self->channel_count == 2) {
+        if (pan > 0) {
+            left = level * (1 - pan);
+        } else {
+            right = level * (1 + pan);
+        }
+    }
+    voice->left_gain = q15_gain(left);
+    voice->right_gain = q15_gain(right);
+    voice->unity = left == 1 && right == 1;
+}
+
+mp_float_t common_hal_audioio_mixer_get_voice_level(audioio_mixer_obj_t* self, uint8_t voice) {
+    return self->voice[voice].level;
+}
+
+mp_float_t common_hal_audioio_mixer_get_voice_pan(audioio_mixer_obj_t* self, uint8_t voice) {
+    return self->voice[voice].pan;
+}
+
 bool common_hal_audioio_mixer_get_playing(audioio_mixer_obj_t* self) {
     for (int32_t v = 0; v < self->voice_count; v++) {
         if (self->voice[v].sample != NULL) {
@@ -140,10 +183,10 @@ uint32_t add8signed(uint32_t a, uint32_t b) {
         int8_t ai = a >> (sizeof(int8_t) * 8 * i);
         int8_t bi = b >> (sizeof(int8_t) * 8 * i);
         int32_t intermediate = (int32_t) ai + bi;
-        if (intermediate > CHAR_MAX) {
-            intermediate = CHAR_MAX;
-        } else if (intermediate < CHAR_MIN) {
-            //intermediate = CHAR_MIN;
+        if (intermediate > INT8_MAX) {
+            intermediate = INT8_MAX;
+        } else if (intermediate < INT8_MIN) {
+            intermediate = INT8_MIN;
         }
         result |= (((uint32_t) intermediate) & 0xff) << (sizeof(int8_t) * 8 * i);
     }
@@ -151,28 +194,6 @@ uint32_t add8signed(uint32_t a, uint32_t b) {
     #endif
 }
 
-uint32_t add8unsigned(uint32_t a, uint32_t b) {
-    #if (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
-    // Subtract out the DC offset, add and then shift back.
-    a = __USUB8(a, 0x80808080);
-    b = __USUB8(b, 0x80808080);
-    uint32_t sum = __QADD8(a, b);
-    return __UADD8(sum, 0x80808080);
-    #else
-    uint32_t result = 0;
-    for (int8_t i = 0; i < 4; i++) {
-        int8_t ai = (a >> (sizeof(uint8_t) * 8 * i)) - 128;
-        int8_t bi = (b >> (sizeof(uint8_t) * 8 * i)) - 128;
-        int32_t intermediate = (int32_t) ai + bi;
-        if (intermediate > UCHAR_MAX) {
-            intermediate = UCHAR_MAX;
-        }
-        result |= ((uint8_t) intermediate + 128) << (sizeof(uint8_t) * 8 * i);
-    }
-    return result;
-    #endif
-}
-
 uint32_t add16signed(uint32_t a, uint32_t b) {
     #if (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
     return __QADD16(a, b);
@@ -193,28 +214,157 @@ uint32_t add16signed(uint32_t a, uint32_t b) {
     #endif
 }
 
-uint32_t add16unsigned(uint32_t a, uint32_t b) {
+// Scales the two signed 16 bit samples in a word by Q15 gains. left scales the low half and
+// right_high, which holds its gain in the upper half, scales the high half.
+static inline uint32_t scale16signed(uint32_t v, uint32_t left, uint32_t right_high) {
     #if (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
-    // Subtract out the DC offset, add and then shift back.
-    a = __USUB16(a, 0x80008000);
-    b = __USUB16(b, 0x80008000);
-    uint32_t sum = __QADD16(a, b);
-    return __UADD16(sum, 0x80008000);
+    int32_t low = ((int32_t) __SMUAD(v, left)) >> 15;
+    int32_t high = ((int32_t) __SMUAD(v, right_high)) >> 15;
+    return __PKHBT(low, high, 16);
     #else
+    int32_t low = ((int16_t) v * (int32_t) left) >> 15;
+    int32_t high = ((int16_t) (v >> 16) * (int32_t) (right_high >> 16)) >> 15;
+    return (((uint32_t) low) & 0xffff) | ((uint32_t) high << 16);
+    #endif
+}
+
+// Scales the four signed 8 bit samples in a word by Q15 gains. Even bytes are left samples and
+// odd bytes are right samples in stereo.
+static inline uint32_t scale8signed(uint32_t v, uint32_t left, uint32_t right_high) {
+    #if (defined (__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+    // Sign extend the even and odd bytes into halfwords and scale each halfword.
+    uint32_t even = __SXTB16(v);
+    uint32_t odd = __SXTB16(__ROR(v, 8));
+    uint32_t left_high = left << 16;
+    uint32_t right = right_high >> 16;
+    uint32_t scaled_even = __PKHBT(((int32_t) __SMUAD(even, left)) >> 15,
+                                   ((int32_t) __SMUAD(even, left_high)) >> 15, 16);
+    uint32_t scaled_odd = __PKHBT(((int32_t) __SMUAD(odd, right)) >> 15,
+                                  ((int32_t) __SMUAD(odd, right_high)) >> 15, 16);
+    return (scaled_even & 0x00ff00ff) | ((scaled_odd << 8) & 0xff00ff00);
+    #else
+    int32_t right = right_high >> 16;
     uint32_t result = 0;
-    for (int8_t i = 0; i < 2; i++) {
-        int16_t ai = (a >> (sizeof(uint16_t) * 8 * i)) - 0x8000;
-        int16_t bi = (b >> (sizeof(uint16_t) * 8 * i)) - 0x8000;
-        int32_t intermediate = (int32_t) ai + bi;
-        if (intermediate > USHRT_MAX) {
-            intermediate = USHRT_MAX;
-        }
-        result |= ((uint16_t) intermediate + 0x8000) << (sizeof(int16_t) * 8 * i);
+    for (int8_t i = 0; i < 4; i++) {
+        int32_t gain = (i & 1) ? right : (int32_t) left;
+        int32_t scaled = ((int8_t) (v >> (8 * i)) * gain) >> 15;
+        result |= (((uint32_t) scaled) & 0xff) << (8 * i);
     }
     return result;
     #endif
 }
 
+// Mixing kernels. Each handles one combination of sample size, scaling and whether it is the first
+// voice written to the buffer so that the per word loop doesn't branch. Samples are converted to
+// signed by xoring with flip before mixing. The gains are only used by the scaling kernels.
+typedef void (*mixer_kernel_t)(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                               uint32_t left, uint32_t right_high);
+
+static void mix_copy(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                     uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = in[i] ^ flip;
+    }
+}
+
+static void mix_add16(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                      uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = add16signed(out[i], in[i] ^ flip);
+    }
+}
+
+static void mix_add8(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                     uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = add8signed(out[i], in[i] ^ flip);
+    }
+}
+
+static void mix_scale16(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                        uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = scale16signed(in[i] ^ flip, left, right_high);
+    }
+}
+
+static void mix_scale_add16(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                            uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = add16signed(out[i], scale16signed(in[i] ^ flip, left, right_high));
+    }
+}
+
+static void mix_scale8(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                       uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = scale8signed(in[i] ^ flip, left, right_high);
+    }
+}
+
+static void mix_scale_add8(uint32_t* out, const uint32_t* in, uint32_t count, uint32_t flip,
+                           uint32_t left, uint32_t right_high) {
+    for (uint32_t i = 0; i < count; i++) {
+        out[i] = add8signed(out[i], scale8signed(in[i] ^ flip, left, right_high));
+    }
+}
+
+static mixer_kernel_t choose_kernel(audioio_mixer_obj_t* self, audioio_mixer_voice_t* voice,
+                                    bool first) {
+    if (self->bits_per_sample == 16) {
+        if (voice->unity) {
+            return first ? mix_copy : mix_add16;
+        }
+        return first ? mix_scale16 : mix_scale_add16;
+    }
+    if (voice->unity) {
+        return first ? mix_copy : mix_add8;
+    }
+    return first ? mix_scale8 : mix_scale_add8;
+}
+
+// Mixes up to length words of the voice into word_buffer, loading new buffers from the voice's
+// sample as needed. Returns the number of words mixed, which is less than length when the voice
+// finishes.
+static uint32_t mix_voice(audioio_mixer_obj_t* self, audioio_mixer_voice_t* voice,
+                          uint32_t* word_buffer, uint32_t length, uint32_t flip, bool first) {
+    mixer_kernel_t kernel = choose_kernel(self, voice, first);
+    uint32_t left = (uint16_t) voice->left_gain;
+    uint32_t right_high = ((uint32_t) voice->right_gain) << 16;
+
+    uint32_t i = 0;
+    while (i < length) {
+        if (voice->buffer_length == 0) {
+            if (!voice->more_data) {
+                if (!voice->loop) {
+                    voice->sample = NULL;
+                    break;
+                }
+                audiosample_reset_buffer(voice->sample, false, 0);
+            }
+            // Load another buffer
+            audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t**) &voice->remaining_buffer, &voice->buffer_length);
+            // Track length in terms of words.
+            voice->buffer_length /= sizeof(uint32_t);
+            voice->more_data = result == GET_BUFFER_MORE_DATA;
+            if (result == GET_BUFFER_ERROR || voice->buffer_length == 0) {
+                // Stop rather than spin on a sample that doesn't produce any data.
+                voice->sample = NULL;
+                break;
+            }
+        }
+        uint32_t count = length - i;
+        if (count > voice->buffer_length) {
+            count = voice->buffer_length;
+        }
+        kernel(word_buffer + i, voice->remaining_buffer, count, flip, left, right_high);
+        voice->remaining_buffer += count;
+        voice->buffer_length -= count;
+        i += count;
+    }
+    return i;
+}
+
 audioio_get_buffer_result_t audioio_mixer_get_buffer(audioio_mixer_obj_t* self,
                                                      bool single_channel,
                                                      uint8_t channel,
@@ -241,73 +391,38 @@ audioio_get_buffer_result_t audioio_mixer_get_buffer(audioio_mixer_obj_t* self,
             word_buffer = self->second_buffer;
         }
         self->use_first_buffer = !self->use_first_buffer;
+
+        // Mix in the signed domain so that silence is zero. Unsigned samples are flipped on the
+        // way in and the mix is flipped back once at the end.
+        uint32_t flip = 0;
+        if (!self->samples_signed) {
+            if (self->bits_per_sample == 8) {
+                flip = 0x80808080;
+            } else {
+                flip = 0x80008000;
+            }
+        }
+        uint32_t length = self->len / sizeof(uint32_t);
         bool voices_active = false;
         for (int32_t v = 0; v < self->voice_count; v++) {
             audioio_mixer_voice_t* voice = &self->voice[v];
-
-            uint32_t j = 0;
-            bool voice_done = voice->sample == NULL;
-            for (uint32_t i = 0; i < self->len / sizeof(uint32_t); i++) {
-                if (!voice_done && j >= voice->buffer_length) {
-                    if (!voice->more_data) {
-                        if (voice->loop) {
-                            audiosample_reset_buffer(voice->sample, false, 0);
-                        } else {
-                            voice->sample = NULL;
-                            voice_done = true;
-                        }
-                    }
-                    if (!voice_done) {
-                        // Load another buffer
-                        audioio_get_buffer_result_t result = audiosample_get_buffer(voice->sample, false, 0, (uint8_t**) &voice->remaining_buffer, &voice->buffer_length);
-                        // Track length in terms of words.
-                        voice->buffer_length /= sizeof(uint32_t);
-                        voice->more_data = result == GET_BUFFER_MORE_DATA;
-                        j = 0;
-                    }
-                }
-                // First active voice gets copied over verbatim.
-                uint32_t sample_value;
-                if (voice_done) {
-                    // Exit early if another voice already set all samples once.
-                    if (voices_active) {
-                        continue;
-                    }
-                    sample_value = 0;
-                    if (!self->samples_signed) {
-                        if (self->bits_per_sample == 8) {
-                            sample_value = 0x7f7f7f7f;
-                        } else {
-                            sample_value = 0x7fff7fff;
-                        }
-                    }
-                } else {
-                    sample_value = voice->remaining_buffer[j];
-                }
-
-                if (!voices_active) {
-                    word_buffer[i] = sample_value;
-                } else {
-                    if (self->bits_per_sample == 8) {
-                        if (self->samples_signed) {
-                            word_buffer[i] = add8signed(word_buffer[i], sample_value);
-                        } else {
-                            word_buffer[i] = add8unsigned(word_buffer[i], sample_value);
-                        }
-                    } else {
-                        if (self->samples_signed) {
-                            word_buffer[i] = add16signed(word_buffer[i], sample_value);
-                        } else {
-                            word_buffer[i] = add16unsigned(word_buffer[i], sample_value);
-                        }
-                    }
-                }
-                j++;
+            if (voice->sample == NULL) {
+                continue;
+            }
+            uint32_t mixed = mix_voice(self, voice, word_buffer, length, flip, !voices_active);
+            // The first active voice sets every word so fill in silence after it ends.
+            if (!voices_active) {
+                memset(word_buffer + mixed, 0, (length - mixed) * sizeof(uint32_t));
+                voices_active = true;
+            }
+        }
+        if (!voices_active) {
+            memset(word_buffer, 0, length * sizeof(uint32_t));
+        }
+        if (flip != 0) {
+            for (uint32_t i = 0; i < length; i++) {
+                word_buffer[i] ^= flip;
             }
-            voice->buffer_length -= j;
-            voice->remaining_buffer += j;
-
-            voices_active = true;
         }
 
         self->read_count += 1;
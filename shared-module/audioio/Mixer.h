@@ -37,6 +37,13 @@ typedef struct {
     bool more_data;
     uint32_t* remaining_buffer;
     uint32_t buffer_length;
+    mp_float_t level;
+    mp_float_t pan;
+    // Q15 gains for the left and right channel, derived from level and pan. Mono uses left_gain
+    // for every sample. unity is set when both are 1.0 so the voice can be mixed without scaling.
+    int16_t left_gain;
+    int16_t right_gain;
+    bool unity;
 } audioio_mixer_voice_t;
 
 typedef struct {
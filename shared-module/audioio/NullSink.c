@@ -0,0 +1,96 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/NullSink.h"
+
+#include <string.h>
+
+#include "shared-module/audioio/__init__.h"
+
+void common_hal_audioio_nullsink_construct(audioio_nullsink_obj_t* self) {
+    self->sample = NULL;
+    self->remaining_length = 0;
+    self->bytes_received = 0;
+}
+
+void common_hal_audioio_nullsink_play(audioio_nullsink_obj_t* self, mp_obj_t sample, bool loop) {
+    audiosample_reset_buffer(sample, false, 0);
+    self->sample = sample;
+    self->loop = loop;
+    self->more_data = true;
+    self->remaining_length = 0;
+}
+
+void common_hal_audioio_nullsink_stop(audioio_nullsink_obj_t* self) {
+    self->sample = NULL;
+    self->remaining_length = 0;
+}
+
+bool common_hal_audioio_nullsink_get_playing(audioio_nullsink_obj_t* self) {
+    return self->sample != NULL;
+}
+
+uint32_t common_hal_audioio_nullsink_read(audioio_nullsink_obj_t* self, uint8_t* buffer, uint32_t length) {
+    uint32_t total = 0;
+    while (total < length && self->sample != NULL) {
+        if (self->remaining_length == 0) {
+            // Fetch the next buffer the way audio DMA does.
+            if (!self->more_data) {
+                if (!self->loop) {
+                    self->sample = NULL;
+                    break;
+                }
+                audiosample_reset_buffer(self->sample, false, 0);
+            }
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0,
+                &self->remaining_buffer, &self->remaining_length);
+            self->more_data = result == GET_BUFFER_MORE_DATA;
+            if (result == GET_BUFFER_ERROR || self->remaining_length == 0) {
+                self->sample = NULL;
+                self->remaining_length = 0;
+                break;
+            }
+            // Give the sample the background time it would get while DMA plays the buffer.
+            audiosample_background(self->sample);
+        }
+        uint32_t count = length - total;
+        if (count > self->remaining_length) {
+            count = self->remaining_length;
+        }
+        if (buffer != NULL) {
+            memcpy(buffer + total, self->remaining_buffer, count);
+        }
+        self->remaining_buffer += count;
+        self->remaining_length -= count;
+        total += count;
+    }
+    self->bytes_received += total;
+    return total;
+}
+
+uint64_t common_hal_audioio_nullsink_get_bytes_received(audioio_nullsink_obj_t* self) {
+    return self->bytes_received;
+}
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/OnePole.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#include "py/runtime.h"
+
+void common_hal_audioio_onepole_construct(audioio_effect_obj_t* self, mp_obj_t sample,
+                                          mp_float_t frequency, bool highpass,
+                                          uint32_t buffer_size) {
+    audioio_effect_construct(self, AUDIOIO_EFFECT_ONE_POLE, sample, buffer_size);
+    audioio_one_pole_t* filter = &self->one_pole;
+    filter->highpass = highpass;
+    mp_float_t coefficient = 1 - MICROPY_FLOAT_C_FUN(exp)(-2 * AUDIOIO_EFFECT_PI * frequency / self->sample_rate);
+    filter->coefficient = MICROPY_FLOAT_C_FUN(floor)(coefficient * 65536 + MICROPY_FLOAT_CONST(0.5));
+    if (filter->coefficient < 1) {
+        filter->coefficient = 1;
+    }
+    filter->level[0] = 0;
+    filter->level[1] = 0;
+}
+
+// The lowpassed level moves part of the way to each input. The highpass is what it leaves behind.
+void audioio_one_pole_process(audioio_effect_obj_t* self, int16_t* samples, uint32_t frames) {
+    audioio_one_pole_t* filter = &self->one_pole;
+    int32_t coefficient = filter->coefficient;
+    uint8_t channels = self->channel_count;
+    for (uint8_t c = 0; c < channels; c++) {
+        int32_t level = filter->level[c];
+        int16_t* s = samples + c;
+        for (uint32_t i = 0; i < frames; i++) {
+            int32_t x = s[i * channels];
+            int32_t difference = x * (1 << 15) - level;
+            level += ((int64_t) difference * coefficient) >> 16;
+            int32_t out = (level + (1 << 14)) >> 15;
+            if (filter->highpass) {
+                out = x - out;
+                if (out > INT16_MAX) {
+                    out = INT16_MAX;
+                } else if (out < INT16_MIN) {
+                    out = INT16_MIN;
+                }
+            }
+            s[i * channels] = out;
+        }
+        filter->level[c] = level;
+    }
+}
@@ -0,0 +1,345 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Resampler.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audioio/__init__.h"
+#include "supervisor/shared/translate.h"
+
+#define RESAMPLER_PI MICROPY_FLOAT_CONST(3.14159265358979323846)
+
+// Fills the polyphase table with Blackman windowed sinc filters. Each phase is the filter for an
+// output that falls phase / AUDIOIO_RESAMPLER_FIR_PHASES of a frame past the center tap. There is
+// one extra phase, a whole frame past the center, to interpolate towards from the last phase. cutoff
+// is relative to the sample's Nyquist frequency and is lowered when decimating to avoid aliasing.
+static void fill_coefficients(int16_t* coefficients, mp_float_t cutoff) {
+    const int32_t half = AUDIOIO_RESAMPLER_FIR_TAPS / 2;
+    mp_float_t values[AUDIOIO_RESAMPLER_FIR_TAPS];
+    for (int32_t phase = 0; phase <= AUDIOIO_RESAMPLER_FIR_PHASES; phase++) {
+        mp_float_t offset = (mp_float_t) phase / AUDIOIO_RESAMPLER_FIR_PHASES;
+        mp_float_t total = 0;
+        for (int32_t tap = 0; tap < AUDIOIO_RESAMPLER_FIR_TAPS; tap++) {
+            mp_float_t t = tap - (half - 1) - offset;
+            mp_float_t x = RESAMPLER_PI * t * cutoff;
+            mp_float_t sinc = 1;
+            if (x != 0) {
+                sinc = MICROPY_FLOAT_C_FUN(sin)(x) / x;
+            }
+            mp_float_t angle = RESAMPLER_PI * t / half;
+            mp_float_t window = MICROPY_FLOAT_CONST(0.42) +
+                                MICROPY_FLOAT_CONST(0.5) * MICROPY_FLOAT_C_FUN(cos)(angle) +
+                                MICROPY_FLOAT_CONST(0.08) * MICROPY_FLOAT_C_FUN(cos)(2 * angle);
+            values[tap] = sinc * window;
+            total += values[tap];
+        }
+        // Normalize each phase so that a constant input passes through unchanged.
+        int16_t* phase_coefficients = coefficients + phase * AUDIOIO_RESAMPLER_FIR_TAPS;
+        for (int32_t tap = 0; tap < AUDIOIO_RESAMPLER_FIR_TAPS; tap++) {
+            phase_coefficients[tap] = MICROPY_FLOAT_C_FUN(floor)(values[tap] / total * 32768 +
+                                                                 MICROPY_FLOAT_CONST(0.5));
+        }
+    }
+}
+
+void common_hal_audioio_resampler_construct(audioio_resampler_obj_t* self, mp_obj_t sample,
+                                            uint32_t sample_rate,
+                                            audioio_resampler_quality_t quality,
+                                            uint32_t buffer_size) {
+    uint32_t source_rate = audiosample_sample_rate(sample);
+    if (source_rate > sample_rate * AUDIOIO_RESAMPLER_MAX_DECIMATION) {
+        mp_raise_ValueError(translate("The sample's sample rate is too high for the output sample rate"));
+    }
+    bool single_buffer;
+    uint32_t max_buffer_length;
+    uint8_t spacing;
+    audiosample_get_buffer_structure(sample, false, &single_buffer, &self->samples_signed,
+                                     &max_buffer_length, &spacing);
+    self->sample = sample;
+    self->sample_rate = sample_rate;
+    self->quality = quality;
+    self->bits_per_sample = audiosample_bits_per_sample(sample);
+    self->channel_count = audiosample_channel_count(sample);
+    self->step = ((uint64_t) source_rate << 16) / sample_rate;
+    self->step_remainder = ((uint64_t) source_rate << 16) % sample_rate;
+
+    audioio_buffer_pair_construct(&self->buffers, buffer_size, self->bits_per_sample);
+
+    self->coefficients = NULL;
+    self->taps = 2;
+    if (quality == AUDIOIO_RESAMPLER_FIR) {
+        self->taps = AUDIOIO_RESAMPLER_FIR_TAPS;
+        self->coefficients = m_new(int16_t, AUDIOIO_RESAMPLER_FIR_TAPS * (AUDIOIO_RESAMPLER_FIR_PHASES + 1));
+        mp_float_t cutoff = MICROPY_FLOAT_CONST(0.9);
+        if (source_rate > sample_rate) {
+            cutoff = cutoff * sample_rate / source_rate;
+        }
+        fill_coefficients(self->coefficients, cutoff);
+    }
+    self->work_stride = self->taps + AUDIOIO_RESAMPLER_CHUNK;
+    self->work = m_new(int16_t, self->work_stride * self->channel_count);
+
+    audioio_resampler_reset_buffer(self, false, 0);
+}
+
+void common_hal_audioio_resampler_deinit(audioio_resampler_obj_t* self) {
+    self->buffers.first_buffer = NULL;
+    self->buffers.second_buffer = NULL;
+    self->coefficients = NULL;
+    self->work = NULL;
+}
+
+bool common_hal_audioio_resampler_deinited(audioio_resampler_obj_t* self) {
+    return self->buffers.first_buffer == NULL;
+}
+
+uint32_t common_hal_audioio_resampler_get_sample_rate(audioio_resampler_obj_t* self) {
+    return self->sample_rate;
+}
+
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t* self,
+                                    bool single_channel,
+                                    uint8_t channel) {
+    audiosample_reset_buffer(self->sample, false, 0);
+    self->source_length = 0;
+    self->source_skip = 0;
+    self->source_more_data = true;
+    self->source_flushed = false;
+
+    // Start with silence before the first input frame so that it reaches the center tap.
+    self->available = self->taps / 2 - 1;
+    for (uint8_t c = 0; c < self->channel_count; c++) {
+        memset(self->work + c * self->work_stride, 0, self->available * sizeof(int16_t));
+    }
+    self->index = 0;
+    self->frac = 0;
+    self->remainder = 0;
+    audioio_buffer_pair_reset(&self->buffers);
+}
+
+// Converts frames from the sample's buffer to signed 16 bit and appends them to the work rows.
+static void convert_frames(audioio_resampler_obj_t* self, uint32_t frames) {
+    uint8_t channels = self->channel_count;
+    uint8_t bytes_per_sample = self->bits_per_sample / 8;
+    for (uint8_t c = 0; c < channels; c++) {
+        audioio_convert_to_s16(self->work + c * self->work_stride + self->available,
+                               self->source_buffer + c * bytes_per_sample, frames, channels,
+                               self->bits_per_sample, self->samples_signed);
+    }
+    self->available += frames;
+}
+
+// Moves the input that is still needed to the start of the work rows and converts more from the
+// sample. Returns false when the sample has ended and all of its input has been used.
+static bool refill(audioio_resampler_obj_t* self) {
+    uint32_t keep = 0;
+    if (self->index < self->available) {
+        keep = self->available - self->index;
+        for (uint8_t c = 0; c < self->channel_count; c++) {
+            int16_t* row = self->work + c * self->work_stride;
+            memmove(row, row + self->index, keep * sizeof(int16_t));
+        }
+    } else {
+        // Decimation stepped past the converted input so skip some of the sample.
+        self->source_skip += self->index - self->available;
+    }
+    self->available = keep;
+    self->index = 0;
+
+    uint32_t frame_size = self->channel_count * self->bits_per_sample / 8;
+    while (self->available < self->work_stride) {
+        if (self->source_length < frame_size) {
+            if (!self->source_more_data) {
+                if (self->source_flushed) {
+                    break;
+                }
+                // Pad with silence so that the last input frame reaches the center tap.
+                uint32_t padding = self->taps / 2;
+                if (self->available + padding > self->work_stride) {
+                    break;
+                }
+                for (uint8_t c = 0; c < self->channel_count; c++) {
+                    memset(self->work + c * self->work_stride + self->available, 0, padding * sizeof(int16_t));
+                }
+                self->available += padding;
+                self->source_flushed = true;
+                break;
+            }
+            audioio_get_buffer_result_t result = audiosample_get_buffer(self->sample, false, 0,
+                &self->source_buffer, &self->source_length);
+            self->source_more_data = result == GET_BUFFER_MORE_DATA;
+            if (result == GET_BUFFER_ERROR || self->source_length == 0) {
+                // Stop rather than spin on a sample that doesn't produce any data.
+                self->source_length = 0;
+                self->source_more_data = false;
+            }
+            continue;
+        }
+        uint32_t frames = self->source_length / frame_size;
+        if (self->source_skip > 0) {
+            if (frames > self->source_skip) {
+                frames = self->source_skip;
+            }
+            self->source_skip -= frames;
+        } else {
+            if (frames > self->work_stride - self->available) {
+                frames = self->work_stride - self->available;
+            }
+            convert_frames(self, frames);
+        }
+        self->source_buffer += frames * frame_size;
+        self->source_length -= frames * frame_size;
+    }
+    return self->index + self->taps <= self->available;
+}
+
+// Moves the output position forward by one output frame.
+static inline void advance(audioio_resampler_obj_t* self, uint32_t* index, uint32_t* frac,
+                           uint32_t* remainder) {
+    *frac += self->step;
+    *remainder += self->step_remainder;
+    if (*remainder >= self->sample_rate) {
+        *remainder -= self->sample_rate;
+        *frac += 1;
+    }
+    *index += *frac >> 16;
+    *frac &= 0xffff;
+}
+
+// Resampling kernels produce interleaved output frames until they run out of converted input and
+// return how many frames they produced.
+static uint32_t resample_linear(audioio_resampler_obj_t* self, int16_t* out, uint32_t frames) {
+    uint8_t channels = self->channel_count;
+    uint32_t index = self->index;
+    uint32_t frac = self->frac;
+    uint32_t remainder = self->remainder;
+    uint32_t last = self->available - self->taps;
+    uint32_t i = 0;
+    for (; i < frames && index <= last; i++) {
+        int32_t weight = frac >> 1;
+        for (uint8_t c = 0; c < channels; c++) {
+            const int16_t* x = self->work + c * self->work_stride + index;
+            out[i * channels + c] = x[0] + (((x[1] - x[0]) * weight) >> 15);
+        }
+        advance(self, &index, &frac, &remainder);
+    }
+    self->index = index;
+    self->frac = frac;
+    self->remainder = remainder;
+    return i;
+}
+
+static uint32_t resample_fir(audioio_resampler_obj_t* self, int16_t* out, uint32_t frames) {
+    const uint32_t phase_shift = 16 - AUDIOIO_RESAMPLER_FIR_PHASE_BITS;
+    uint8_t channels = self->channel_count;
+    uint32_t index = self->index;
+    uint32_t frac = self->frac;
+    uint32_t remainder = self->remainder;
+    uint32_t last = self->available - self->taps;
+    uint32_t i = 0;
+    for (; i < frames && index <= last; i++) {
+        // Filter with the phases on either side of frac and interpolate between them.
+        const int16_t* h0 = self->coefficients + (frac >> phase_shift) * AUDIOIO_RESAMPLER_FIR_TAPS;
+        const int16_t* h1 = h0 + AUDIOIO_RESAMPLER_FIR_TAPS;
+        int32_t weight = (frac & ((1 << phase_shift) - 1)) << (15 - phase_shift);
+        for (uint8_t c = 0; c < channels; c++) {
+            const int16_t* x = self->work + c * self->work_stride + index;
+            int32_t sum0 = 1 << 14;
+            int32_t sum1 = 1 << 14;
+            for (uint32_t t = 0; t < AUDIOIO_RESAMPLER_FIR_TAPS; t++) {
+                sum0 += x[t] * h0[t];
+                sum1 += x[t] * h1[t];
+            }
+            sum0 >>= 15;
+            sum1 >>= 15;
+            int32_t sum = sum0 + (((sum1 - sum0) * weight) >> 15);
+            if (sum > INT16_MAX) {
+                sum = INT16_MAX;
+            } else if (sum < INT16_MIN) {
+                sum = INT16_MIN;
+            }
+            out[i * channels + c] = sum;
+        }
+        advance(self, &index, &frac, &remainder);
+    }
+    self->index = index;
+    self->frac = frac;
+    self->remainder = remainder;
+    return i;
+}
+
+// Fills out with up to frames frames and packs them into the output format. Returns the number of
+// frames produced, which is less than frames once the sample has ended.
+static uint32_t resample(void* self_in, uint8_t* out, uint32_t frames) {
+    audioio_resampler_obj_t* self = self_in;
+    // We know the buffer is aligned because it was allocated on the heap.
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    int16_t* samples = (int16_t*) out;
+    #pragma GCC diagnostic pop
+    uint32_t produced = 0;
+    while (produced < frames) {
+        if (self->index + self->taps > self->available && !refill(self)) {
+            break;
+        }
+        if (self->quality == AUDIOIO_RESAMPLER_FIR) {
+            produced += resample_fir(self, samples + produced * self->channel_count, frames - produced);
+        } else {
+            produced += resample_linear(self, samples + produced * self->channel_count, frames - produced);
+        }
+    }
+
+    audioio_pack_from_s16(out, produced * self->channel_count, self->bits_per_sample,
+                          self->samples_signed);
+    return produced;
+}
+
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t* self,
+                                                         bool single_channel,
+                                                         uint8_t channel,
+                                                         uint8_t** buffer,
+                                                         uint32_t* buffer_length) {
+    return audioio_buffer_pair_get_buffer(&self->buffers, self, resample, self->bits_per_sample,
+                                          self->channel_count, single_channel, channel, buffer,
+                                          buffer_length);
+}
+
+void audioio_resampler_get_buffer_structure(audioio_resampler_obj_t* self, bool single_channel,
+                                            bool* single_buffer, bool* samples_signed,
+                                            uint32_t* max_buffer_length, uint8_t* spacing) {
+    *single_buffer = false;
+    *samples_signed = self->samples_signed;
+    *max_buffer_length = self->buffers.len;
+    if (single_channel) {
+        *spacing = self->channel_count;
+    } else {
+        *spacing = 1;
+    }
+}
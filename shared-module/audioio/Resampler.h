@@ -0,0 +1,97 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_RESAMPLER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_RESAMPLER_H
+
+#include "py/obj.h"
+
+#include "shared-module/audioio/__init__.h"
+
+// Number of input frames converted at a time.
+#define AUDIOIO_RESAMPLER_CHUNK (128)
+// Taps per phase and number of phases of the polyphase filter.
+#define AUDIOIO_RESAMPLER_FIR_TAPS (16)
+#define AUDIOIO_RESAMPLER_FIR_PHASE_BITS (5)
+#define AUDIOIO_RESAMPLER_FIR_PHASES (1 << AUDIOIO_RESAMPLER_FIR_PHASE_BITS)
+// Largest ratio of the sample's rate to the output rate.
+#define AUDIOIO_RESAMPLER_MAX_DECIMATION (8)
+
+typedef enum {
+    AUDIOIO_RESAMPLER_LINEAR,
+    AUDIOIO_RESAMPLER_FIR,
+} audioio_resampler_quality_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t sample;
+    audioio_buffer_pair_t buffers;
+    uint8_t bits_per_sample;
+    bool samples_signed;
+    uint8_t channel_count;
+    uint32_t sample_rate;
+    audioio_resampler_quality_t quality;
+
+    // Q16.16 input frames per output frame. The part of a step below Q16 is kept as
+    // step_remainder / sample_rate and accumulated in remainder so playback doesn't drift.
+    uint32_t step;
+    uint32_t step_remainder;
+    uint32_t remainder;
+    // Q15 coefficients, AUDIOIO_RESAMPLER_FIR_TAPS for each phase. NULL for linear.
+    int16_t* coefficients;
+    uint8_t taps;
+
+    // Input converted to signed 16 bit with one row of work_stride frames per channel. The taps
+    // for the next output start at frame index and the output falls frac (Q16) past the center.
+    int16_t* work;
+    uint16_t work_stride;
+    uint16_t available;
+    uint16_t index;
+    uint32_t frac;
+
+    // Unread part of the last buffer from the sample.
+    uint8_t* source_buffer;
+    uint32_t source_length;
+    uint32_t source_skip; // frames
+    bool source_more_data;
+    bool source_flushed;
+} audioio_resampler_obj_t;
+
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_resampler_reset_buffer(audioio_resampler_obj_t* self,
+                                    bool single_channel,
+                                    uint8_t channel);
+audioio_get_buffer_result_t audioio_resampler_get_buffer(audioio_resampler_obj_t* self,
+                                                         bool single_channel,
+                                                         uint8_t channel,
+                                                         uint8_t** buffer,
+                                                         uint32_t* buffer_length); // length in bytes
+void audioio_resampler_get_buffer_structure(audioio_resampler_obj_t* self, bool single_channel,
+                                            bool* single_buffer, bool* samples_signed,
+                                            uint32_t* max_buffer_length, uint8_t* spacing);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_RESAMPLER_H
@@ -0,0 +1,361 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/audioio/Synthesizer.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "shared-module/audioio/__init__.h"
+#include "supervisor/shared/translate.h"
+
+// One cycle of a full scale sine, used until a waveform is given.
+static const int16_t sine[256] = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602, 6393, 7179, 7962, 8739,
+    9512, 10278, 11039, 11793, 12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594, 23170, 23731, 24279, 24811,
+    25329, 25832, 26319, 26790, 27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971, 32137, 32285, 32412, 32521,
+    32609, 32678, 32728, 32757, 32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+    32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571, 30273, 29956, 29621, 29268,
+    28898, 28510, 28105, 27683, 27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+    23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868, 18204, 17530, 16846, 16151,
+    15446, 14732, 14010, 13279, 12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+    6393, 5602, 4808, 4011, 3212, 2410, 1608, 804, 0, -804, -1608, -2410,
+    -3212, -4011, -4808, -5602, -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159,
+    -20787, -21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113,
+    -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580,
+    -31356, -31113, -30852, -30571, -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731, -23170, -22594, -22005, -21403,
+    -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179, -6393, -5602, -4808, -4011,
+    -3212, -2410, -1608, -804
+};
+
+void common_hal_audioio_synthesizer_construct(audioio_synthesizer_obj_t* self,
+                                              uint8_t voice_count,
+                                              uint32_t sample_rate,
+                                              bool samples_signed,
+                                              uint32_t buffer_size) {
+    self->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
+
+    self->first_buffer = m_malloc(self->len, false);
+    if (self->first_buffer == NULL) {
+        common_hal_audioio_synthesizer_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate first buffer"));
+    }
+
+    self->second_buffer = m_malloc(self->len, false);
+    if (self->second_buffer == NULL) {
+        common_hal_audioio_synthesizer_deinit(self);
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate second buffer"));
+    }
+
+    self->samples_signed = samples_signed;
+    self->sample_rate = sample_rate;
+    self->voice_count = voice_count;
+    self->waveform_buffer = NULL;
+    self->waveform_buffer_length = 0;
+    common_hal_audioio_synthesizer_set_waveform(self, mp_const_none, NULL, 0);
+    common_hal_audioio_synthesizer_set_envelope(self, 0.01, 0.1, 0.8, 0.1);
+
+    for (uint8_t i = 0; i < self->voice_count; i++) {
+        memset(&self->voice[i], 0, sizeof(audioio_synthesizer_voice_t));
+        self->voice[i].stage = AUDIOIO_SYNTHESIZER_OFF;
+    }
+    audioio_synthesizer_reset_buffer(self, false, 0);
+}
+
+void common_hal_audioio_synthesizer_deinit(audioio_synthesizer_obj_t* self) {
+    self->first_buffer = NULL;
+    self->second_buffer = NULL;
+    self->waveform_buffer = NULL;
+}
+
+bool common_hal_audioio_synthesizer_deinited(audioio_synthesizer_obj_t* self) {
+    return self->first_buffer == NULL;
+}
+
+uint32_t common_hal_audioio_synthesizer_get_sample_rate(audioio_synthesizer_obj_t* self) {
+    return self->sample_rate;
+}
+
+mp_obj_t common_hal_audioio_synthesizer_get_waveform(audioio_synthesizer_obj_t* self) {
+    return self->waveform_obj;
+}
+
+void common_hal_audioio_synthesizer_set_waveform(audioio_synthesizer_obj_t* self,
+                                                 mp_obj_t waveform_obj,
+                                                 const int16_t* waveform,
+                                                 uint32_t length) {
+    // Copy the new waveform before freeing the old copy so that a failed allocation leaves the
+    // old waveform playing. Buffers are only filled between bytecodes so the old copy isn't in use.
+    int16_t* copy = NULL;
+    if (waveform == NULL) {
+        waveform = sine;
+        length = MP_ARRAY_SIZE(sine);
+    } else {
+        copy = m_new(int16_t, length);
+        memcpy(copy, waveform, length * sizeof(int16_t));
+        waveform = copy;
+    }
+    if (self->waveform_buffer != NULL) {
+        m_del(int16_t, self->waveform_buffer, self->waveform_buffer_length);
+    }
+    self->waveform_buffer = copy;
+    self->waveform_buffer_length = copy == NULL ? 0 : length;
+    // The top bits of the phase index the waveform and the next 15 interpolate.
+    uint8_t shift = 32;
+    while (length > 1) {
+        length >>= 1;
+        shift--;
+    }
+    self->waveform_obj = waveform_obj;
+    self->waveform = waveform;
+    self->waveform_mask = (1 << (32 - shift)) - 1;
+    self->waveform_shift = shift;
+}
+
+void common_hal_audioio_synthesizer_get_envelope(audioio_synthesizer_obj_t* self,
+                                                 mp_float_t* attack, mp_float_t* decay,
+                                                 mp_float_t* sustain, mp_float_t* release) {
+    *attack = self->attack;
+    *decay = self->decay;
+    *sustain = self->sustain;
+    *release = self->release;
+}
+
+void common_hal_audioio_synthesizer_set_envelope(audioio_synthesizer_obj_t* self,
+                                                 mp_float_t attack, mp_float_t decay,
+                                                 mp_float_t sustain, mp_float_t release) {
+    self->attack = attack;
+    self->decay = decay;
+    self->sustain = sustain;
+    self->release = release;
+    self->attack_samples = attack * self->sample_rate;
+    self->decay_samples = decay * self->sample_rate;
+    self->sustain_q15 = sustain * INT16_MAX;
+    self->release_samples = release * self->sample_rate;
+}
+
+// Starts the given envelope stage from the voice's current envelope. Stages with no length are
+// skipped.
+static void enter_stage(audioio_synthesizer_obj_t* self, audioio_synthesizer_voice_t* voice,
+                        audioio_synthesizer_stage_t stage) {
+    voice->stage = stage;
+    voice->envelope_step = 0;
+    voice->stage_remaining = UINT32_MAX;
+    if (stage == AUDIOIO_SYNTHESIZER_ATTACK) {
+        if (self->attack_samples == 0) {
+            enter_stage(self, voice, AUDIOIO_SYNTHESIZER_DECAY);
+            return;
+        }
+        // A retriggered voice ramps from where it is so it doesn't click.
+        voice->stage_remaining = self->attack_samples;
+        voice->envelope_step = (voice->peak - voice->envelope) / (int32_t) self->attack_samples;
+    } else if (stage == AUDIOIO_SYNTHESIZER_DECAY) {
+        voice->envelope = voice->peak;
+        if (self->decay_samples == 0) {
+            enter_stage(self, voice, AUDIOIO_SYNTHESIZER_SUSTAIN);
+            return;
+        }
+        voice->stage_remaining = self->decay_samples;
+        voice->envelope_step = (voice->sustain_level - voice->peak) / (int32_t) self->decay_samples;
+    } else if (stage == AUDIOIO_SYNTHESIZER_SUSTAIN) {
+        voice->envelope = voice->sustain_level;
+        // Without sustain the note ends after its decay.
+        if (voice->sustain_level == 0) {
+            enter_stage(self, voice, AUDIOIO_SYNTHESIZER_OFF);
+        }
+    } else if (stage == AUDIOIO_SYNTHESIZER_RELEASE) {
+        if (self->release_samples == 0 || voice->envelope == 0) {
+            enter_stage(self, voice, AUDIOIO_SYNTHESIZER_OFF);
+            return;
+        }
+        voice->stage_remaining = self->release_samples;
+        voice->envelope_step = -voice->envelope / (int32_t) self->release_samples;
+    } else {
+        voice->envelope = 0;
+    }
+}
+
+void common_hal_audioio_synthesizer_note_on(audioio_synthesizer_obj_t* self, uint8_t v,
+                                            mp_float_t frequency, mp_float_t level) {
+    audioio_synthesizer_voice_t* voice = &self->voice[v];
+    voice->phase_step = frequency / self->sample_rate * (mp_float_t) 4294967296.0;
+    voice->peak = level * (1 << 30);
+    voice->sustain_level = ((int64_t) voice->peak * self->sustain_q15) >> 15;
+    if (voice->stage == AUDIOIO_SYNTHESIZER_OFF) {
+        voice->phase = 0;
+    }
+    enter_stage(self, voice, AUDIOIO_SYNTHESIZER_ATTACK);
+}
+
+void common_hal_audioio_synthesizer_note_off(audioio_synthesizer_obj_t* self, uint8_t v) {
+    audioio_synthesizer_voice_t* voice = &self->voice[v];
+    if (voice->stage != AUDIOIO_SYNTHESIZER_OFF && voice->stage != AUDIOIO_SYNTHESIZER_RELEASE) {
+        enter_stage(self, voice, AUDIOIO_SYNTHESIZER_RELEASE);
+    }
+}
+
+bool common_hal_audioio_synthesizer_get_playing(audioio_synthesizer_obj_t* self) {
+    for (uint8_t v = 0; v < self->voice_count; v++) {
+        if (self->voice[v].stage != AUDIOIO_SYNTHESIZER_OFF) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void audioio_synthesizer_reset_buffer(audioio_synthesizer_obj_t* self,
+                                      bool single_channel,
+                                      uint8_t channel) {
+    self->use_first_buffer = true;
+    self->read_count = 0;
+    self->left_read_count = 0;
+    self->right_read_count = 0;
+}
+
+// Adds length samples of the voice at a constant envelope slope to out. The waveform is linearly
+// interpolated and scaled by the Q15 part of the envelope.
+static void render_segment(audioio_synthesizer_obj_t* self, audioio_synthesizer_voice_t* voice,
+                           int16_t* out, uint32_t length) {
+    const int16_t* waveform = self->waveform;
+    uint32_t mask = self->waveform_mask;
+    uint8_t shift = self->waveform_shift;
+    uint32_t phase = voice->phase;
+    uint32_t phase_step = voice->phase_step;
+    int32_t envelope = voice->envelope;
+    int32_t envelope_step = voice->envelope_step;
+    for (uint32_t i = 0; i < length; i++) {
+        uint32_t index = phase >> shift;
+        int32_t fraction = (phase << (32 - shift)) >> 17;
+        int32_t a = waveform[index];
+        int32_t b = waveform[(index + 1) & mask];
+        int32_t value = a + (((b - a) * fraction) >> 15);
+        int32_t sample = out[i] + ((value * (envelope >> 15)) >> 15);
+        if (sample > INT16_MAX) {
+            sample = INT16_MAX;
+        } else if (sample < INT16_MIN) {
+            sample = INT16_MIN;
+        }
+        out[i] = sample;
+        phase += phase_step;
+        envelope += envelope_step;
+    }
+    voice->phase = phase;
+    voice->envelope = envelope;
+}
+
+static void render_voice(audioio_synthesizer_obj_t* self, audioio_synthesizer_voice_t* voice,
+                         int16_t* out, uint32_t length) {
+    while (length > 0 && voice->stage != AUDIOIO_SYNTHESIZER_OFF) {
+        uint32_t count = length;
+        if (count > voice->stage_remaining) {
+            count = voice->stage_remaining;
+        }
+        render_segment(self, voice, out, count);
+        out += count;
+        length -= count;
+        // Sustain lasts until note_off.
+        if (voice->stage == AUDIOIO_SYNTHESIZER_SUSTAIN) {
+            continue;
+        }
+        voice->stage_remaining -= count;
+        if (voice->stage_remaining == 0) {
+            enter_stage(self, voice, voice->stage + 1);
+        }
+    }
+}
+
+audioio_get_buffer_result_t audioio_synthesizer_get_buffer(audioio_synthesizer_obj_t* self,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length) {
+    if (!single_channel) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = self->left_read_count;
+    if (channel == 1) {
+        channel_read_count = self->right_read_count;
+    }
+    *buffer_length = self->len;
+
+    bool need_more_data = self->read_count == channel_read_count;
+    if (need_more_data) {
+        uint32_t* word_buffer;
+        if (self->use_first_buffer) {
+            word_buffer = self->first_buffer;
+        } else {
+            word_buffer = self->second_buffer;
+        }
+        *buffer = (uint8_t*) word_buffer;
+        self->use_first_buffer = !self->use_first_buffer;
+
+        uint32_t length = self->len / sizeof(uint32_t);
+        memset(word_buffer, 0, length * sizeof(uint32_t));
+        for (uint8_t v = 0; v < self->voice_count; v++) {
+            // We know the buffer is aligned because we allocated it onto the heap ourselves.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            render_voice(self, &self->voice[v], (int16_t*) word_buffer, length * 2);
+            #pragma GCC diagnostic pop
+        }
+        if (!self->samples_signed) {
+            for (uint32_t i = 0; i < length; i++) {
+                word_buffer[i] ^= 0x80008000;
+            }
+        }
+
+        self->read_count += 1;
+    } else if (!self->use_first_buffer) {
+        *buffer = (uint8_t*) self->first_buffer;
+    } else {
+        *buffer = (uint8_t*) self->second_buffer;
+    }
+
+    if (channel == 0) {
+        self->left_read_count += 1;
+    } else if (channel == 1) {
+        self->right_read_count += 1;
+    }
+    return GET_BUFFER_MORE_DATA;
+}
+
+void audioio_synthesizer_get_buffer_structure(audioio_synthesizer_obj_t* self, bool single_channel,
+                                              bool* single_buffer, bool* samples_signed,
+                                              uint32_t* max_buffer_length, uint8_t* spacing) {
+    *single_buffer = false;
+    *samples_signed = self->samples_signed;
+    *max_buffer_length = self->len;
+    *spacing = 1;
+}
@@ -0,0 +1,108 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_SYNTHESIZER_H
+#define MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_SYNTHESIZER_H
+
+#include "py/obj.h"
+
+#include "shared-module/audioio/__init__.h"
+
+// Envelope stages in the order a note goes through them.
+typedef enum {
+    AUDIOIO_SYNTHESIZER_ATTACK,
+    AUDIOIO_SYNTHESIZER_DECAY,
+    AUDIOIO_SYNTHESIZER_SUSTAIN,
+    AUDIOIO_SYNTHESIZER_RELEASE,
+    AUDIOIO_SYNTHESIZER_OFF,
+} audioio_synthesizer_stage_t;
+
+typedef struct {
+    // Position in the waveform as a fraction of a cycle, so 1 << 32 is a full cycle.
+    uint32_t phase;
+    uint32_t phase_step;
+    // Envelope levels are Q30. The envelope moves by envelope_step each sample for
+    // stage_remaining more samples.
+    int32_t envelope;
+    int32_t envelope_step;
+    int32_t peak;
+    int32_t sustain_level;
+    uint32_t stage_remaining;
+    audioio_synthesizer_stage_t stage;
+} audioio_synthesizer_voice_t;
+
+typedef struct {
+    mp_obj_base_t base;
+    uint32_t* first_buffer;
+    uint32_t* second_buffer;
+    uint32_t len; // in bytes
+    bool use_first_buffer;
+    bool samples_signed;
+    uint32_t sample_rate;
+
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+
+    // One cycle of 16 bit signed samples with a power of two length. waveform_obj is None for the
+    // built in sine. Otherwise waveform points to waveform_buffer, a copy of waveform_obj's data
+    // that stays valid if the array is changed or resized.
+    mp_obj_t waveform_obj;
+    const int16_t* waveform;
+    int16_t* waveform_buffer;
+    uint32_t waveform_buffer_length;
+    uint32_t waveform_mask;
+    uint8_t waveform_shift; // Turns a phase into a waveform index
+
+    // Envelope times in samples.
+    mp_float_t attack;
+    mp_float_t decay;
+    mp_float_t sustain;
+    mp_float_t release;
+    uint32_t attack_samples;
+    uint32_t decay_samples;
+    int16_t sustain_q15;
+    uint32_t release_samples;
+
+    uint8_t voice_count;
+    audioio_synthesizer_voice_t voice[];
+} audioio_synthesizer_obj_t;
+
+
+// These are not available from Python because it may be called in an interrupt.
+void audioio_synthesizer_reset_buffer(audioio_synthesizer_obj_t* self,
+                                      bool single_channel,
+                                      uint8_t channel);
+audioio_get_buffer_result_t audioio_synthesizer_get_buffer(audioio_synthesizer_obj_t* self,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length); // length in bytes
+void audioio_synthesizer_get_buffer_structure(audioio_synthesizer_obj_t* self, bool single_channel,
+                                              bool* single_buffer, bool* samples_signed,
+                                              uint32_t* max_buffer_length, uint8_t* spacing);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_SYNTHESIZER_H
@@ -29,6 +29,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "lib/oofatfs/diskio.h"
 #include "py/mperrno.h"
 #include "py/runtime.h"
 
@@ -42,11 +43,25 @@ struct wave_format_chunk {
     uint32_t byte_rate;
     uint16_t block_align;
     uint16_t bits_per_sample;
-    uint16_t extra_params; // Assumed to be zero below.
+    uint16_t extra_params; // Size of the format specific fields that follow.
+    uint16_t samples_per_block; // Only present for IMA ADPCM.
 };
 
+#define WAVE_FORMAT_PCM (0x0001)
+#define WAVE_FORMAT_ALAW (0x0006)
+#define WAVE_FORMAT_MULAW (0x0007)
+#define WAVE_FORMAT_IMA_ADPCM (0x0011)
+
+#if _MAX_SS == _MIN_SS
+#define SECTOR_SIZE(fs) ((uint32_t) _MIN_SS)
+#else
+#define SECTOR_SIZE(fs) ((uint32_t) (fs)->ssize)
+#endif
+
 void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
-                                           pyb_file_obj_t* file) {
+                                           pyb_file_obj_t* file,
+                                           uint32_t buffer_size,
+                                           uint8_t buffer_count) {
     // Load the wave
     self->file = file;
     uint8_t chunk_header[16];
@@ -65,71 +80,114 @@ void common_hal_audioio_wavefile_construct(audioio_wavefile_obj_t* self,
         mp_raise_OSError(MP_EIO);
     }
     if (bytes_read != 4 ||
+        format_size < 16 ||
         format_size > sizeof(struct wave_format_chunk)) {
         mp_raise_ValueError(translate("Invalid format chunk size"));
     }
     struct wave_format_chunk format;
+    memset(&format, 0, sizeof(format));
     if (f_read(&self->file->fp, &format, format_size, &bytes_read) != FR_OK) {
         mp_raise_OSError(MP_EIO);
     }
     if (bytes_read != format_size) {
+        mp_raise_ValueError(translate("Invalid format chunk size"));
     }
 
-    if (format.audio_format != 1 ||
-        format.num_channels > 2 ||
-        format.bits_per_sample > 16 ||
-        (format_size == 18 &&
-         format.extra_params != 0)) {
+    // Compressed formats are decoded to 16 bit samples.
+    self->bits_per_sample = 16;
+    bool supported = format.num_channels > 0 && format.num_channels <= 2;
+    if (format.audio_format == WAVE_FORMAT_PCM) {
+        self->encoding = AUDIOIO_WAVEFILE_PCM;
+        self->bits_per_sample = format.bits_per_sample;
+        supported = supported && format.bits_per_sample <= 16 &&
+            (format_size < 18 || format.extra_params == 0);
+    } else if (format.audio_format == WAVE_FORMAT_ALAW) {
+        self->encoding = AUDIOIO_WAVEFILE_ALAW;
+        supported = supported && format.bits_per_sample == 8;
+    } else if (format.audio_format == WAVE_FORMAT_MULAW) {
+        self->encoding = AUDIOIO_WAVEFILE_ULAW;
+        supported = supported && format.bits_per_sample == 8;
+    } else if (format.audio_format == WAVE_FORMAT_IMA_ADPCM) {
+        self->encoding = AUDIOIO_WAVEFILE_IMA_ADPCM;
+        // Blocks hold a four byte header and then four byte groups for each channel.
+        uint32_t group_size = 4 * format.num_channels;
+        supported = supported && format.bits_per_sample == 4 &&
+            format.block_align > group_size && format.block_align % group_size == 0;
+    } else {
+        supported = false;
+    }
+    if (!supported) {
         mp_raise_ValueError(translate("Unsupported format"));
     }
     // Get the sample_rate
     self->sample_rate = format.sample_rate;
-    self->len = 256;
+    // Each buffer holds whole words so that it stays aligned.
+    self->len = (buffer_size / buffer_count) & ~3;
+    self->buffer_count = buffer_count;
     self->channel_count = format.num_channels;
-    self->bits_per_sample = format.bits_per_sample;
-
-    // TODO(tannewt): Skip any extra chunks that occur before the data section.
-
-    uint8_t data_tag[4];
-    if (f_read(&self->file->fp, &data_tag, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4 ||
-        memcmp((uint8_t *) data_tag, "data", 4) != 0) {
-        mp_raise_ValueError(translate("Data chunk must follow fmt chunk"));
-    }
+    self->block_align = format.block_align;
 
+    // Skip any chunks, such as fact and LIST, that come before the data.
     uint32_t data_length;
-    if (f_read(&self->file->fp, &data_length, 4, &bytes_read) != FR_OK) {
-        mp_raise_OSError(MP_EIO);
-    }
-    if (bytes_read != 4) {
-        mp_raise_ValueError(translate("Invalid file"));
+    while (true) {
+        if (f_read(&self->file->fp, chunk_header, 8, &bytes_read) != FR_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
+        if (bytes_read != 8) {
+            mp_raise_ValueError(translate("Invalid file"));
+        }
+        memcpy(&data_length, chunk_header + 4, 4);
+        if (memcmp(chunk_header, "data", 4) == 0) {
+            break;
+        }
+        // Chunks are padded to an even length.
+        if (f_lseek(&self->file->fp, f_tell(&self->file->fp) + ((data_length + 1) & ~1)) != FR_OK) {
+            mp_raise_OSError(MP_EIO);
+        }
     }
     self->file_length = data_length;
     self->data_start = self->file->fp.fptr;
 
-    // Try to allocate two buffers, one will be loaded from file and the other
-    // DMAed to DAC.
-    self->buffer = m_malloc(self->len, false);
-    if (self->buffer == NULL) {
-        common_hal_audioio_wavefile_deinit(self);
-        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate first buffer"));
+    // When the file's clusters follow one another on disk, whole sectors are read straight into
+    // the audio buffers instead of going through FatFs. A link map with room for one fragment
+    // only fits contiguous files. Files open for writing can change under us so they always go
+    // through FatFs.
+    self->first_sector = 0;
+    FIL* fp = &self->file->fp;
+    if ((fp->flag & FA_WRITE) == 0) {
+        DWORD link_map[4] = {4, 0, 0, 0};
+        fp->cltbl = link_map;
+        FRESULT result = f_lseek(fp, CREATE_LINKMAP);
+        fp->cltbl = NULL;
+        if (result == FR_OK && link_map[2] >= 2) {
+            FATFS* fs = fp->obj.fs;
+            self->first_sector = fs->database + fs->csize * (link_map[2] - 2);
+        }
+    }
+
+    self->encoded = NULL;
+    if (self->encoding == AUDIOIO_WAVEFILE_IMA_ADPCM) {
+        self->encoded = m_malloc(AUDIOIO_WAVEFILE_ENCODED_BUFFER_SIZE, false);
     }
 
-    self->second_buffer = m_malloc(self->len, false);
-    if (self->second_buffer == NULL) {
+    // One buffer is DMAed to the DAC while the next is queued behind it. The rest are loaded
+    // ahead from the file.
+    self->buffers = m_malloc(self->len * buffer_count, false);
+    if (self->buffers == NULL) {
         common_hal_audioio_wavefile_deinit(self);
-        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate second buffer"));
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate first buffer"));
     }
+    self->first_slot = 0;
+    self->read_count = 0;
+    self->underruns = 0;
 }
 
 void common_hal_audioio_wavefile_deinit(audioio_wavefile_obj_t* self) {
-    self->buffer = NULL;
+    self->buffers = NULL;
 }
 
 bool common_hal_audioio_wavefile_deinited(audioio_wavefile_obj_t* self) {
-    return self->buffer == NULL;
+    return self->buffers == NULL;
 }
 
 uint32_t common_hal_audioio_wavefile_get_sample_rate(audioio_wavefile_obj_t* self) {
@@ -149,12 +207,16 @@ uint8_t common_hal_audioio_wavefile_get_channel_count(audioio_wavefile_obj_t* se
     return self->channel_count;
 }
 
+uint32_t common_hal_audioio_wavefile_get_underruns(audioio_wavefile_obj_t* self) {
+    return self->underruns;
+}
+
 bool audioio_wavefile_samples_signed(audioio_wavefile_obj_t* self) {
     return self->bits_per_sample > 8;
 }
 
 uint32_t audioio_wavefile_max_buffer_length(audioio_wavefile_obj_t* self) {
-    return 512;
+    return self->len;
 }
 
 void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t* self,
@@ -163,15 +225,345 @@ void audioio_wavefile_reset_buffer(audioio_wavefile_obj_t* self,
     if (single_channel && channel == 1) {
         return;
     }
-    // We don't reset the buffer index in case we're looping and we have an odd number of buffer
-    // loads
+    // Loading carries on from the buffer after the last one loaded because the output may still
+    // be playing it when we loop.
+    self->first_slot = (self->first_slot + self->read_count) % self->buffer_count;
+    self->single_channel = single_channel;
     self->bytes_remaining = self->file_length;
     f_lseek(&self->file->fp, self->data_start);
+    self->block_remaining = 0;
+    self->encoded_length = 0;
+    self->pending_count = 0;
     self->read_count = 0;
     self->left_read_count = 0;
     self->right_read_count = 0;
 }
 
+// G.711 decoders from the reference implementation, producing 16 bit samples.
+static int16_t alaw_decode(uint8_t value) {
+    value ^= 0x55;
+    int32_t magnitude = (value & 0x0f) << 4;
+    int32_t segment = (value & 0x70) >> 4;
+    if (segment == 0) {
+        magnitude += 8;
+    } else {
+        magnitude = (magnitude + 0x108) << (segment - 1);
+    }
+    return (value & 0x80) ? magnitude : -magnitude;
+}
+
+static int16_t ulaw_decode(uint8_t value) {
+    value = ~value;
+    int32_t magnitude = ((((value & 0x0f) << 3) + 0x84) << ((value & 0x70) >> 4)) - 0x84;
+    return (value & 0x80) ? -magnitude : magnitude;
+}
+
+static const int16_t ima_step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+    73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t ima_index_table[8] = {
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+static int16_t ima_decode(audioio_wavefile_adpcm_channel_t* channel, uint8_t nibble) {
+    int32_t step = ima_step_table[channel->step_index];
+    int32_t difference = step >> 3;
+    if (nibble & 1) {
+        difference += step >> 2;
+    }
+    if (nibble & 2) {
+        difference += step >> 1;
+    }
+    if (nibble & 4) {
+        difference += step;
+    }
+    int32_t predictor = channel->predictor;
+    if (nibble & 8) {
+        predictor -= difference;
+    } else {
+        predictor += difference;
+    }
+    if (predictor > INT16_MAX) {
+        predictor = INT16_MAX;
+    } else if (predictor < INT16_MIN) {
+        predictor = INT16_MIN;
+    }
+    channel->predictor = predictor;
+
+    int32_t step_index = channel->step_index + ima_index_table[nibble & 7];
+    if (step_index < 0) {
+        step_index = 0;
+    } else if (step_index > 88) {
+        step_index = 88;
+    }
+    channel->step_index = step_index;
+    return predictor;
+}
+
+// Reads up to length bytes of the data chunk from the current position. Whole sectors of a
+// contiguous file are read from the disk directly. Returns false if the file can't be read.
+static bool read_data(audioio_wavefile_obj_t* self, uint8_t* data, uint32_t length,
+                      uint32_t* length_read) {
+    FIL* fp = &self->file->fp;
+    uint32_t position = self->data_start + self->file_length - self->bytes_remaining;
+    uint32_t direct = 0;
+    if (self->first_sector != 0) {
+        uint32_t sector_size = SECTOR_SIZE(fp->obj.fs);
+        uint32_t sectors = length / sector_size;
+        uint32_t file_sectors = (fp->obj.objsize - position) / sector_size;
+        if (sectors > file_sectors) {
+            sectors = file_sectors;
+        }
+        if (position % sector_size == 0 && sectors > 0) {
+            if (disk_read(fp->obj.fs->drv, data, self->first_sector + position / sector_size,
+                          sectors) != RES_OK) {
+                return false;
+            }
+            direct = sectors * sector_size;
+        }
+    }
+    *length_read = direct;
+    if (direct == length) {
+        return true;
+    }
+    // Direct reads leave the file position behind.
+    position += direct;
+    if (fp->fptr != position && f_lseek(fp, position) != FR_OK) {
+        return false;
+    }
+    UINT count;
+    if (f_read(fp, data + direct, length - direct, &count) != FR_OK) {
+        return false;
+    }
+    *length_read += count;
+    return true;
+}
+
+// Copies up to length bytes of IMA ADPCM data into data, refilling the encoded buffer from the
+// file as needed. Returns the number of bytes copied or -1 if the file can't be read.
+static int32_t read_encoded(audioio_wavefile_obj_t* self, uint8_t* data, uint32_t length) {
+    uint32_t copied = 0;
+    while (copied < length) {
+        if (self->encoded_length == 0) {
+            if (self->bytes_remaining == 0) {
+                break;
+            }
+            uint32_t to_read = AUDIOIO_WAVEFILE_ENCODED_BUFFER_SIZE;
+            if (to_read > self->bytes_remaining) {
+                to_read = self->bytes_remaining;
+            }
+            uint32_t length_read;
+            if (!read_data(self, self->encoded, to_read, &length_read)) {
+                return -1;
+            }
+            self->bytes_remaining -= length_read;
+            if (length_read == 0) {
+                // The file is shorter than its data chunk claims.
+                self->bytes_remaining = 0;
+                break;
+            }
+            self->encoded_offset = 0;
+            self->encoded_length = length_read;
+        }
+        uint32_t count = length - copied;
+        if (count > self->encoded_length) {
+            count = self->encoded_length;
+        }
+        memcpy(data + copied, self->encoded + self->encoded_offset, count);
+        self->encoded_offset += count;
+        self->encoded_length -= count;
+        copied += count;
+    }
+    return copied;
+}
+
+// Decodes the next block header or group of IMA ADPCM samples into pending. Returns false at the
+// end of the data.
+static bool decode_adpcm_group(audioio_wavefile_obj_t* self) {
+    uint8_t channels = self->channel_count;
+    uint8_t data[4 * 2];
+    self->pending_offset = 0;
+    self->pending_count = 0;
+    if (self->block_remaining == 0) {
+        // Each block starts with the first sample and step index of each channel.
+        int32_t length = read_encoded(self, data, 4 * channels);
+        if (length < 4 * channels) {
+            return false;
+        }
+        for (uint8_t c = 0; c < channels; c++) {
+            audioio_wavefile_adpcm_channel_t* channel = &self->adpcm[c];
+            channel->predictor = (int16_t) (data[4 * c] | (data[4 * c + 1] << 8));
+            channel->step_index = data[4 * c + 2] > 88 ? 88 : data[4 * c + 2];
+            self->pending[c] = channel->predictor;
+        }
+        self->block_remaining = self->block_align - 4 * channels;
+        self->pending_count = 1;
+        return true;
+    }
+
+    // Each channel has four bytes holding eight samples, low nibble first.
+    int32_t length = read_encoded(self, data, 4 * channels);
+    self->block_remaining -= 4 * channels;
+    // Only a mono group can be cut short because stereo groups hold each channel in turn.
+    if (length <= 0 || (channels == 2 && length != 4 * channels)) {
+        self->block_remaining = 0;
+        return false;
+    }
+    uint32_t bytes_per_channel = length / channels;
+    for (uint8_t c = 0; c < channels; c++) {
+        audioio_wavefile_adpcm_channel_t* channel = &self->adpcm[c];
+        const uint8_t* group = data + 4 * c;
+        for (uint32_t i = 0; i < bytes_per_channel; i++) {
+            self->pending[(2 * i) * channels + c] = ima_decode(channel, group[i] & 0xf);
+            self->pending[(2 * i + 1) * channels + c] = ima_decode(channel, group[i] >> 4);
+        }
+    }
+    self->pending_count = 2 * bytes_per_channel;
+    return true;
+}
+
+static bool data_remaining(audioio_wavefile_obj_t* self) {
+    return self->bytes_remaining > 0 || self->encoded_length > 0 || self->pending_count > 0;
+}
+
+// Loads the next buffer of samples from the file, decoding them if needed. Returns false if the
+// file can't be read.
+static bool load_buffer(audioio_wavefile_obj_t* self, uint8_t* buffer, uint32_t* length) {
+    if (self->encoding == AUDIOIO_WAVEFILE_IMA_ADPCM) {
+        // We know the buffer is aligned because we allocated it onto the heap ourselves.
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wcast-align"
+        int16_t* samples = (int16_t*) buffer;
+        #pragma GCC diagnostic pop
+        uint8_t channels = self->channel_count;
+        uint32_t frames = self->len / (2 * channels);
+        uint32_t produced = 0;
+        while (produced < frames) {
+            if (self->pending_count == 0 && !decode_adpcm_group(self)) {
+                // Stop at a truncated block or group.
+                self->pending_count = 0;
+                self->encoded_length = 0;
+                self->bytes_remaining = 0;
+                break;
+            }
+            uint32_t count = frames - produced;
+            if (count > self->pending_count) {
+                count = self->pending_count;
+            }
+            memcpy(samples + produced * channels, self->pending + self->pending_offset * channels,
+                   count * channels * sizeof(int16_t));
+            self->pending_offset += count;
+            self->pending_count -= count;
+            produced += count;
+        }
+        *length = produced * channels * sizeof(int16_t);
+        return true;
+    }
+
+    uint32_t num_bytes_to_load = self->len;
+    if (self->encoding != AUDIOIO_WAVEFILE_PCM) {
+        // Each 8 bit A-law or mu-law byte decodes to a 16 bit sample.
+        num_bytes_to_load = self->len / 2;
+    }
+    uint32_t sector_size = self->first_sector != 0 ? SECTOR_SIZE(self->file->fp.obj.fs) : 0;
+    if (sector_size != 0 && num_bytes_to_load >= sector_size) {
+        // Stop the first load at a sector boundary so that later ones read whole sectors. The
+        // boundary has to fall between frames. Loads smaller than a sector never read directly so
+        // they aren't cut short.
+        uint32_t position = self->data_start + self->file_length - self->bytes_remaining;
+        uint32_t to_boundary = (sector_size - position % sector_size) % sector_size;
+        uint8_t frame_size = self->channel_count;
+        if (self->encoding == AUDIOIO_WAVEFILE_PCM) {
+            frame_size *= self->bits_per_sample / 8;
+        }
+        if (to_boundary > 0 && to_boundary < num_bytes_to_load && to_boundary % frame_size == 0) {
+            num_bytes_to_load = to_boundary;
+        }
+    }
+    if (num_bytes_to_load > self->bytes_remaining) {
+        num_bytes_to_load = self->bytes_remaining;
+    }
+    uint32_t length_read;
+    if (!read_data(self, buffer, num_bytes_to_load, &length_read)) {
+        return false;
+    }
+    self->bytes_remaining -= length_read;
+    if (length_read < num_bytes_to_load) {
+        // The file is shorter than its data chunk claims.
+        self->bytes_remaining = 0;
+    }
+    if (self->encoding != AUDIOIO_WAVEFILE_PCM) {
+        // Decode in place from the end so that each sample is written over bytes already decoded.
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wcast-align"
+        int16_t* samples = (int16_t*) buffer;
+        #pragma GCC diagnostic pop
+        if (self->encoding == AUDIOIO_WAVEFILE_ALAW) {
+            for (int32_t i = length_read - 1; i >= 0; i--) {
+                samples[i] = alaw_decode(buffer[i]);
+            }
+        } else {
+            for (int32_t i = length_read - 1; i >= 0; i--) {
+                samples[i] = ulaw_decode(buffer[i]);
+            }
+        }
+        length_read *= 2;
+    }
+    // Pad the last buffer to word align it.
+    if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
+        uint32_t pad = length_read % sizeof(uint32_t);
+        length_read += pad;
+        if (self->bits_per_sample == 8) {
+            for (uint32_t i = 0; i < pad; i++) {
+                buffer[length_read / sizeof(uint8_t) - i - 1] = 0x80;
+            }
+        } else if (self->bits_per_sample == 16) {
+            // We know the buffer is aligned because we allocated it onto the heap ourselves.
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wcast-align"
+            ((int16_t*) buffer)[length_read / sizeof(int16_t) - 1] = 0;
+            #pragma GCC diagnostic pop
+        }
+    }
+    *length = length_read;
+    return true;
+}
+
+// Loads the next buffer in the ring. Returns false if the file can't be read.
+static bool load_next_buffer(audioio_wavefile_obj_t* self) {
+    uint8_t slot = (self->first_slot + self->read_count) % self->buffer_count;
+    uint32_t length_read;
+    if (!load_buffer(self, self->buffers + slot * self->len, &length_read)) {
+        return false;
+    }
+    self->buffer_lengths[slot] = length_read;
+    self->read_count += 1;
+    return true;
+}
+
+void audioio_wavefile_background(audioio_wavefile_obj_t* self) {
+    if (common_hal_audioio_wavefile_deinited(self)) {
+        return;
+    }
+    uint32_t consumed = self->left_read_count;
+    if (self->single_channel && self->right_read_count < consumed) {
+        consumed = self->right_read_count;
+    }
+    // The output may still be playing the last buffer it got and the one before it so only the
+    // buffers older than those are reused. A failed read is left for get_buffer to report.
+    while (self->read_count + 2 < consumed + self->buffer_count && data_remaining(self)) {
+        if (!load_next_buffer(self)) {
+            return;
+        }
+    }
+}
+
 audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t* self,
                                                         bool single_channel,
                                                         uint8_t channel,
@@ -188,61 +580,26 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
 
     bool need_more_data = self->read_count == channel_read_count;
 
-    if (self->bytes_remaining == 0 && need_more_data) {
+    if (!data_remaining(self) && need_more_data) {
         *buffer = NULL;
         *buffer_length = 0;
         return GET_BUFFER_DONE;
     }
 
     if (need_more_data) {
-        uint16_t num_bytes_to_load = self->len;
-        if (num_bytes_to_load > self->bytes_remaining) {
-            num_bytes_to_load = self->bytes_remaining;
-        }
-        UINT length_read;
-        if (self->buffer_index % 2 == 1) {
-            *buffer = self->second_buffer;
-        } else {
-            *buffer = self->buffer;
+        // The background didn't get to this buffer in time. The first buffer after a reset is
+        // always loaded here.
+        if (channel_read_count > 0) {
+            self->underruns += 1;
         }
-        if (f_read(&self->file->fp, *buffer, num_bytes_to_load, &length_read) != FR_OK) {
+        if (!load_next_buffer(self)) {
             return GET_BUFFER_ERROR;
         }
-        self->bytes_remaining -= length_read;
-        // Pad the last buffer to word align it.
-        if (self->bytes_remaining == 0 && length_read % sizeof(uint32_t) != 0) {
-            uint32_t pad = length_read % sizeof(uint32_t);
-            length_read += pad;
-            if (self->bits_per_sample == 8) {
-                for (uint32_t i = 0; i < pad; i++) {
-                    ((uint8_t*) (*buffer))[length_read / sizeof(uint8_t) - i - 1] = 0x80;
-                }
-            } else if (self->bits_per_sample == 16) {
-                // We know the buffer is aligned because we allocated it onto the heap ourselves.
-                #pragma GCC diagnostic push
-                #pragma GCC diagnostic ignored "-Wcast-align"
-                ((int16_t*) (*buffer))[length_read / sizeof(int16_t) - 1] = 0;
-                #pragma GCC diagnostic pop
-            }
-        }
-        *buffer_length = length_read;
-        if (self->buffer_index % 2 == 1) {
-            self->second_buffer_length = length_read;
-        } else {
-            self->buffer_length = length_read;
-        }
-        self->buffer_index += 1;
-        self->read_count += 1;
     }
 
-    uint32_t buffers_back = self->read_count - 1 - channel_read_count;
-    if ((self->buffer_index - buffers_back) % 2 == 0) {
-        *buffer = self->second_buffer;
-        *buffer_length = self->second_buffer_length;
-    } else {
-        *buffer = self->buffer;
-        *buffer_length = self->buffer_length;
-    }
+    uint8_t slot = (self->first_slot + channel_read_count) % self->buffer_count;
+    *buffer = self->buffers + slot * self->len;
+    *buffer_length = self->buffer_lengths[slot];
 
     if (channel == 0) {
         self->left_read_count += 1;
@@ -251,7 +608,9 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
         *buffer = *buffer + self->bits_per_sample / 8;
     }
 
-    return self->bytes_remaining == 0 ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+    // Done once this channel has every buffer and nothing more is left to load.
+    bool more_data = data_remaining(self) || channel_read_count + 1 < self->read_count;
+    return more_data ? GET_BUFFER_MORE_DATA : GET_BUFFER_DONE;
 }
 
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool single_channel,
@@ -259,7 +618,7 @@ void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool si
                                            uint32_t* max_buffer_length, uint8_t* spacing) {
     *single_buffer = false;
     *samples_signed = self->bits_per_sample > 8;
-    *max_buffer_length = 512;
+    *max_buffer_length = self->len;
     if (single_channel) {
         *spacing = self->channel_count;
     } else {
@@ -27,20 +27,44 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_WAVEFILE_H
 #define MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_WAVEFILE_H
 
+#include "extmod/vfs_fat.h"
 #include "py/obj.h"
 
 #include "shared-module/audioio/__init__.h"
 
+typedef enum {
+    AUDIOIO_WAVEFILE_PCM,
+    AUDIOIO_WAVEFILE_ALAW,
+    AUDIOIO_WAVEFILE_ULAW,
+    AUDIOIO_WAVEFILE_IMA_ADPCM,
+} audioio_wavefile_encoding_t;
+
+typedef struct {
+    int16_t predictor;
+    uint8_t step_index;
+} audioio_wavefile_adpcm_channel_t;
+
+// Largest number of IMA ADPCM frames decoded at once, from one four byte group per channel.
+#define AUDIOIO_WAVEFILE_ADPCM_GROUP_FRAMES (8)
+// Size of the buffer that IMA ADPCM data is read into from the file.
+#define AUDIOIO_WAVEFILE_ENCODED_BUFFER_SIZE (128)
+// Most buffers in the read ahead ring.
+#define AUDIOIO_WAVEFILE_MAX_BUFFERS (8)
+
 typedef struct {
     mp_obj_base_t base;
-    uint8_t* buffer;
-    uint32_t buffer_length;
-    uint8_t* second_buffer;
-    uint32_t second_buffer_length;
+    // buffer_count buffers of len bytes each. Buffers are loaded in turn and the ones that the
+    // output isn't using are filled ahead of time from the background.
+    uint8_t* buffers;
+    uint32_t buffer_lengths[AUDIOIO_WAVEFILE_MAX_BUFFERS];
+    uint8_t buffer_count;
+    uint8_t first_slot; // Buffer that the first load after a reset goes into
+    bool single_channel;
+    uint32_t underruns;
     uint32_t file_length; // In bytes
-    uint16_t data_start; // Where the data values start
-    uint8_t bits_per_sample;
-    uint16_t buffer_index;
+    uint32_t data_start; // Where the data values start
+    uint32_t first_sector; // Of the file when its clusters are contiguous, otherwise 0
+    uint8_t bits_per_sample; // Of the decoded samples
     uint32_t bytes_remaining;
 
     uint8_t channel_count;
@@ -49,9 +73,21 @@ typedef struct {
     uint32_t len;
     pyb_file_obj_t* file;
 
-    uint32_t read_count;
+    uint32_t read_count; // Buffers loaded since the last reset
     uint32_t left_read_count;
     uint32_t right_read_count;
+
+    // Compressed formats are decoded into 16 bit samples as buffers are loaded.
+    audioio_wavefile_encoding_t encoding;
+    uint16_t block_align;
+    uint16_t block_remaining; // Bytes left in the current IMA ADPCM block
+    uint8_t* encoded;
+    uint16_t encoded_offset;
+    uint16_t encoded_length;
+    audioio_wavefile_adpcm_channel_t adpcm[2];
+    int16_t pending[AUDIOIO_WAVEFILE_ADPCM_GROUP_FRAMES * 2];
+    uint8_t pending_offset; // In frames
+    uint8_t pending_count; // In frames
 } audioio_wavefile_obj_t;
 
 // These are not available from Python because it may be called in an interrupt.
@@ -66,5 +102,7 @@ audioio_get_buffer_result_t audioio_wavefile_get_buffer(audioio_wavefile_obj_t*
 void audioio_wavefile_get_buffer_structure(audioio_wavefile_obj_t* self, bool single_channel,
                                            bool* single_buffer, bool* samples_signed,
                                            uint32_t* max_buffer_length, uint8_t* spacing);
+// Loads buffers ahead of the output. Called from background tasks while the file plays.
+void audioio_wavefile_background(audioio_wavefile_obj_t* self);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO_WAVEFILE_H
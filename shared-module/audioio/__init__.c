@@ -26,13 +26,19 @@
 
 #include "shared-module/audioio/__init__.h"
 
-#include "py/obj.h"
+#include "py/runtime.h"
 #include "shared-bindings/audioio/Mixer.h"
 #include "shared-bindings/audioio/RawSample.h"
+#include "shared-bindings/audioio/Resampler.h"
+#include "shared-bindings/audioio/Synthesizer.h"
 #include "shared-bindings/audioio/WaveFile.h"
+#include "shared-module/audioio/Effect.h"
 #include "shared-module/audioio/Mixer.h"
 #include "shared-module/audioio/RawSample.h"
+#include "shared-module/audioio/Resampler.h"
+#include "shared-module/audioio/Synthesizer.h"
 #include "shared-module/audioio/WaveFile.h"
+#include "supervisor/shared/translate.h"
 
 uint32_t audiosample_sample_rate(mp_obj_t sample_obj) {
     if (MP_OBJ_IS_TYPE(sample_obj, &audioio_rawsample_type)) {
@@ -44,6 +50,15 @@ uint32_t audiosample_sample_rate(mp_obj_t sample_obj) {
     } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_mixer_type)) {
         audioio_mixer_obj_t* mixer = MP_OBJ_TO_PTR(sample_obj);
         return mixer->sample_rate;
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        return resampler->sample_rate;
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_synthesizer_type)) {
+        audioio_synthesizer_obj_t* synthesizer = MP_OBJ_TO_PTR(sample_obj);
+        return synthesizer->sample_rate;
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        return effect->sample_rate;
     }
     return 16000;
 }
@@ -58,6 +73,14 @@ uint8_t audiosample_bits_per_sample(mp_obj_t sample_obj) {
     } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_mixer_type)) {
         audioio_mixer_obj_t* mixer = MP_OBJ_TO_PTR(sample_obj);
         return mixer->bits_per_sample;
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        return resampler->bits_per_sample;
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_synthesizer_type)) {
+        return 16;
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        return effect->bits_per_sample;
     }
     return 8;
 }
@@ -72,6 +95,14 @@ uint8_t audiosample_channel_count(mp_obj_t sample_obj) {
     } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_mixer_type)) {
         audioio_mixer_obj_t* mixer = MP_OBJ_TO_PTR(sample_obj);
         return mixer->channel_count;
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        return resampler->channel_count;
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_synthesizer_type)) {
+        return 1;
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        return effect->channel_count;
     }
     return 1;
 }
@@ -86,6 +117,15 @@ void audiosample_reset_buffer(mp_obj_t sample_obj, bool single_channel, uint8_t
     } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_mixer_type)) {
         audioio_mixer_obj_t* file = MP_OBJ_TO_PTR(sample_obj);
         audioio_mixer_reset_buffer(file, single_channel, audio_channel);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        audioio_resampler_reset_buffer(resampler, single_channel, audio_channel);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_synthesizer_type)) {
+        audioio_synthesizer_obj_t* synthesizer = MP_OBJ_TO_PTR(sample_obj);
+        audioio_synthesizer_reset_buffer(synthesizer, single_channel, audio_channel);
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        audioio_effect_reset_buffer(effect, single_channel, audio_channel);
     }
 }
 
@@ -102,6 +142,16 @@ audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
     } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_mixer_type)) {
         audioio_mixer_obj_t* file = MP_OBJ_TO_PTR(sample_obj);
         return audioio_mixer_get_buffer(file, single_channel, channel, buffer, buffer_length);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        return audioio_resampler_get_buffer(resampler, single_channel, channel, buffer, buffer_length);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_synthesizer_type)) {
+        audioio_synthesizer_obj_t* synthesizer = MP_OBJ_TO_PTR(sample_obj);
+        return audioio_synthesizer_get_buffer(synthesizer, single_channel, channel, buffer,
+                                              buffer_length);
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        return audioio_effect_get_buffer(effect, single_channel, channel, buffer, buffer_length);
     }
     return GET_BUFFER_DONE;
 }
@@ -121,5 +171,157 @@ void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel,
         audioio_mixer_obj_t* file = MP_OBJ_TO_PTR(sample_obj);
         audioio_mixer_get_buffer_structure(file, single_channel, single_buffer, samples_signed,
                                               max_buffer_length, spacing);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        audioio_resampler_get_buffer_structure(resampler, single_channel, single_buffer,
+                                               samples_signed, max_buffer_length, spacing);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_synthesizer_type)) {
+        audioio_synthesizer_obj_t* synthesizer = MP_OBJ_TO_PTR(sample_obj);
+        audioio_synthesizer_get_buffer_structure(synthesizer, single_channel, single_buffer,
+                                                 samples_signed, max_buffer_length, spacing);
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        audioio_effect_get_buffer_structure(effect, single_channel, single_buffer,
+                                            samples_signed, max_buffer_length, spacing);
+    }
+}
+
+void audiosample_background(mp_obj_t sample_obj) {
+    if (MP_OBJ_IS_TYPE(sample_obj, &audioio_wavefile_type)) {
+        audioio_wavefile_obj_t* file = MP_OBJ_TO_PTR(sample_obj);
+        audioio_wavefile_background(file);
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_mixer_type)) {
+        audioio_mixer_obj_t* mixer = MP_OBJ_TO_PTR(sample_obj);
+        for (uint8_t i = 0; i < mixer->voice_count; i++) {
+            if (mixer->voice[i].sample != NULL) {
+                audiosample_background(mixer->voice[i].sample);
+            }
+        }
+    } else if (MP_OBJ_IS_TYPE(sample_obj, &audioio_resampler_type)) {
+        audioio_resampler_obj_t* resampler = MP_OBJ_TO_PTR(sample_obj);
+        audiosample_background(resampler->sample);
+    } else if (audioio_effect_is_effect(sample_obj)) {
+        audioio_effect_obj_t* effect = MP_OBJ_TO_PTR(sample_obj);
+        audiosample_background(effect->sample);
+    }
+}
+
+void audioio_buffer_pair_construct(audioio_buffer_pair_t* pair, uint32_t buffer_size,
+                                   uint8_t bits_per_sample) {
+    pair->len = buffer_size / 2 / sizeof(uint32_t) * sizeof(uint32_t);
+    uint32_t allocation = pair->len * 16 / bits_per_sample;
+    pair->second_buffer = NULL;
+    pair->first_buffer = m_malloc(allocation, false);
+    if (pair->first_buffer == NULL) {
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate first buffer"));
+    }
+
+    pair->second_buffer = m_malloc(allocation, false);
+    if (pair->second_buffer == NULL) {
+        pair->first_buffer = NULL;
+        mp_raise_msg(&mp_type_MemoryError, translate("Couldn't allocate second buffer"));
+    }
+    audioio_buffer_pair_reset(pair);
+}
+
+void audioio_buffer_pair_reset(audioio_buffer_pair_t* pair) {
+    pair->use_first_buffer = true;
+    pair->read_count = 0;
+    pair->left_read_count = 0;
+    pair->right_read_count = 0;
+}
+
+audioio_get_buffer_result_t audioio_buffer_pair_get_buffer(audioio_buffer_pair_t* pair,
+                                                           void* self,
+                                                           audioio_buffer_pair_fill_t fill,
+                                                           uint8_t bits_per_sample,
+                                                           uint8_t channel_count,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length) {
+    if (!single_channel) {
+        channel = 0;
+    }
+
+    uint32_t channel_read_count = pair->left_read_count;
+    if (channel == 1) {
+        channel_read_count = pair->right_read_count;
+    }
+
+    bool need_more_data = pair->read_count == channel_read_count;
+    if (need_more_data) {
+        if (pair->use_first_buffer) {
+            *buffer = pair->first_buffer;
+        } else {
+            *buffer = pair->second_buffer;
+        }
+        pair->use_first_buffer = !pair->use_first_buffer;
+
+        uint32_t frame_size = channel_count * bits_per_sample / 8;
+        uint32_t frames = pair->len / frame_size;
+        uint32_t produced = fill(self, *buffer, frames);
+        pair->last_length = produced * frame_size;
+        pair->last_result = produced < frames ? GET_BUFFER_DONE : GET_BUFFER_MORE_DATA;
+
+        pair->read_count += 1;
+    } else if (!pair->use_first_buffer) {
+        *buffer = pair->first_buffer;
+    } else {
+        *buffer = pair->second_buffer;
+    }
+    *buffer_length = pair->last_length;
+
+    if (channel == 0) {
+        pair->left_read_count += 1;
+    } else if (channel == 1) {
+        pair->right_read_count += 1;
+        *buffer = *buffer + bits_per_sample / 8;
+    }
+    return pair->last_result;
+}
+
+void audioio_convert_to_s16(int16_t* out, const uint8_t* in, uint32_t count, uint8_t stride,
+                            uint8_t bits_per_sample, bool samples_signed) {
+    if (bits_per_sample == 16) {
+        // Sample buffers are word aligned.
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wcast-align"
+        const int16_t* in16 = (const int16_t*) in;
+        #pragma GCC diagnostic pop
+        int16_t flip = samples_signed ? 0 : 0x8000;
+        for (uint32_t i = 0; i < count; i++) {
+            out[i] = in16[i * stride] ^ flip;
+        }
+    } else {
+        uint8_t flip = samples_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < count; i++) {
+            out[i] = ((int8_t) (in[i * stride] ^ flip)) << 8;
+        }
+    }
+}
+
+void audioio_pack_from_s16(uint8_t* buffer, uint32_t count, uint8_t bits_per_sample,
+                           bool samples_signed) {
+    // We know the buffer is aligned because it was allocated on the heap.
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wcast-align"
+    int16_t* samples = (int16_t*) buffer;
+    #pragma GCC diagnostic pop
+    if (bits_per_sample == 8) {
+        // Each byte is written at or before the sample it comes from. Round to the nearest 8 bit
+        // value rather than truncating so that the output isn't biased down by half an LSB.
+        uint8_t flip = samples_signed ? 0 : 0x80;
+        for (uint32_t i = 0; i < count; i++) {
+            int32_t rounded = (samples[i] + 0x80) >> 8;
+            if (rounded > INT8_MAX) {
+                rounded = INT8_MAX;
+            }
+            buffer[i] = ((uint8_t) rounded) ^ flip;
+        }
+    } else if (!samples_signed) {
+        for (uint32_t i = 0; i < count; i++) {
+            samples[i] ^= 0x8000;
+        }
     }
 }
@@ -49,5 +49,48 @@ audioio_get_buffer_result_t audiosample_get_buffer(mp_obj_t sample_obj,
 void audiosample_get_buffer_structure(mp_obj_t sample_obj, bool single_channel,
                                       bool* single_buffer, bool* samples_signed,
                                       uint32_t* max_buffer_length, uint8_t* spacing);
+// Lets samples that read from files load ahead of the output. Called from background tasks for
+// each sample that is playing.
+void audiosample_background(mp_obj_t sample_obj);
+
+// Output buffers of samples, such as the effects and Resampler, that work on another sample's
+// frames as signed 16 bit samples and play them back in that sample's format.
+typedef struct {
+    uint8_t* first_buffer;
+    uint8_t* second_buffer;
+    uint32_t len; // in bytes
+    bool use_first_buffer;
+    uint32_t read_count;
+    uint32_t left_read_count;
+    uint32_t right_read_count;
+    uint32_t last_length;
+    audioio_get_buffer_result_t last_result;
+} audioio_buffer_pair_t;
+
+// Fills buffer with up to frames frames and returns how many it produced, which is less than
+// frames once the sample has ended.
+typedef uint32_t (*audioio_buffer_pair_fill_t)(void* self, uint8_t* buffer, uint32_t frames);
+
+// Allocates two buffers that hold buffer_size bytes between them. Each has room for its frames as
+// 16 bit samples so that 8 bit output can be packed in place.
+void audioio_buffer_pair_construct(audioio_buffer_pair_t* pair, uint32_t buffer_size,
+                                   uint8_t bits_per_sample);
+void audioio_buffer_pair_reset(audioio_buffer_pair_t* pair);
+audioio_get_buffer_result_t audioio_buffer_pair_get_buffer(audioio_buffer_pair_t* pair,
+                                                           void* self,
+                                                           audioio_buffer_pair_fill_t fill,
+                                                           uint8_t bits_per_sample,
+                                                           uint8_t channel_count,
+                                                           bool single_channel,
+                                                           uint8_t channel,
+                                                           uint8_t** buffer,
+                                                           uint32_t* buffer_length);
+
+// Converts count samples, each stride samples apart, to signed 16 bit.
+void audioio_convert_to_s16(int16_t* out, const uint8_t* in, uint32_t count, uint8_t stride,
+                            uint8_t bits_per_sample, bool samples_signed);
+// Packs count signed 16 bit samples in place into the given format. 8 bit samples are rounded.
+void audioio_pack_from_s16(uint8_t* buffer, uint32_t count, uint8_t bits_per_sample,
+                           bool samples_signed);
 
 #endif  // MICROPY_INCLUDED_SHARED_MODULE_AUDIOIO__INIT__H
@@ -44,6 +44,10 @@ void common_hal_displayio_bitmap_construct(displayio_bitmap_t *self, uint32_t wi
     self->height = height;
     self->data = m_malloc(self->stride * height * sizeof(size_t), false);
     self->read_only = false;
+    self->dirty_area.x1 = 0;
+    self->dirty_area.y1 = 0;
+    self->dirty_area.x2 = 0;
+    self->dirty_area.y2 = 0;
     self->bits_per_value = bits_per_value;
 
     if (bits_per_value > 8 && bits_per_value != 16 && bits_per_value != 32) {
@@ -100,18 +104,155 @@ uint32_t common_hal_displayio_bitmap_get_pixel(displayio_bitmap_t *self, int16_t
     return 0;
 }
 
-void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
+void displayio_bitmap_get_span(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t* values) {
+    if (y < 0 || y >= self->height) {
+        memset(values, 0, count * sizeof(uint32_t));
+        return;
+    }
+    // Zero anything left of the bitmap and then anything right of it so the loops below only
+    // deal with real values.
+    while (count > 0 && x < 0) {
+        *values++ = 0;
+        x++;
+        count--;
+    }
+    if (x >= self->width) {
+        memset(values, 0, count * sizeof(uint32_t));
+        return;
+    }
+    if (x + count > self->width) {
+        uint16_t in_bounds = self->width - x;
+        memset(values + in_bounds, 0, (count - in_bounds) * sizeof(uint32_t));
+        count = in_bounds;
+    }
+
+    size_t* row = self->data + y * self->stride;
+    switch (self->bits_per_value) {
+        case 8: {
+            uint8_t* source = ((uint8_t*) row) + x;
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = source[i];
+            }
+            break;
+        }
+        case 16: {
+            uint16_t* source = ((uint16_t*) row) + x;
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = source[i];
+            }
+            break;
+        }
+        case 32:
+            memcpy(values, ((uint32_t*) row) + x, count * sizeof(uint32_t));
+            break;
+        default: {
+            // Sub-byte values are packed most significant first. Load each word once and shift the
+            // values out of it.
+            uint8_t bits = self->bits_per_value;
+            size_t* word = row + (x >> self->x_shift);
+            uint8_t shift = sizeof(size_t) * 8 - ((x & self->x_mask) + 1) * bits;
+            size_t current = *word;
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = (current >> shift) & self->bitmask;
+                if (shift == 0) {
+                    // Don't read past the end of the data after the last value.
+                    if (i + 1 < count) {
+                        word++;
+                        current = *word;
+                    }
+                    shift = sizeof(size_t) * 8;
+                }
+                shift -= bits;
+            }
+            break;
+        }
+    }
+}
+
+static void check_writable(displayio_bitmap_t *self) {
     if (self->read_only) {
         mp_raise_RuntimeError(translate("Read-only object"));
     }
+}
+
+static void mark_dirty(displayio_bitmap_t *self, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    displayio_area_t area = {x1, y1, x2, y2};
+    displayio_area_expand(&self->dirty_area, &area);
+}
+
+// Writes count values to row y starting at x. The span must be within the bitmap. Values equal to
+// skip_value are left alone when skip is true.
+static void set_span(displayio_bitmap_t *self, uint16_t x, uint16_t y, uint16_t count,
+        const uint32_t* values, bool skip, uint32_t skip_value) {
+    if (count == 0) {
+        return;
+    }
+    size_t* row = self->data + y * self->stride;
+    switch (self->bits_per_value) {
+        case 8: {
+            uint8_t* dest = ((uint8_t*) row) + x;
+            for (uint16_t i = 0; i < count; i++) {
+                if (!skip || values[i] != skip_value) {
+                    dest[i] = values[i];
+                }
+            }
+            break;
+        }
+        case 16: {
+            uint16_t* dest = ((uint16_t*) row) + x;
+            for (uint16_t i = 0; i < count; i++) {
+                if (!skip || values[i] != skip_value) {
+                    dest[i] = values[i];
+                }
+            }
+            break;
+        }
+        case 32: {
+            uint32_t* dest = ((uint32_t*) row) + x;
+            for (uint16_t i = 0; i < count; i++) {
+                if (!skip || values[i] != skip_value) {
+                    dest[i] = values[i];
+                }
+            }
+            break;
+        }
+        default: {
+            // Update each packed word in a register and store it once all of its values are set.
+            uint8_t bits = self->bits_per_value;
+            size_t* word = row + (x >> self->x_shift);
+            uint8_t shift = sizeof(size_t) * 8 - ((x & self->x_mask) + 1) * bits;
+            size_t current = *word;
+            for (uint16_t i = 0; i < count; i++) {
+                if (!skip || values[i] != skip_value) {
+                    current &= ~(((size_t) self->bitmask) << shift);
+                    current |= ((size_t) (values[i] & self->bitmask)) << shift;
+                }
+                if (shift == 0) {
+                    *word = current;
+                    if (i + 1 < count) {
+                        word++;
+                        current = *word;
+                    }
+                    shift = sizeof(size_t) * 8;
+                }
+                shift -= bits;
+            }
+            *word = current;
+            break;
+        }
+    }
+}
+
+void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x, int16_t y, uint32_t value) {
+    check_writable(self);
     int32_t row_start = y * self->stride;
     uint32_t bytes_per_value = self->bits_per_value / 8;
     if (bytes_per_value < 1) {
         uint32_t bit_position = (sizeof(size_t) * 8 - ((x & self->x_mask) + 1) * self->bits_per_value);
         uint32_t index = row_start + (x >> self->x_shift);
-        uint32_t word = self->data[index];
-        word &= ~(self->bitmask << bit_position);
-        word |= (value & self->bitmask) << bit_position;
+        size_t word = self->data[index];
+        word &= ~(((size_t) self->bitmask) << bit_position);
+        word |= ((size_t) (value & self->bitmask)) << bit_position;
         self->data[index] = word;
     } else {
         size_t* row = self->data + row_start;
@@ -123,4 +264,126 @@ void common_hal_displayio_bitmap_set_pixel(displayio_bitmap_t *self, int16_t x,
             ((uint32_t*) row)[x] = value;
         }
     }
+    mark_dirty(self, x, y, x + 1, y + 1);
+}
+
+void common_hal_displayio_bitmap_fill(displayio_bitmap_t *self, uint32_t value) {
+    check_writable(self);
+    // Every value in a word is the same so build one word and copy it everywhere. The padding at
+    // the end of each row gets filled too but it is never read.
+    size_t pattern = 0;
+    uint8_t bits = self->bits_per_value;
+    if (bits < 32) {
+        value &= (1 << bits) - 1;
+    }
+    for (uint8_t i = 0; i < sizeof(size_t) * 8 / bits; i++) {
+        pattern |= ((size_t) value) << (i * bits);
+    }
+    uint32_t word_count = self->stride * self->height;
+    for (uint32_t i = 0; i < word_count; i++) {
+        self->data[i] = pattern;
+    }
+    mark_dirty(self, 0, 0, self->width, self->height);
+}
+
+// Number of values copied at once by blit.
+#define BLIT_SPAN_LENGTH (32)
+
+void common_hal_displayio_bitmap_blit(displayio_bitmap_t *self, int32_t x, int32_t y,
+        displayio_bitmap_t *source, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+        bool skip, uint32_t skip_value) {
+    check_writable(self);
+    // Clip the source rectangle to the source and then to where it lands in us. This is done in 32
+    // bits so that moving the rectangle by a far away corner doesn't wrap around.
+    if (x1 < 0) {
+        x -= x1;
+        x1 = 0;
+    }
+    if (y1 < 0) {
+        y -= y1;
+        y1 = 0;
+    }
+    if (x2 > source->width) {
+        x2 = source->width;
+    }
+    if (y2 > source->height) {
+        y2 = source->height;
+    }
+    if (x < 0) {
+        x1 -= x;
+        x = 0;
+    }
+    if (y < 0) {
+        y1 -= y;
+        y = 0;
+    }
+    if (x2 - x1 > self->width - x) {
+        x2 = x1 + self->width - x;
+    }
+    if (y2 - y1 > self->height - y) {
+        y2 = y1 + self->height - y;
+    }
+    if (x2 <= x1 || y2 <= y1) {
+        return;
+    }
+    uint16_t width = x2 - x1;
+    uint16_t height = y2 - y1;
+
+    // When copying within ourselves, copy away from the direction we're moving so that we never
+    // read values we've already overwritten.
+    bool reverse_rows = source == self && y > y1;
+    bool reverse_columns = source == self && x > x1;
+    uint32_t values[BLIT_SPAN_LENGTH];
+    for (uint16_t r = 0; r < height; r++) {
+        uint16_t row = reverse_rows ? height - 1 - r : r;
+        for (uint16_t c = 0; c < width; c += BLIT_SPAN_LENGTH) {
+            uint16_t count = width - c;
+            if (count > BLIT_SPAN_LENGTH) {
+                count = BLIT_SPAN_LENGTH;
+            }
+            uint16_t column = reverse_columns ? width - c - count : c;
+            displayio_bitmap_get_span(source, x1 + column, y1 + row, count, values);
+            set_span(self, x + column, y + row, count, values, skip, skip_value);
+        }
+    }
+    mark_dirty(self, x, y, x + width, y + height);
+}
+
+void common_hal_displayio_bitmap_load_row(displayio_bitmap_t *self, uint16_t y, uint8_t* data,
+                                          uint16_t len) {
+    check_writable(self);
+    size_t* row = self->data + y * self->stride;
+    if (self->bits_per_value >= 8) {
+        // Values are little endian just like us.
+        memcpy(row, data, len);
+    } else {
+        // Sub-byte values are packed most significant bit first so the bytes go into each word
+        // most significant first too.
+        for (uint16_t i = 0; i < self->stride; i++) {
+            size_t word = 0;
+            for (uint8_t b = 0; b < sizeof(size_t); b++) {
+                uint32_t index = i * sizeof(size_t) + b;
+                word = (word << 8) | (index < len ? data[index] : 0);
+            }
+            row[i] = word;
+        }
+    }
+    mark_dirty(self, 0, y, self->width, y + 1);
+}
+
+bool displayio_bitmap_get_dirty_area(displayio_bitmap_t *self, displayio_area_t* area) {
+    if (displayio_area_empty(&self->dirty_area)) {
+        return false;
+    }
+    displayio_area_copy(&self->dirty_area, area);
+    return true;
+}
+
+void displayio_bitmap_finish_refresh(displayio_bitmap_t *self) {
+    // Read-only bitmaps may live in flash so only write when something changed.
+    if (displayio_area_empty(&self->dirty_area)) {
+        return;
+    }
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
 }
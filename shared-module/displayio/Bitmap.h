@@ -31,6 +31,7 @@
 #include <stdint.h>
 
 #include "py/obj.h"
+#include "shared-module/displayio/area.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -42,7 +43,13 @@ typedef struct {
     uint8_t x_shift;
     size_t x_mask;
     uint16_t bitmask;
+    displayio_area_t dirty_area;
     bool read_only;
 } displayio_bitmap_t;
 
+// Reads count values from row y starting at x. Values outside of the bitmap are 0.
+void displayio_bitmap_get_span(displayio_bitmap_t *self, int16_t x, int16_t y, uint16_t count, uint32_t* values);
+bool displayio_bitmap_get_dirty_area(displayio_bitmap_t *self, displayio_area_t* area);
+void displayio_bitmap_finish_refresh(displayio_bitmap_t *self);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_BITMAP_H
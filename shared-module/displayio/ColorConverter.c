@@ -26,24 +26,159 @@
 
 #include "shared-bindings/displayio/ColorConverter.h"
 
-void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t* self) {
+// Each table maps an 8 bit channel value to its bits of a byte swapped RGB565 color so that a
+// color converts with three lookups ORed together.
+#define SWAP16(v) ((uint16_t) ((((v) & 0xff) << 8) | (((v) >> 8) & 0xff)))
+#define RED565(v) SWAP16(((v) >> 3) << 11)
+#define GREEN565(v) SWAP16(((v) >> 2) << 5)
+#define BLUE565(v) SWAP16((v) >> 3)
+#define GRAY565(v) (RED565(v) | GREEN565(v) | BLUE565(v))
+
+#define LUT4(f, n) f(n), f((n) + 1), f((n) + 2), f((n) + 3)
+#define LUT16(f, n) LUT4(f, n), LUT4(f, (n) + 4), LUT4(f, (n) + 8), LUT4(f, (n) + 12)
+#define LUT64(f, n) LUT16(f, n), LUT16(f, (n) + 16), LUT16(f, (n) + 32), LUT16(f, (n) + 48)
+#define LUT256(f) LUT64(f, 0), LUT64(f, 64), LUT64(f, 128), LUT64(f, 192)
+
+static const uint16_t red_lut[256] = { LUT256(RED565) };
+static const uint16_t green_lut[256] = { LUT256(GREEN565) };
+static const uint16_t blue_lut[256] = { LUT256(BLUE565) };
+static const uint16_t gray_lut[256] = { LUT256(GRAY565) };
+
+// 4x4 Bayer matrix scaled to 0-7 for the channels quantized to 5 bits. Six bit green uses half of
+// it.
+static const uint8_t dither_threshold[4][4] = {
+    { 0, 4, 1, 5 },
+    { 6, 2, 7, 3 },
+    { 1, 5, 0, 4 },
+    { 7, 3, 6, 2 },
+};
+
+void common_hal_displayio_colorconverter_construct(displayio_colorconverter_t* self,
+        displayio_colorspace_t input_colorspace, bool dither) {
+    self->input_colorspace = input_colorspace;
+    self->dither = dither;
+    self->needs_refresh = false;
+}
+
+static inline uint8_t add_saturated(uint8_t value, uint8_t offset) {
+    uint16_t sum = value + offset;
+    return sum > 0xff ? 0xff : sum;
+}
+
+static inline uint16_t rgb565_color(uint32_t input_color) {
+    return SWAP16(input_color);
+}
+
+static inline uint16_t rgb555_color(uint32_t input_color) {
+    uint16_t g5 = (input_color >> 5) & 0x1f;
+    uint16_t packed = (input_color & 0x7c00) << 1 | (g5 << 1 | g5 >> 4) << 5 | (input_color & 0x1f);
+    return SWAP16(packed);
+}
+
+static inline uint16_t l8_color(uint32_t input_color) {
+    return gray_lut[(uint8_t) input_color];
+}
+
+static inline uint16_t l8_dithered_color(uint32_t input_color, uint8_t threshold) {
+    uint8_t l = input_color;
+    return red_lut[add_saturated(l, threshold)] |
+           green_lut[add_saturated(l, threshold / 2)] |
+           blue_lut[add_saturated(l, threshold)];
+}
+
+static inline uint16_t rgb888_color(uint32_t input_color) {
+    return red_lut[(uint8_t) (input_color >> 16)] |
+           green_lut[(uint8_t) (input_color >> 8)] |
+           blue_lut[(uint8_t) input_color];
+}
+
+static inline uint16_t rgb888_dithered_color(uint32_t input_color, uint8_t threshold) {
+    return red_lut[add_saturated((uint8_t) (input_color >> 16), threshold)] |
+           green_lut[add_saturated((uint8_t) (input_color >> 8), threshold / 2)] |
+           blue_lut[add_saturated((uint8_t) input_color, threshold)];
 }
 
 bool common_hal_displayio_colorconverter_convert(displayio_colorconverter_t *self, uint32_t input_color, uint16_t* output_color) {
-    // TODO(tannewt): Validate the color input against the input format.
-    uint32_t r5 = (input_color >> 19);
-    uint32_t g6 = (input_color >> 10) & 0x3f;
-    uint32_t b5 = (input_color >> 3) & 0x1f;
-    uint32_t packed = r5 << 11 | g6 << 5 | b5;
-    // swap bytes
-    *output_color = __builtin_bswap16(packed);
+    switch (self->input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+            *output_color = rgb565_color(input_color);
+            break;
+        case DISPLAYIO_COLORSPACE_RGB555:
+            *output_color = rgb555_color(input_color);
+            break;
+        case DISPLAYIO_COLORSPACE_L8:
+            *output_color = l8_color(input_color);
+            break;
+        case DISPLAYIO_COLORSPACE_RGB888:
+        default:
+            *output_color = rgb888_color(input_color);
+            break;
+    }
     return true;
 }
 
-// Currently no refresh logic is needed for a ColorConverter.
+// The conversion is picked once per span so each loop below only does lookups. RGB565 and RGB555
+// have nothing to gain from dithering because they don't lose any bits.
+void displayio_colorconverter_convert_span(displayio_colorconverter_t *self, uint32_t* values,
+        uint16_t count, int16_t x, int16_t y) {
+    const uint8_t* thresholds = dither_threshold[y & 0x3];
+    switch (self->input_colorspace) {
+        case DISPLAYIO_COLORSPACE_RGB565:
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = rgb565_color(values[i]);
+            }
+            break;
+        case DISPLAYIO_COLORSPACE_RGB555:
+            for (uint16_t i = 0; i < count; i++) {
+                values[i] = rgb555_color(values[i]);
+            }
+            break;
+        case DISPLAYIO_COLORSPACE_L8:
+            if (self->dither) {
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] = l8_dithered_color(values[i], thresholds[(x + i) & 0x3]);
+                }
+            } else {
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] = l8_color(values[i]);
+                }
+            }
+            break;
+        case DISPLAYIO_COLORSPACE_RGB888:
+        default:
+            if (self->dither) {
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] = rgb888_dithered_color(values[i], thresholds[(x + i) & 0x3]);
+                }
+            } else {
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] = rgb888_color(values[i]);
+                }
+            }
+            break;
+    }
+}
+
+displayio_colorspace_t common_hal_displayio_colorconverter_get_input_colorspace(displayio_colorconverter_t* self) {
+    return self->input_colorspace;
+}
+
+bool common_hal_displayio_colorconverter_get_dither(displayio_colorconverter_t* self) {
+    return self->dither;
+}
+
+void common_hal_displayio_colorconverter_set_dither(displayio_colorconverter_t* self, bool dither) {
+    if (self->dither == dither) {
+        return;
+    }
+    self->dither = dither;
+    self->needs_refresh = true;
+}
+
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self) {
-    return false;
+    return self->needs_refresh;
 }
 
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self) {
+    self->needs_refresh = false;
 }
@@ -31,11 +31,19 @@
 #include <stdint.h>
 
 #include "py/obj.h"
+#include "shared-bindings/displayio/Colorspace.h"
 
 typedef struct {
     mp_obj_base_t base;
+    displayio_colorspace_t input_colorspace;
+    bool dither;
+    bool needs_refresh;
 } displayio_colorconverter_t;
 
+// Converts count colors in place to byte swapped RGB565. x and y place the first color in the
+// dither pattern.
+void displayio_colorconverter_convert_span(displayio_colorconverter_t *self, uint32_t* values,
+    uint16_t count, int16_t x, int16_t y);
 bool displayio_colorconverter_needs_refresh(displayio_colorconverter_t *self);
 void displayio_colorconverter_finish_refresh(displayio_colorconverter_t *self);
 
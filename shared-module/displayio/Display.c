@@ -27,11 +27,10 @@
 #include "shared-bindings/displayio/Display.h"
 
 #include "py/runtime.h"
-#include "shared-bindings/displayio/FourWire.h"
-#include "shared-bindings/displayio/ParallelBus.h"
 #include "shared-bindings/microcontroller/Pin.h"
 #include "shared-bindings/time/__init__.h"
 #include "shared-module/displayio/__init__.h"
+#include "shared-module/displayio/mipi_constants.h"
 #include "supervisor/shared/display.h"
 
 #include <stdint.h>
@@ -43,13 +42,19 @@
 void common_hal_displayio_display_construct(displayio_display_obj_t* self,
         mp_obj_t bus, uint16_t width, uint16_t height, int16_t colstart, int16_t rowstart, uint16_t rotation,
         uint16_t color_depth, uint8_t set_column_command, uint8_t set_row_command,
-        uint8_t write_ram_command, uint8_t set_vertical_scroll, uint8_t* init_sequence, uint16_t init_sequence_len,
+        uint8_t write_ram_command, uint8_t set_vertical_scroll, uint16_t memory_height,
+        uint8_t* init_sequence, uint16_t init_sequence_len,
         const mcu_pin_obj_t* backlight_pin, mp_float_t brightness, bool auto_brightness,
         bool single_byte_bounds, bool data_as_commands) {
     self->color_depth = color_depth;
     self->set_column_command = set_column_command;
     self->set_row_command = set_row_command;
     self->write_ram_command = write_ram_command;
+    self->set_vertical_scroll = set_vertical_scroll;
+    self->memory_height = memory_height;
+    self->scroll_top = 0;
+    self->scroll_height = 0;
+    self->scroll_offset = 0;
     self->refresh = false;
     self->current_group = NULL;
     self->colstart = colstart;
@@ -57,16 +62,45 @@ void common_hal_displayio_display_construct(displayio_display_obj_t* self,
     self->auto_brightness = auto_brightness;
     self->data_as_commands = data_as_commands;
     self->single_byte_bounds = single_byte_bounds;
-
+    self->auto_refresh = true;
+    self->target_frames_per_second = 30;
+    self->max_refresh_time_us = 0;
+    self->pending_areas.count = 0;
+    self->last_render_time_us = 0;
+    self->last_send_time_us = 0;
+    self->frame_render_time_us = 0;
+    self->frame_send_time_us = 0;
+    self->pixels_sent = 0;
+    self->frames_skipped = 0;
+
+    #if CIRCUITPY_DIGITALIO
     if (MP_OBJ_IS_TYPE(bus, &displayio_parallelbus_type)) {
         self->begin_transaction = common_hal_displayio_parallelbus_begin_transaction;
         self->send = common_hal_displayio_parallelbus_send;
         self->end_transaction = common_hal_displayio_parallelbus_end_transaction;
-    } else if (MP_OBJ_IS_TYPE(bus, &displayio_fourwire_type)) {
+        self->begin_send = NULL;
+        self->send_in_progress = NULL;
+    } else
+    #endif
+    #if CIRCUITPY_BUSIO
+    if (MP_OBJ_IS_TYPE(bus, &displayio_fourwire_type)) {
         self->begin_transaction = common_hal_displayio_fourwire_begin_transaction;
         self->send = common_hal_displayio_fourwire_send;
         self->end_transaction = common_hal_displayio_fourwire_end_transaction;
-    } else {
+        self->begin_send = common_hal_displayio_fourwire_begin_send;
+        self->send_in_progress = common_hal_displayio_fourwire_send_in_progress;
+    } else
+    #endif
+    #if CIRCUITPY_DISPLAYIO_MEMORYBUS
+    if (MP_OBJ_IS_TYPE(bus, &displayio_memorybus_type)) {
+        self->begin_transaction = common_hal_displayio_memorybus_begin_transaction;
+        self->send = common_hal_displayio_memorybus_send;
+        self->end_transaction = common_hal_displayio_memorybus_end_transaction;
+        self->begin_send = NULL;
+        self->send_in_progress = NULL;
+    } else
+    #endif
+    {
         mp_raise_ValueError(translate("Unsupported display bus type"));
     }
     self->bus = bus;
@@ -131,7 +165,14 @@ void common_hal_displayio_display_construct(displayio_display_obj_t* self,
             self->mirror_x = true;
         }
     }
+    // The panel scrolls its own rows so only scroll when they are display rows. The scroll area
+    // has to add up to every memory row so we also need to know how many there are.
+    if (self->transpose_xy || self->mirror_y || rowstart != 0 || single_byte_bounds ||
+        memory_height < height) {
+        self->set_vertical_scroll = 0;
+    }
 
+    #if CIRCUITPY_PULSEIO
     // Always set the backlight type in case we're reusing memory.
     self->backlight_inout.base.type = &mp_type_NoneType;
     if (backlight_pin != NULL && common_hal_mcu_pin_is_free(backlight_pin)) {
@@ -148,6 +189,7 @@ void common_hal_displayio_display_construct(displayio_display_obj_t* self,
             }
         }
     }
+    #endif
 }
 
 void common_hal_displayio_display_show(displayio_display_obj_t* self, displayio_group_t* root_group) {
@@ -162,7 +204,16 @@ void common_hal_displayio_display_refresh_soon(displayio_display_obj_t* self) {
     self->refresh = true;
 }
 
+void common_hal_displayio_display_refresh(displayio_display_obj_t* self) {
+    displayio_refresh_display(self);
+}
+
 int32_t common_hal_displayio_display_wait_for_frame(displayio_display_obj_t* self) {
+    // No frame would ever come in the background so draw it now instead of waiting forever.
+    if (!self->auto_refresh) {
+        common_hal_displayio_display_refresh(self);
+        return 0;
+    }
     uint64_t last_refresh = self->last_refresh;
     // Don't try to refresh if we got an exception.
     while (last_refresh == self->last_refresh && MP_STATE_VM(mp_pending_exception) == NULL) {
@@ -188,6 +239,7 @@ void common_hal_displayio_display_set_auto_brightness(displayio_display_obj_t* s
 }
 
 mp_float_t common_hal_displayio_display_get_brightness(displayio_display_obj_t* self) {
+    #if CIRCUITPY_PULSEIO
     if (self->backlight_pwm.base.type == &pulseio_pwmout_type) {
         uint16_t duty_cycle = common_hal_pulseio_pwmout_get_duty_cycle(&self->backlight_pwm);
         return duty_cycle / ((mp_float_t) 0xffff);
@@ -198,12 +250,14 @@ mp_float_t common_hal_displayio_display_get_brightness(displayio_display_obj_t*
             return 0.0;
         }
     }
+    #endif
     return -1.0;
 }
 
 bool common_hal_displayio_display_set_brightness(displayio_display_obj_t* self, mp_float_t brightness) {
     self->updating_backlight = true;
     bool ok = false;
+    #if CIRCUITPY_PULSEIO
     if (self->backlight_pwm.base.type == &pulseio_pwmout_type) {
         common_hal_pulseio_pwmout_set_duty_cycle(&self->backlight_pwm, (uint16_t) (0xffff * brightness));
         ok = true;
@@ -211,6 +265,7 @@ bool common_hal_displayio_display_set_brightness(displayio_display_obj_t* self,
         common_hal_digitalio_digitalinout_set_value(&self->backlight_inout, brightness > 0.99);
         ok = true;
     }
+    #endif
     self->updating_backlight = false;
     return ok;
 }
@@ -223,7 +278,34 @@ void displayio_display_end_transaction(displayio_display_obj_t* self) {
     self->end_transaction(self->bus);
 }
 
+// Returns the panel memory row shown on the given panel row.
+static uint16_t scrolled_row(displayio_display_obj_t* self, uint16_t y) {
+    if (y < self->scroll_top || y >= self->scroll_top + self->scroll_height) {
+        return y;
+    }
+    return self->scroll_top + (y - self->scroll_top + self->scroll_offset) % self->scroll_height;
+}
+
+uint16_t displayio_display_get_scroll_break(displayio_display_obj_t* self, uint16_t y1, uint16_t y2) {
+    uint16_t scroll_bottom = self->scroll_top + self->scroll_height;
+    uint16_t row_break = y2;
+    if (self->scroll_offset == 0) {
+        return row_break;
+    } else if (y1 < self->scroll_top) {
+        row_break = self->scroll_top;
+    } else if (y1 < scroll_bottom - self->scroll_offset) {
+        row_break = scroll_bottom - self->scroll_offset;
+    } else if (y1 < scroll_bottom) {
+        row_break = scroll_bottom;
+    }
+    return row_break < y2 ? row_break : y2;
+}
+
 void displayio_display_set_region_to_update(displayio_display_obj_t* self, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    // Write rows where the panel shows them when it is scrolled.
+    uint16_t scrolled_y0 = scrolled_row(self, y0);
+    y1 = scrolled_y0 + (y1 - y0);
+    y0 = scrolled_y0;
 
     self->send(self->bus, true, &self->set_column_command, 1);
     bool isCommand = self->data_as_commands;
@@ -255,13 +337,177 @@ void displayio_display_set_region_to_update(displayio_display_obj_t* self, uint1
     }
 }
 
+bool common_hal_displayio_display_get_auto_refresh(displayio_display_obj_t* self) {
+    return self->auto_refresh;
+}
+
+void common_hal_displayio_display_set_auto_refresh(displayio_display_obj_t* self, bool auto_refresh) {
+    self->auto_refresh = auto_refresh;
+}
+
+uint16_t common_hal_displayio_display_get_target_frames_per_second(displayio_display_obj_t* self) {
+    return self->target_frames_per_second;
+}
+
+void common_hal_displayio_display_set_target_frames_per_second(displayio_display_obj_t* self,
+        uint16_t target_frames_per_second) {
+    self->target_frames_per_second = target_frames_per_second;
+}
+
+uint32_t common_hal_displayio_display_get_max_refresh_time(displayio_display_obj_t* self) {
+    return self->max_refresh_time_us;
+}
+
+void common_hal_displayio_display_set_max_refresh_time(displayio_display_obj_t* self, uint32_t max_refresh_time_us) {
+    self->max_refresh_time_us = max_refresh_time_us;
+}
+
+uint32_t common_hal_displayio_display_get_last_render_time(displayio_display_obj_t* self) {
+    return self->last_render_time_us;
+}
+
+uint32_t common_hal_displayio_display_get_last_send_time(displayio_display_obj_t* self) {
+    return self->last_send_time_us;
+}
+
+uint32_t common_hal_displayio_display_get_pixels_sent(displayio_display_obj_t* self) {
+    return self->pixels_sent;
+}
+
+uint32_t common_hal_displayio_display_get_frames_skipped(displayio_display_obj_t* self) {
+    return self->frames_skipped;
+}
+
+uint32_t displayio_display_frame_interval_ms(displayio_display_obj_t* self) {
+    if (self->target_frames_per_second == 0) {
+        return 0;
+    }
+    return 1000 / self->target_frames_per_second;
+}
+
 bool displayio_display_frame_queued(displayio_display_obj_t* self) {
-    // Refresh at ~30 fps.
-    return (ticks_ms - self->last_refresh) > 32;
+    // Finish a frame that ran out of time before starting on the next one.
+    if (self->pending_areas.count > 0) {
+        return true;
+    }
+    if (!self->auto_refresh) {
+        return false;
+    }
+    return (ticks_ms - self->last_refresh) >= displayio_display_frame_interval_ms(self);
 }
 
-bool displayio_display_refresh_queued(displayio_display_obj_t* self) {
-    return self->refresh || (self->current_group != NULL && displayio_group_needs_refresh(self->current_group));
+static void send_words(displayio_display_obj_t* self, uint8_t command, uint16_t* words, uint8_t count) {
+    self->send(self->bus, true, &command, 1);
+    uint16_t data[count];
+    for (uint8_t i = 0; i < count; i++) {
+        data[i] = __builtin_bswap16(words[i]);
+    }
+    self->send(self->bus, self->data_as_commands, (uint8_t*) data, count * sizeof(uint16_t));
+}
+
+// Scrolls the panel to match a TileGrid in the root group whose content only moved up so the rows
+// already on the panel aren't sent again. Everything else in the scrolled rows is added to areas.
+// Returns false when the TileGrid has to be redrawn instead.
+static bool scroll_tilegrid(displayio_display_obj_t* self, displayio_tilegrid_t* grid, displayio_area_list_t* areas) {
+    uint16_t rows = displayio_tilegrid_get_scrolled_rows(grid);
+    if (rows == 0) {
+        return false;
+    }
+    displayio_group_t* root = self->current_group;
+    // Anything else drawn over the TileGrid would move with it.
+    if (!displayio_area_empty(&root->dirty_area)) {
+        return false;
+    }
+    for (uint16_t i = 0; i < root->size; i++) {
+        mp_obj_t layer = root->children[i].native;
+        displayio_area_t* drawn = NULL;
+        if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
+            drawn = &((displayio_tilegrid_t*) layer)->previous_area;
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
+            drawn = &((displayio_group_t*) layer)->previous_area;
+        }
+        displayio_area_t overlap;
+        if (layer != grid && drawn != NULL &&
+            displayio_area_compute_overlap(drawn, &grid->area, &overlap) &&
+            !displayio_area_empty(&overlap)) {
+            return false;
+        }
+    }
+
+    displayio_area_t scrolled;
+    displayio_area_copy(&grid->area, &scrolled);
+    displayio_area_scale(&scrolled, root->scale);
+    displayio_area_shift(&scrolled, root->x, root->y);
+    uint16_t top = scrolled.y1;
+    uint16_t height = scrolled.y2 - scrolled.y1;
+    if (scrolled.y1 < 0 || scrolled.y2 > self->height) {
+        return false;
+    }
+    // The scroll area can only move while nothing is scrolled.
+    bool new_area = top != self->scroll_top || height != self->scroll_height;
+    if (new_area && self->scroll_offset != 0) {
+        return false;
+    }
+    if (!displayio_display_begin_transaction(self)) {
+        return false;
+    }
+    if (new_area) {
+        // Rows the panel has but doesn't show are fixed below the scroll area with the rest.
+        uint16_t scroll_area[3] = {top, height, self->memory_height - top - height};
+        send_words(self, MIPI_COMMAND_SET_SCROLL_AREA, scroll_area, 3);
+        self->scroll_top = top;
+        self->scroll_height = height;
+    }
+    self->scroll_offset = (self->scroll_offset + rows * grid->tile_height * root->scale) % height;
+    uint16_t scroll_start = top + self->scroll_offset;
+    send_words(self, self->set_vertical_scroll, &scroll_start, 1);
+    displayio_display_end_transaction(self);
+    displayio_tilegrid_finish_scroll(grid);
+
+    // The panel scrolls whole rows so redraw what is beside the TileGrid.
+    displayio_area_t beside = {
+        .x1 = 0,
+        .y1 = scrolled.y1,
+        .x2 = scrolled.x1,
+        .y2 = scrolled.y2
+    };
+    displayio_area_list_add(areas, &beside, 0, 0, 1);
+    beside.x1 = scrolled.x2;
+    beside.x2 = self->width;
+    displayio_area_list_add(areas, &beside, 0, 0, 1);
+    return true;
+}
+
+bool displayio_display_get_refresh_areas(displayio_display_obj_t* self, displayio_area_list_t* areas) {
+    areas->count = 0;
+    if (self->refresh) {
+        displayio_area_t whole_screen = {
+            .x1 = 0,
+            .y1 = 0,
+            .x2 = self->width,
+            .y2 = self->height
+        };
+        displayio_area_list_add(areas, &whole_screen, 0, 0, 1);
+        if (self->current_group != NULL) {
+            displayio_group_update_bounds(self->current_group);
+        }
+    } else if (self->current_group != NULL) {
+        displayio_group_t* root = self->current_group;
+        // Scroll the panel instead of redrawing a scrolled TileGrid when everything else on the
+        // panel is up to date.
+        if (self->set_vertical_scroll != 0 && self->pending_areas.count == 0 &&
+            !root->needs_refresh && !displayio_area_empty(&root->previous_area)) {
+            for (uint16_t i = 0; i < root->size; i++) {
+                mp_obj_t layer = root->children[i].native;
+                if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type) &&
+                    scroll_tilegrid(self, layer, areas)) {
+                    break;
+                }
+            }
+        }
+        displayio_group_get_refresh_areas(root, areas, 0, 0, 1);
+    }
+    return areas->count > 0;
 }
 
 void displayio_display_finish_refresh(displayio_display_obj_t* self) {
@@ -269,11 +515,57 @@ void displayio_display_finish_refresh(displayio_display_obj_t* self) {
         displayio_group_finish_refresh(self->current_group);
     }
     self->refresh = false;
+    // The frame is only done once everything left over from running out of time is drawn.
+    if (self->pending_areas.count > 0) {
+        return;
+    }
     self->last_refresh = ticks_ms;
+    uint32_t frame_time_us = self->frame_render_time_us + self->frame_send_time_us;
+    if (frame_time_us == 0) {
+        // Nothing was drawn so keep the statistics of the last real frame.
+        return;
+    }
+    self->last_render_time_us = self->frame_render_time_us;
+    self->last_send_time_us = self->frame_send_time_us;
+    uint32_t frame_interval_us = displayio_display_frame_interval_ms(self) * 1000;
+    if (frame_interval_us > 0) {
+        // Count every frame interval we spent drawing beyond the first as a skipped frame.
+        if (frame_time_us > frame_interval_us) {
+            self->frames_skipped += (frame_time_us - 1) / frame_interval_us;
+        }
+    }
+    self->frame_render_time_us = 0;
+    self->frame_send_time_us = 0;
 }
 
-void displayio_display_send_pixels(displayio_display_obj_t* self, uint32_t* pixels, uint32_t length) {
-    self->send(self->bus, false, (uint8_t*) pixels, length * 4);
+void displayio_display_send_pixels(displayio_display_obj_t* self, uint8_t* pixels, uint32_t length) {
+    self->send(self->bus, false, pixels, length);
+}
+
+void displayio_display_begin_send_pixels(displayio_display_obj_t* self, uint8_t* pixels, uint32_t length,
+        display_bus_send_done done, void* context) {
+    if (self->begin_send == NULL) {
+        self->send(self->bus, false, pixels, length);
+        done(context);
+        return;
+    }
+    self->begin_send(self->bus, pixels, length, done, context);
+}
+
+bool displayio_display_send_in_progress(displayio_display_obj_t* self) {
+    return self->send_in_progress != NULL && self->send_in_progress(self->bus);
+}
+
+bool displayio_display_bus_shared(displayio_display_obj_t* self) {
+    #if CIRCUITPY_BUSIO
+    // Only the SPI bus of a built-in display lives inside its FourWire. Any other SPI object, such as
+    // board.SPI(), may also have an SD card or sensor on it.
+    if (MP_OBJ_IS_TYPE(self->bus, &displayio_fourwire_type)) {
+        displayio_fourwire_obj_t* fourwire = MP_OBJ_TO_PTR(self->bus);
+        return fourwire->bus != &fourwire->inline_bus;
+    }
+    #endif
+    return true;
 }
 
 void displayio_display_update_backlight(displayio_display_obj_t* self) {
@@ -291,10 +583,12 @@ void displayio_display_update_backlight(displayio_display_obj_t* self) {
 }
 
 void release_display(displayio_display_obj_t* self) {
+    #if CIRCUITPY_PULSEIO
     if (self->backlight_pwm.base.type == &pulseio_pwmout_type) {
         common_hal_pulseio_pwmout_reset_ok(&self->backlight_pwm);
         common_hal_pulseio_pwmout_deinit(&self->backlight_pwm);
     } else if (self->backlight_inout.base.type == &digitalio_digitalinout_type) {
         common_hal_digitalio_digitalinout_deinit(&self->backlight_inout);
     }
+    #endif
 }
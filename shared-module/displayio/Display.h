@@ -27,13 +27,23 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DISPLAY_H
 #define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_DISPLAY_H
 
-#include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/displayio/Group.h"
+#if CIRCUITPY_PULSEIO
+#include "shared-bindings/digitalio/DigitalInOut.h"
 #include "shared-bindings/pulseio/PWMOut.h"
+#endif
 
 typedef bool (*display_bus_begin_transaction)(mp_obj_t bus);
 typedef void (*display_bus_send)(mp_obj_t bus, bool command, uint8_t *data, uint32_t data_length);
 typedef void (*display_bus_end_transaction)(mp_obj_t bus);
+typedef void (*display_bus_send_done)(void* context);
+// Starts sending pixel data without waiting for it to go out. done is called with context once
+// data can be reused.
+typedef void (*display_bus_begin_send)(mp_obj_t bus, uint8_t *data, uint32_t data_length,
+                                       display_bus_send_done done, void* context);
+// Returns true while a send started by begin_send is still going. Calls its done callback once it
+// has finished.
+typedef bool (*display_bus_send_in_progress)(mp_obj_t bus);
 
 typedef struct {
     mp_obj_base_t base;
@@ -44,6 +54,13 @@ typedef struct {
     uint8_t set_column_command;
     uint8_t set_row_command;
     uint8_t write_ram_command;
+    uint8_t set_vertical_scroll; // 0 when the panel can't scroll.
+    uint16_t memory_height; // Rows in the panel's memory. At least height when it can scroll.
+    // Panel rows scrolled by the panel itself and how far. Row scroll_top + scroll_offset is shown at
+    // the top of the scroll area. scroll_height is 0 until the scroll area is set.
+    uint16_t scroll_top;
+    uint16_t scroll_height;
+    uint16_t scroll_offset;
     displayio_group_t *current_group;
     bool refresh;
     uint64_t last_refresh;
@@ -54,16 +71,34 @@ typedef struct {
     display_bus_begin_transaction begin_transaction;
     display_bus_send send;
     display_bus_end_transaction end_transaction;
+    // NULL when the bus can only send synchronously.
+    display_bus_begin_send begin_send;
+    display_bus_send_in_progress send_in_progress;
+    #if CIRCUITPY_PULSEIO
     union {
         digitalio_digitalinout_obj_t backlight_inout;
         pulseio_pwmout_obj_t backlight_pwm;
     };
+    #endif
     uint64_t last_backlight_refresh;
     bool auto_brightness:1;
     bool updating_backlight:1;
     bool mirror_x;
     bool mirror_y;
     bool transpose_xy;
+    bool auto_refresh;
+    uint16_t target_frames_per_second;
+    uint32_t max_refresh_time_us; // 0 when a refresh may take as long as it needs.
+    // Parts of the current frame that didn't fit into max_refresh_time_us. They are drawn before
+    // anything else.
+    displayio_area_list_t pending_areas;
+    // Frame statistics. Times are for the last complete frame.
+    uint32_t last_render_time_us;
+    uint32_t last_send_time_us;
+    uint32_t frame_render_time_us;
+    uint32_t frame_send_time_us;
+    uint32_t pixels_sent;
+    uint32_t frames_skipped;
 } displayio_display_obj_t;
 
 void displayio_display_update_backlight(displayio_display_obj_t* self);
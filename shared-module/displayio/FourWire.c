@@ -48,6 +48,7 @@ void common_hal_displayio_fourwire_construct(displayio_fourwire_obj_t* self,
     self->frequency = common_hal_busio_spi_get_frequency(spi);
     self->polarity = common_hal_busio_spi_get_polarity(spi);
     self->phase = common_hal_busio_spi_get_phase(spi);
+    self->send_done = NULL;
 
     common_hal_digitalio_digitalinout_construct(&self->command, command);
     common_hal_digitalio_digitalinout_switch_to_output(&self->command, true, DRIVE_MODE_PUSH_PULL);
@@ -87,6 +88,8 @@ bool common_hal_displayio_fourwire_begin_transaction(mp_obj_t obj) {
 
 void common_hal_displayio_fourwire_send(mp_obj_t obj, bool command, uint8_t *data, uint32_t data_length) {
     displayio_fourwire_obj_t* self = MP_OBJ_TO_PTR(obj);
+    // Let any pixels we're still sending go out first.
+    while (common_hal_displayio_fourwire_send_in_progress(obj)) {}
     if (command) {
         common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
         common_hal_time_delay_ms(1);
@@ -96,8 +99,37 @@ void common_hal_displayio_fourwire_send(mp_obj_t obj, bool command, uint8_t *dat
     common_hal_busio_spi_write(self->bus, data, data_length);
 }
 
+void common_hal_displayio_fourwire_begin_send(mp_obj_t obj, uint8_t *data, uint32_t data_length,
+        display_bus_send_done done, void* context) {
+    displayio_fourwire_obj_t* self = MP_OBJ_TO_PTR(obj);
+    while (common_hal_displayio_fourwire_send_in_progress(obj)) {}
+    common_hal_digitalio_digitalinout_set_value(&self->command, true);
+    self->send_done = done;
+    self->send_done_context = context;
+    if (!common_hal_busio_spi_start_write(self->bus, data, data_length)) {
+        // The write failed so the buffer is free again.
+        self->send_done = NULL;
+        done(context);
+    }
+}
+
+bool common_hal_displayio_fourwire_send_in_progress(mp_obj_t obj) {
+    displayio_fourwire_obj_t* self = MP_OBJ_TO_PTR(obj);
+    if (self->send_done == NULL) {
+        return false;
+    }
+    if (!common_hal_busio_spi_write_done(self->bus)) {
+        return true;
+    }
+    display_bus_send_done done = self->send_done;
+    self->send_done = NULL;
+    done(self->send_done_context);
+    return false;
+}
+
 void common_hal_displayio_fourwire_end_transaction(mp_obj_t obj) {
     displayio_fourwire_obj_t* self = MP_OBJ_TO_PTR(obj);
+    while (common_hal_displayio_fourwire_send_in_progress(obj)) {}
     common_hal_digitalio_digitalinout_set_value(&self->chip_select, true);
     common_hal_busio_spi_unlock(self->bus);
 }
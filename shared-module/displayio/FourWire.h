@@ -29,6 +29,7 @@
 
 #include "common-hal/busio/SPI.h"
 #include "common-hal/digitalio/DigitalInOut.h"
+#include "shared-module/displayio/Display.h"
 #include "shared-module/displayio/Group.h"
 
 typedef struct {
@@ -41,6 +42,8 @@ typedef struct {
     uint32_t frequency;
     uint8_t polarity;
     uint8_t phase;
+    display_bus_send_done send_done;
+    void* send_done_context;
 } displayio_fourwire_obj_t;
 
 #endif // MICROPY_INCLUDED_ATMEL_SAMD_COMMON_HAL_DISPLAYIO_FOURWIRE_H
@@ -39,7 +39,10 @@ uint32_t common_hal_displayio_group_get_scale(displayio_group_t* self) {
 }
 
 void common_hal_displayio_group_set_scale(displayio_group_t* self, uint32_t scale) {
-    self->needs_refresh = self->scale != scale;
+    if (self->scale == scale) {
+        return;
+    }
+    self->needs_refresh = true;
     self->scale = scale;
 }
 
@@ -48,7 +51,10 @@ mp_int_t common_hal_displayio_group_get_x(displayio_group_t* self) {
 }
 
 void common_hal_displayio_group_set_x(displayio_group_t* self, mp_int_t x) {
-    self->needs_refresh = self->x != x;
+    if (self->x == x) {
+        return;
+    }
+    self->needs_refresh = true;
     self->x = x;
 }
 
@@ -57,10 +63,34 @@ mp_int_t common_hal_displayio_group_get_y(displayio_group_t* self) {
 }
 
 void common_hal_displayio_group_set_y(displayio_group_t* self, mp_int_t y) {
-    self->needs_refresh = self->y != y;
+    if (self->y == y) {
+        return;
+    }
+    self->needs_refresh = true;
     self->y = y;
 }
 
+// Remembers where a layer was drawn so that the next refresh clears it.
+static void release_layer(displayio_group_t* self, mp_obj_t layer) {
+    displayio_area_t previous_area;
+    if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
+        if (!displayio_tilegrid_release_previous_area(layer, &previous_area)) {
+            return;
+        }
+    } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
+        displayio_group_t* group = layer;
+        if (displayio_area_empty(&group->previous_area)) {
+            return;
+        }
+        displayio_area_copy(&group->previous_area, &previous_area);
+        group->previous_area.x1 = 0;
+        group->previous_area.x2 = 0;
+    } else {
+        return;
+    }
+    displayio_area_expand(&self->dirty_area, &previous_area);
+}
+
 void common_hal_displayio_group_insert(displayio_group_t* self, size_t index, mp_obj_t layer) {
     if (self->size == self->max_size) {
         mp_raise_RuntimeError(translate("Group full"));
@@ -79,19 +109,18 @@ void common_hal_displayio_group_insert(displayio_group_t* self, size_t index, mp
     self->children[index].native = native_layer;
     self->children[index].original = layer;
     self->size++;
-    self->needs_refresh = true;
 }
 
 mp_obj_t common_hal_displayio_group_pop(displayio_group_t* self, size_t index) {
     self->size--;
     mp_obj_t item = self->children[index].original;
+    release_layer(self, self->children[index].native);
     // Shift everything left.
     for (size_t i = index; i < self->size; i++) {
         self->children[i] = self->children[i + 1];
     }
     self->children[self->size].native = NULL;
     self->children[self->size].original = NULL;
-    self->needs_refresh = true;
     return item;
 }
 
@@ -120,9 +149,9 @@ void common_hal_displayio_group_set(displayio_group_t* self, size_t index, mp_ob
     if (native_layer == MP_OBJ_NULL) {
         mp_raise_ValueError(translate("Layer must be a Group or TileGrid subclass."));
     }
+    release_layer(self, self->children[index].native);
     self->children[index].native = native_layer;
     self->children[index].original = layer;
-    self->needs_refresh = true;
 }
 
 void displayio_group_construct(displayio_group_t* self, displayio_group_child_t* child_array, uint32_t max_size, uint32_t scale, mp_int_t x, mp_int_t y) {
@@ -130,11 +159,59 @@ void displayio_group_construct(displayio_group_t* self, displayio_group_child_t*
     self->y = y;
     self->children = child_array;
     self->max_size = max_size;
+    self->previous_area.x1 = 0;
+    self->previous_area.x2 = 0;
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
+    self->bounds.x1 = 0;
+    self->bounds.x2 = 0;
     self->needs_refresh = false;
     self->scale = scale;
 }
 
+// Converts our bounds into our parent's coordinates.
+static void get_parent_bounds(displayio_group_t *self, displayio_area_t* bounds) {
+    displayio_area_copy(&self->bounds, bounds);
+    if (displayio_area_empty(bounds)) {
+        return;
+    }
+    displayio_area_scale(bounds, self->scale);
+    displayio_area_shift(bounds, self->x, self->y);
+}
+
+void displayio_group_update_bounds(displayio_group_t *self) {
+    self->bounds.x1 = 0;
+    self->bounds.x2 = 0;
+    for (int32_t i = self->size - 1; i >= 0 ; i--) {
+        mp_obj_t layer = self->children[i].native;
+        if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
+            displayio_tilegrid_t* tilegrid = layer;
+            displayio_area_expand(&self->bounds, &tilegrid->area);
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
+            displayio_group_t* group = layer;
+            displayio_group_update_bounds(group);
+            displayio_area_t group_bounds;
+            get_parent_bounds(group, &group_bounds);
+            displayio_area_expand(&self->bounds, &group_bounds);
+        }
+    }
+}
+
 bool displayio_group_get_area(displayio_group_t *self, displayio_buffer_transform_t* transform, displayio_area_t* area, uint32_t* mask, uint32_t* buffer) {
+    // Skip everything in the group when none of it is in the area.
+    displayio_area_t bounds;
+    get_parent_bounds(self, &bounds);
+    displayio_area_t scaled_bounds = {
+        .x1 = bounds.x1 * transform->scale,
+        .y1 = bounds.y1 * transform->scale,
+        .x2 = bounds.x2 * transform->scale,
+        .y2 = bounds.y2 * transform->scale
+    };
+    displayio_area_t overlap;
+    if (!displayio_area_compute_overlap(area, &scaled_bounds, &overlap)) {
+        return false;
+    }
+
     displayio_area_shift(area, -self->x * transform->scale, -self->y * transform->scale);
     transform->scale *= self->scale;
 
@@ -160,27 +237,65 @@ bool displayio_group_get_area(displayio_group_t *self, displayio_buffer_transfor
     return full_coverage;
 }
 
-bool displayio_group_needs_refresh(displayio_group_t *self) {
-    if (self->needs_refresh) {
-        return true;
+// Computes the area our layers were drawn in during the last refresh in our parent's coordinates.
+static void get_previous_bounds(displayio_group_t *self, displayio_area_t* bounds) {
+    bounds->x1 = 0;
+    bounds->x2 = 0;
+    for (int32_t i = self->size - 1; i >= 0 ; i--) {
+        mp_obj_t layer = self->children[i].native;
+        if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
+            displayio_tilegrid_t* tilegrid = layer;
+            displayio_area_expand(bounds, &tilegrid->previous_area);
+        } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
+            displayio_group_t* group = layer;
+            displayio_area_expand(bounds, &group->previous_area);
+        }
+    }
+    if (displayio_area_empty(bounds)) {
+        return;
     }
+    displayio_area_scale(bounds, self->scale);
+    displayio_area_shift(bounds, self->x, self->y);
+}
+
+void displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_list_t* areas, int16_t x, int16_t y, uint16_t scale) {
+    if (self->needs_refresh || displayio_area_empty(&self->previous_area)) {
+        // Everything in the group moved so redraw where it was and where it is now.
+        displayio_group_update_bounds(self);
+        displayio_area_t bounds;
+        get_parent_bounds(self, &bounds);
+        displayio_area_list_add(areas, &self->previous_area, x, y, scale);
+        displayio_area_list_add(areas, &bounds, x, y, scale);
+        return;
+    }
+
+    x += self->x * scale;
+    y += self->y * scale;
+    scale *= self->scale;
+    displayio_area_list_add(areas, &self->dirty_area, x, y, scale);
+    // Every layer is visited here anyway so update our bounds along the way.
+    self->bounds.x1 = 0;
+    self->bounds.x2 = 0;
     for (int32_t i = self->size - 1; i >= 0 ; i--) {
         mp_obj_t layer = self->children[i].native;
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
-            if (displayio_tilegrid_needs_refresh(layer)) {
-                return true;
-            }
+            displayio_tilegrid_t* tilegrid = layer;
+            displayio_tilegrid_get_refresh_areas(tilegrid, areas, x, y, scale);
+            displayio_area_expand(&self->bounds, &tilegrid->area);
         } else if (MP_OBJ_IS_TYPE(layer, &displayio_group_type)) {
-            if (displayio_group_needs_refresh(layer)) {
-                return true;
-            }
+            displayio_group_t* group = layer;
+            displayio_group_get_refresh_areas(group, areas, x, y, scale);
+            displayio_area_t group_bounds;
+            get_parent_bounds(group, &group_bounds);
+            displayio_area_expand(&self->bounds, &group_bounds);
         }
     }
-    return false;
 }
 
 void displayio_group_finish_refresh(displayio_group_t *self) {
     self->needs_refresh = false;
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
     for (int32_t i = self->size - 1; i >= 0 ; i--) {
         mp_obj_t layer = self->children[i].native;
         if (MP_OBJ_IS_TYPE(layer, &displayio_tilegrid_type)) {
@@ -189,4 +304,5 @@ void displayio_group_finish_refresh(displayio_group_t *self) {
             displayio_group_finish_refresh(layer);
         }
     }
+    get_previous_bounds(self, &self->previous_area);
 }
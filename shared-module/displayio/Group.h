@@ -46,12 +46,22 @@ typedef struct {
     uint16_t size;
     uint16_t max_size;
     displayio_group_child_t* children;
+    displayio_area_t previous_area; // In our parent's coordinates. Empty until drawn.
+    displayio_area_t dirty_area; // In our coordinates. Covers layers removed since the last refresh.
+    // Area covered by our layers in our coordinates. Layers don't know which group they are in so
+    // this is brought up to date at the start of every refresh rather than when they change.
+    displayio_area_t bounds;
     bool needs_refresh;
 } displayio_group_t;
 
 void displayio_group_construct(displayio_group_t* self, displayio_group_child_t* child_array, uint32_t max_size, uint32_t scale, mp_int_t x, mp_int_t y);
+// Recomputes the bounds of this group and every group in it. displayio_group_get_refresh_areas
+// does this too so only call it when the refresh areas aren't needed.
+void displayio_group_update_bounds(displayio_group_t *self);
 bool displayio_group_get_area(displayio_group_t *group, displayio_buffer_transform_t* transform, displayio_area_t* area, uint32_t* mask, uint32_t *buffer);
-bool displayio_group_needs_refresh(displayio_group_t *self);
+// Adds the areas that need to be redrawn to the list. x, y and scale convert the coordinates of our
+// parent into display coordinates.
+void displayio_group_get_refresh_areas(displayio_group_t *self, displayio_area_list_t* areas, int16_t x, int16_t y, uint16_t scale);
 void displayio_group_finish_refresh(displayio_group_t *self);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_GROUP_H
@@ -0,0 +1,202 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include "shared-bindings/displayio/MemoryBus.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "py/runtime.h"
+#include "py/stream.h"
+#include "shared-module/displayio/mipi_constants.h"
+
+void common_hal_displayio_memorybus_construct(displayio_memorybus_obj_t* self,
+        uint16_t width, uint16_t height) {
+    self->width = width;
+    self->height = height;
+    self->framebuffer = m_new0_ll(uint16_t, width * height);
+    self->command = 0;
+    self->x1 = 0;
+    self->x2 = width - 1;
+    self->y1 = 0;
+    self->y2 = height - 1;
+    self->x = 0;
+    self->y = 0;
+    self->scroll_top = 0;
+    self->scroll_height = height;
+    self->scroll_start = 0;
+    self->have_high_byte = false;
+    self->in_transaction = false;
+    self->bytes_sent = 0;
+}
+
+void common_hal_displayio_memorybus_deinit(displayio_memorybus_obj_t* self) {
+    m_del(uint16_t, self->framebuffer, self->width * self->height);
+    self->framebuffer = NULL;
+}
+
+bool common_hal_displayio_memorybus_begin_transaction(mp_obj_t obj) {
+    displayio_memorybus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    if (self->in_transaction) {
+        return false;
+    }
+    self->in_transaction = true;
+    return true;
+}
+
+// Reads an inclusive start and end pair sent as either two bytes or two big endian words.
+static void read_bounds(uint8_t *data, uint32_t data_length, uint16_t* start, uint16_t* end) {
+    if (data_length == 2) {
+        *start = data[0];
+        *end = data[1];
+    } else if (data_length >= 4) {
+        *start = data[0] << 8 | data[1];
+        *end = data[2] << 8 | data[3];
+    }
+}
+
+// Returns the memory row shown on the given row of the screen.
+static uint16_t memory_row(displayio_memorybus_obj_t* self, uint16_t y) {
+    if (y < self->scroll_top || y >= self->scroll_top + self->scroll_height) {
+        return y;
+    }
+    uint16_t start = self->scroll_start - self->scroll_top;
+    return self->scroll_top + (y - self->scroll_top + start) % self->scroll_height;
+}
+
+static inline void write_pixel(displayio_memorybus_obj_t* self, uint16_t color) {
+    if (self->x < self->width && self->y < self->height) {
+        self->framebuffer[self->y * self->width + self->x] = color;
+    }
+    // Like a real controller, wrap within the window once it is full.
+    if (self->x >= self->x2) {
+        self->x = self->x1;
+        if (self->y >= self->y2) {
+            self->y = self->y1;
+        } else {
+            self->y++;
+        }
+    } else {
+        self->x++;
+    }
+}
+
+void common_hal_displayio_memorybus_send(mp_obj_t obj, bool command, uint8_t *data, uint32_t data_length) {
+    displayio_memorybus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    self->bytes_sent += data_length;
+    if (command) {
+        if (data_length == 0) {
+            return;
+        }
+        self->command = data[data_length - 1];
+        if (self->command == MIPI_COMMAND_WRITE_MEMORY_START) {
+            self->x = self->x1;
+            self->y = self->y1;
+            self->have_high_byte = false;
+        }
+        return;
+    }
+    if (self->command == MIPI_COMMAND_SET_COLUMN_ADDRESS) {
+        read_bounds(data, data_length, &self->x1, &self->x2);
+    } else if (self->command == MIPI_COMMAND_SET_PAGE_ADDRESS) {
+        read_bounds(data, data_length, &self->y1, &self->y2);
+    } else if (self->command == MIPI_COMMAND_SET_SCROLL_AREA && data_length >= 6) {
+        uint16_t top = data[0] << 8 | data[1];
+        uint16_t height = data[2] << 8 | data[3];
+        uint16_t bottom = data[4] << 8 | data[5];
+        // Like a real controller, ignore areas that don't add up to the whole memory.
+        if (top + height + bottom == self->height && height > 0) {
+            self->scroll_top = top;
+            self->scroll_height = height;
+            self->scroll_start = top;
+        }
+    } else if (self->command == MIPI_COMMAND_SET_SCROLL_START && data_length >= 2) {
+        uint16_t start = data[0] << 8 | data[1];
+        if (start >= self->scroll_top && start < self->scroll_top + self->scroll_height) {
+            self->scroll_start = start;
+        }
+    } else if (self->command == MIPI_COMMAND_WRITE_MEMORY_START) {
+        uint32_t i = 0;
+        if (self->have_high_byte && data_length > 0) {
+            write_pixel(self, self->high_byte << 8 | data[0]);
+            self->have_high_byte = false;
+            i = 1;
+        }
+        // Pixels go out big endian.
+        for (; i + 1 < data_length; i += 2) {
+            write_pixel(self, data[i] << 8 | data[i + 1]);
+        }
+        if (i < data_length) {
+            self->high_byte = data[i];
+            self->have_high_byte = true;
+        }
+    }
+}
+
+void common_hal_displayio_memorybus_end_transaction(mp_obj_t obj) {
+    displayio_memorybus_obj_t* self = MP_OBJ_TO_PTR(obj);
+    self->in_transaction = false;
+}
+
+uint64_t common_hal_displayio_memorybus_get_bytes_sent(displayio_memorybus_obj_t* self) {
+    return self->bytes_sent;
+}
+
+uint16_t common_hal_displayio_memorybus_get_pixel(displayio_memorybus_obj_t* self, uint16_t x, uint16_t y) {
+    return self->framebuffer[memory_row(self, y) * self->width + x];
+}
+
+static void write_all(mp_obj_t stream, const void* data, size_t len) {
+    int errcode;
+    mp_stream_write_exactly(stream, data, len, &errcode);
+    if (errcode != 0) {
+        mp_raise_OSError(errcode);
+    }
+}
+
+void common_hal_displayio_memorybus_dump_ppm(displayio_memorybus_obj_t* self, mp_obj_t stream) {
+    char header[24];
+    int header_len = snprintf(header, sizeof(header), "P6\n%d %d\n255\n", self->width, self->height);
+    write_all(stream, header, header_len);
+
+    uint8_t* row = m_malloc(self->width * 3, false);
+    for (uint16_t y = 0; y < self->height; y++) {
+        const uint16_t* pixels = self->framebuffer + memory_row(self, y) * self->width;
+        for (uint16_t x = 0; x < self->width; x++) {
+            uint16_t color = pixels[x];
+            uint8_t r5 = color >> 11;
+            uint8_t g6 = (color >> 5) & 0x3f;
+            uint8_t b5 = color & 0x1f;
+            // Replicate the top bits so that full scale maps to 255.
+            row[x * 3] = r5 << 3 | r5 >> 2;
+            row[x * 3 + 1] = g6 << 2 | g6 >> 4;
+            row[x * 3 + 2] = b5 << 3 | b5 >> 2;
+        }
+        write_all(stream, row, self->width * 3);
+    }
+    m_del(uint8_t, row, self->width * 3);
+}
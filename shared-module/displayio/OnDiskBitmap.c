@@ -115,65 +115,146 @@ void common_hal_displayio_ondiskbitmap_construct(displayio_ondiskbitmap_t *self,
         self->stride = (bit_stride / 8);
     }
 
+    // Decoding whole rows at once is much faster than seeking to every pixel but isn't worth
+    // running out of memory over.
+    self->row_cache = m_new_maybe(uint32_t, self->width * CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS);
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS; i++) {
+        self->cached_rows[i] = -1;
+    }
+    self->next_cache_slot = 0;
 }
 
 
-uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
-        int16_t x, int16_t y) {
-    if (x < 0 || x >= self->width || y < 0 || y >= self->height) {
-        return 0;
+static uint8_t bytes_per_pixel(displayio_ondiskbitmap_t *self) {
+    return (self->bits_per_pixel / 8) ? (self->bits_per_pixel / 8) : 1;
+}
+
+// Converts the raw data of the pixel at x into a color.
+static uint32_t decode_pixel(displayio_ondiskbitmap_t *self, uint32_t pixel_data, int16_t x) {
+    uint32_t tmp = 0;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+    if (self->bits_per_pixel == 1) {
+        uint8_t bit_offset = x%8;
+        tmp = ( pixel_data & (0x80 >> (bit_offset))) >> (7 - bit_offset);
+        if (tmp == 1) {
+            return 0x00FFFFFF;
+        } else {
+            return 0x00000000;
+        }
+    } else if (self->bits_per_pixel == 8) {
+        blue = ((self->palette_data[pixel_data] & 0xFF) >> 0);
+        red = ((self->palette_data[pixel_data] & 0xFF0000) >> 16);
+        green = ((self->palette_data[pixel_data] & 0xFF00) >> 8);
+        tmp = (red << 16 | green << 8 | blue );
+        return tmp;
+    } else if (self->bits_per_pixel == 16) {
+        if (self->g_bitmask == 0x07e0) { // 565
+            red =((pixel_data & self->r_bitmask) >>11);
+            green = ((pixel_data & self->g_bitmask) >>5);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        } else { // 555
+            red =((pixel_data & self->r_bitmask) >>10);
+            green = ((pixel_data & self->g_bitmask) >>4);
+            blue = ((pixel_data & self->b_bitmask) >> 0);
+        }
+        tmp = (red << 19 | green << 10 | blue << 3);
+        return tmp;
+    } else if ((self->bits_per_pixel == 32) && (self->bitfield_compressed)) {
+        return pixel_data & 0x00FFFFFF;
+    } else {
+        return pixel_data;
+    }
+}
+
+// Returns the decoded pixels of row y, reading it from the file when it isn't cached. Returns NULL
+// if the row couldn't be read.
+static uint32_t* load_row(displayio_ondiskbitmap_t *self, int16_t y) {
+    for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS; i++) {
+        if (self->cached_rows[i] == y) {
+            return self->row_cache + i * self->width;
+        }
     }
+    uint8_t slot = self->next_cache_slot;
+    self->next_cache_slot = (slot + 1) % CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS;
+    uint32_t* row = self->row_cache + slot * self->width;
 
+    uint8_t bpp = bytes_per_pixel(self);
+    uint32_t row_bytes;
+    if (self->bits_per_pixel >= 8) {
+        row_bytes = self->width * bpp;
+    } else {
+        row_bytes = (self->width + 7) / 8;
+    }
+    // Decoded pixels are never smaller than raw ones so read the raw row into the end of the slot
+    // and decode it forward. Each decoded pixel only overwrites raw data we've already used.
+    uint8_t* raw = ((uint8_t*) row) + self->width * sizeof(uint32_t) - row_bytes;
+    self->cached_rows[slot] = -1;
+    f_lseek(&self->file->fp, self->data_offset + (self->height - y - 1) * self->stride);
+    UINT bytes_read;
+    if (f_read(&self->file->fp, raw, row_bytes, &bytes_read) != FR_OK || bytes_read != row_bytes) {
+        return NULL;
+    }
+    for (uint16_t x = 0; x < self->width; x++) {
+        uint32_t pixel_data = 0;
+        if (self->bits_per_pixel >= 8) {
+            const uint8_t* p = raw + x * bpp;
+            for (uint8_t b = 0; b < bpp; b++) {
+                pixel_data |= ((uint32_t) p[b]) << (8 * b);
+            }
+        } else {
+            pixel_data = raw[x / 8];
+        }
+        row[x] = decode_pixel(self, pixel_data, x);
+    }
+    self->cached_rows[slot] = y;
+    return row;
+}
+
+// Reads a single pixel straight from the file. Used when there isn't memory for the row cache.
+static uint32_t read_pixel(displayio_ondiskbitmap_t *self, int16_t x, int16_t y) {
     uint32_t location;
-    uint8_t bytes_per_pixel = (self->bits_per_pixel / 8)  ? (self->bits_per_pixel /8) : 1;
+    uint8_t bpp = bytes_per_pixel(self);
     if (self->bits_per_pixel >= 8){
-        location = self->data_offset + (self->height - y - 1) * self->stride + x * bytes_per_pixel;
+        location = self->data_offset + (self->height - y - 1) * self->stride + x * bpp;
     } else {
         location = self->data_offset + (self->height - y - 1) * self->stride + x / 8;
     }
-    // We don't cache here because the underlying FS caches sectors.
     f_lseek(&self->file->fp, location);
     UINT bytes_read;
     uint32_t pixel_data = 0;
-    uint32_t result = f_read(&self->file->fp, &pixel_data, bytes_per_pixel, &bytes_read);
-    if (result == FR_OK) {
-        uint32_t tmp = 0;
-        uint8_t red;
-        uint8_t green;
-        uint8_t blue;
-        if (self->bits_per_pixel == 1) {
-            uint8_t bit_offset = x%8;
-            tmp = ( pixel_data & (0x80 >> (bit_offset))) >> (7 - bit_offset);
-            if (tmp == 1) {
-                return 0x00FFFFFF;
-            } else {
-                return 0x00000000;
-            }
-        } else if (bytes_per_pixel == 1) {
-            blue = ((self->palette_data[pixel_data] & 0xFF) >> 0);
-            red = ((self->palette_data[pixel_data] & 0xFF0000) >> 16);
-            green = ((self->palette_data[pixel_data] & 0xFF00) >> 8);
-            tmp = (red << 16 | green << 8 | blue );
-            return tmp;
-        } else if (bytes_per_pixel == 2) {
-            if (self->g_bitmask == 0x07e0) { // 565
-                red =((pixel_data & self->r_bitmask) >>11);
-                green = ((pixel_data & self->g_bitmask) >>5);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            } else { // 555
-                red =((pixel_data & self->r_bitmask) >>10);
-                green = ((pixel_data & self->g_bitmask) >>4);
-                blue = ((pixel_data & self->b_bitmask) >> 0);
-            }
-            tmp = (red << 19 | green << 10 | blue << 3);
-            return tmp;
-        } else if ((bytes_per_pixel == 4) && (self->bitfield_compressed)) {
-            return pixel_data & 0x00FFFFFF;
+    if (f_read(&self->file->fp, &pixel_data, bpp, &bytes_read) != FR_OK) {
+        return 0;
+    }
+    return decode_pixel(self, pixel_data, x);
+}
+
+void displayio_ondiskbitmap_get_span(displayio_ondiskbitmap_t *self, int16_t x, int16_t y,
+        uint16_t count, uint32_t* values) {
+    uint32_t* row = NULL;
+    if (y >= 0 && y < self->height && self->row_cache != NULL) {
+        row = load_row(self, y);
+    }
+    for (uint16_t i = 0; i < count; i++, x++) {
+        if (x < 0 || x >= self->width || y < 0 || y >= self->height) {
+            values[i] = 0;
+        } else if (row != NULL) {
+            values[i] = row[x];
+        } else if (self->row_cache == NULL) {
+            values[i] = read_pixel(self, x, y);
         } else {
-            return pixel_data;
+            // The row failed to load.
+            values[i] = 0;
         }
     }
-    return 0;
+}
+
+uint32_t common_hal_displayio_ondiskbitmap_get_pixel(displayio_ondiskbitmap_t *self,
+        int16_t x, int16_t y) {
+    uint32_t value;
+    displayio_ondiskbitmap_get_span(self, x, y, 1, &value);
+    return value;
 }
 
 uint16_t common_hal_displayio_ondiskbitmap_get_height(displayio_ondiskbitmap_t *self) {
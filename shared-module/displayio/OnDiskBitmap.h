@@ -47,6 +47,14 @@ typedef struct {
     pyb_file_obj_t* file;
     uint8_t bits_per_pixel;
     uint32_t* palette_data;
+    // Decoded rows, width pixels each. NULL when there wasn't enough memory for them.
+    uint32_t* row_cache;
+    int16_t cached_rows[CIRCUITPY_DISPLAY_ONDISKBITMAP_CACHE_ROWS];
+    uint8_t next_cache_slot;
 } displayio_ondiskbitmap_t;
 
+// Fills values with count decoded pixels starting at x, y. Pixels outside the bitmap are 0.
+void displayio_ondiskbitmap_get_span(displayio_ondiskbitmap_t *self, int16_t x, int16_t y,
+    uint16_t count, uint32_t* values);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_ONDISKBITMAP_H
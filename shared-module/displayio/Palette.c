@@ -34,14 +34,25 @@ void common_hal_displayio_palette_construct(displayio_palette_t* self, uint16_t
         opaque_byte_count += 1;
     }
     self->opaque = (uint32_t *) m_malloc(opaque_byte_count, false);
+    self->transparent_count = 0;
 }
 
 void common_hal_displayio_palette_make_opaque(displayio_palette_t* self, uint32_t palette_index) {
+    if ((self->opaque[palette_index / 32] & (0x1 << (palette_index % 32))) == 0) {
+        return;
+    }
+    self->transparent_count--;
     self->opaque[palette_index / 32] &= ~(0x1 << (palette_index % 32));
+    self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_make_transparent(displayio_palette_t* self, uint32_t palette_index) {
+    if ((self->opaque[palette_index / 32] & (0x1 << (palette_index % 32))) != 0) {
+        return;
+    }
+    self->transparent_count++;
     self->opaque[palette_index / 32] |= (0x1 << (palette_index % 32));
+    self->needs_refresh = true;
 }
 
 void common_hal_displayio_palette_set_color(displayio_palette_t* self, uint32_t palette_index, uint32_t color) {
@@ -58,7 +69,7 @@ void common_hal_displayio_palette_set_color(displayio_palette_t* self, uint32_t
 }
 
 bool displayio_palette_get_color(displayio_palette_t *self, uint32_t palette_index, uint16_t* color) {
-    if (palette_index > self->color_count) {
+    if (palette_index >= self->color_count) {
         return false;
     }
     if ((self->opaque[palette_index / 32] & (0x1 << (palette_index % 32))) != 0) {
@@ -69,6 +80,33 @@ bool displayio_palette_get_color(displayio_palette_t *self, uint32_t palette_ind
     return true;
 }
 
+bool displayio_palette_get_colors(displayio_palette_t *self, uint32_t* values, uint16_t count, uint32_t transparent_value) {
+    bool opaque = true;
+    if (self->transparent_count == 0) {
+        // Only out of range values can be transparent so skip the per value transparency check.
+        for (uint16_t i = 0; i < count; i++) {
+            uint32_t palette_index = values[i];
+            if (palette_index >= self->color_count) {
+                values[i] = transparent_value;
+                opaque = false;
+                continue;
+            }
+            values[i] = (self->colors[palette_index / 2] >> (16 * (palette_index % 2))) & 0xffff;
+        }
+        return opaque;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        uint16_t color;
+        if (displayio_palette_get_color(self, values[i], &color)) {
+            values[i] = color;
+        } else {
+            values[i] = transparent_value;
+            opaque = false;
+        }
+    }
+    return opaque;
+}
+
 bool displayio_palette_needs_refresh(displayio_palette_t *self) {
     return self->needs_refresh;
 }
@@ -37,10 +37,14 @@ typedef struct {
     uint32_t* opaque;
     uint32_t* colors;
     uint32_t color_count;
+    uint32_t transparent_count;
     bool needs_refresh;
 } displayio_palette_t;
 
 bool displayio_palette_get_color(displayio_palette_t *palette, uint32_t palette_index, uint16_t* color);
+// Converts count palette indices into colors in place. Transparent and out of range values are
+// replaced by transparent_value. Returns true when all of the values are opaque.
+bool displayio_palette_get_colors(displayio_palette_t *self, uint32_t* values, uint16_t count, uint32_t transparent_value);
 bool displayio_palette_needs_refresh(displayio_palette_t *self);
 void displayio_palette_finish_refresh(displayio_palette_t *self);
 
@@ -0,0 +1,183 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/displayio/RLEBitmap.h"
+
+#include <string.h>
+
+#include "py/runtime.h"
+#include "supervisor/shared/translate.h"
+
+static uint16_t read_uint16(const uint8_t* data) {
+    return data[0] | data[1] << 8;
+}
+
+static uint32_t read_uint32(const uint8_t* data) {
+    return data[0] | data[1] << 8 | data[2] << 16 | (uint32_t) data[3] << 24;
+}
+
+static uint32_t row_offset(displayio_rlebitmap_t *self, int16_t y) {
+    return read_uint32(self->data + DISPLAYIO_RLEBITMAP_HEADER_SIZE + y * 4);
+}
+
+static uint32_t read_value(displayio_rlebitmap_t *self, const uint8_t* data) {
+    if (self->bytes_per_value == 1) {
+        return data[0];
+    }
+    return read_uint16(data);
+}
+
+void common_hal_displayio_rlebitmap_construct(displayio_rlebitmap_t *self, mp_obj_t buffer,
+        const uint8_t* data, uint32_t len) {
+    if (len < DISPLAYIO_RLEBITMAP_HEADER_SIZE || memcmp(data, "RLEB", 4) != 0) {
+        mp_raise_ValueError(translate("Invalid RLE bitmap"));
+    }
+    // bytes can't change so they are used in place. Anything else is copied so that changing it
+    // later can't make the rows we check below invalid.
+    if (!MP_OBJ_IS_TYPE(buffer, &mp_type_bytes)) {
+        uint8_t* copy = m_new(uint8_t, len);
+        memcpy(copy, data, len);
+        data = copy;
+        buffer = mp_const_none;
+    }
+    self->buffer = buffer;
+    self->data = data;
+    self->width = read_uint16(data + 4);
+    self->height = read_uint16(data + 6);
+    self->bytes_per_value = data[8];
+    self->cursor_y = -1;
+    if ((self->bytes_per_value != 1 && self->bytes_per_value != 2) ||
+        len < DISPLAYIO_RLEBITMAP_HEADER_SIZE + self->height * 4) {
+        mp_raise_ValueError(translate("Invalid RLE bitmap"));
+    }
+
+    // Check every row once now so that decoding spans never has to.
+    for (uint16_t y = 0; y < self->height; y++) {
+        uint32_t offset = row_offset(self, y);
+        uint32_t decoded = 0;
+        while (decoded < self->width) {
+            if (offset >= len) {
+                mp_raise_ValueError(translate("Invalid RLE bitmap"));
+            }
+            uint8_t control = data[offset];
+            uint16_t length = (control & 0x7f) + 1;
+            uint16_t value_count = (control & 0x80) ? 1 : length;
+            offset += 1 + value_count * self->bytes_per_value;
+            decoded += length;
+        }
+        if (offset > len || decoded != self->width) {
+            mp_raise_ValueError(translate("Invalid RLE bitmap"));
+        }
+    }
+}
+
+uint16_t common_hal_displayio_rlebitmap_get_height(displayio_rlebitmap_t *self) {
+    return self->height;
+}
+
+uint16_t common_hal_displayio_rlebitmap_get_width(displayio_rlebitmap_t *self) {
+    return self->width;
+}
+
+uint32_t common_hal_displayio_rlebitmap_get_pixel(displayio_rlebitmap_t *self, int16_t x, int16_t y) {
+    uint32_t value;
+    displayio_rlebitmap_get_span(self, x, y, 1, &value);
+    return value;
+}
+
+void displayio_rlebitmap_get_span(displayio_rlebitmap_t *self, int16_t x, int16_t y,
+        uint16_t count, uint32_t* values) {
+    if (y < 0 || y >= self->height) {
+        memset(values, 0, count * sizeof(uint32_t));
+        return;
+    }
+    while (count > 0 && x < 0) {
+        *values++ = 0;
+        x++;
+        count--;
+    }
+    if (x >= self->width) {
+        memset(values, 0, count * sizeof(uint32_t));
+        return;
+    }
+    if (x + count > self->width) {
+        uint16_t in_bounds = self->width - x;
+        memset(values + in_bounds, 0, (count - in_bounds) * sizeof(uint32_t));
+        count = in_bounds;
+    }
+
+    // Spans usually continue where the last one stopped so only go back to the start of the row
+    // when we have to.
+    if (y != self->cursor_y || x < self->cursor_x) {
+        self->cursor_y = y;
+        self->cursor_x = 0;
+        self->cursor_offset = row_offset(self, y);
+    }
+    const uint8_t* packet = self->data + self->cursor_offset;
+    uint16_t packet_x = self->cursor_x;
+    uint8_t bytes_per_value = self->bytes_per_value;
+    while (count > 0) {
+        uint8_t control = *packet;
+        uint16_t length = (control & 0x7f) + 1;
+        bool run = (control & 0x80) != 0;
+        uint16_t packet_size = 1 + (run ? 1 : length) * bytes_per_value;
+        if (packet_x + length <= x) {
+            packet += packet_size;
+            packet_x += length;
+            continue;
+        }
+        uint16_t skip = x - packet_x;
+        uint16_t n = length - skip;
+        if (n > count) {
+            n = count;
+        }
+        if (run) {
+            uint32_t value = read_value(self, packet + 1);
+            for (uint16_t i = 0; i < n; i++) {
+                values[i] = value;
+            }
+        } else if (bytes_per_value == 1) {
+            const uint8_t* literal = packet + 1 + skip;
+            for (uint16_t i = 0; i < n; i++) {
+                values[i] = literal[i];
+            }
+        } else {
+            const uint8_t* literal = packet + 1 + skip * 2;
+            for (uint16_t i = 0; i < n; i++) {
+                values[i] = read_uint16(literal + i * 2);
+            }
+        }
+        values += n;
+        x += n;
+        count -= n;
+        if (skip + n == length) {
+            packet += packet_size;
+            packet_x += length;
+        }
+    }
+    self->cursor_offset = packet - self->data;
+    self->cursor_x = packet_x;
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_RLEBITMAP_H
+#define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_RLEBITMAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/obj.h"
+
+// Encoded data starts with a 12 byte header followed by a table of little endian uint32 offsets
+// from the start of the data to each row:
+//
+//   0  "RLEB"
+//   4  uint16 width
+//   6  uint16 height
+//   8  uint8 bytes per value, 1 or 2
+//   9  3 reserved bytes
+//
+// Each row is a series of packets that together hold exactly width values. A packet starts with a
+// control byte. When its top bit is set, the single value that follows is repeated
+// (control & 0x7f) + 1 times. Otherwise control + 1 literal values follow. Two byte values are
+// little endian.
+#define DISPLAYIO_RLEBITMAP_HEADER_SIZE (12)
+
+typedef struct {
+    mp_obj_base_t base;
+    mp_obj_t buffer; // Keeps the bytes object that owns data alive. None when data is a copy.
+    const uint8_t* data;
+    uint16_t width;
+    uint16_t height;
+    uint8_t bytes_per_value;
+    // Where the last span stopped so the next span on the same row continues from there instead
+    // of decoding the row from the start.
+    int16_t cursor_y;
+    uint16_t cursor_x;
+    uint32_t cursor_offset;
+} displayio_rlebitmap_t;
+
+// Fills values with count decoded values starting at x, y. Values outside the bitmap are 0.
+void displayio_rlebitmap_get_span(displayio_rlebitmap_t *self, int16_t x, int16_t y,
+    uint16_t count, uint32_t* values);
+
+#endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_RLEBITMAP_H
@@ -48,11 +48,45 @@ void common_hal_displayio_shape_construct(displayio_shape_t *self, uint32_t widt
     }
     self->half_height = height;
 
-    self->data = m_malloc(height * sizeof(uint32_t), false);
+    // Mirrored shapes store rows up to and including half_height.
+    self->data = m_malloc((height + 1) * 2 * sizeof(uint16_t), false);
     for (uint16_t i = 0; i <= height; i++) {
         self->data[2 * i] = 0;
         self->data[2 * i + 1] = width;
     }
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
+}
+
+// Marks the pixels covered by a stored row, including where they are mirrored to, as changed.
+static void mark_dirty(displayio_shape_t *self, uint16_t y, uint16_t start_x, uint16_t end_x) {
+    if (start_x > end_x) {
+        return;
+    }
+    displayio_area_t area = {start_x, y, end_x + 1, y + 1};
+    if (self->mirror_x) {
+        area.x2 = self->width - start_x;
+    }
+    if (area.x2 > self->width) {
+        area.x2 = self->width;
+    }
+    displayio_area_expand(&self->dirty_area, &area);
+    if (self->mirror_y) {
+        area.y1 = self->height - 1 - y;
+        area.y2 = area.y1 + 1;
+        displayio_area_expand(&self->dirty_area, &area);
+    }
+}
+
+static void set_row(displayio_shape_t *self, uint16_t y, uint16_t start_x, uint16_t end_x) {
+    uint16_t* row = self->data + 2 * y;
+    if (row[0] == start_x && row[1] == end_x) {
+        return;
+    }
+    mark_dirty(self, y, row[0], row[1]);
+    mark_dirty(self, y, start_x, end_x);
+    row[0] = start_x;
+    row[1] = end_x;
 }
 
 void common_hal_displayio_shape_set_boundary(displayio_shape_t *self, uint16_t y, uint16_t start_x, uint16_t end_x) {
@@ -66,8 +100,147 @@ void common_hal_displayio_shape_set_boundary(displayio_shape_t *self, uint16_t y
     if (self->mirror_x && (start_x > half_width || end_x > half_width)) {
         mp_raise_ValueError_varg(translate("Maximum x value when mirrored is %d"), half_width);
     }
-    self->data[2 * y] = start_x;
-    self->data[2 * y + 1] = end_x;
+    set_row(self, y, start_x, end_x);
+}
+
+// Number of rows that are stored rather than mirrored.
+static uint16_t stored_rows(displayio_shape_t *self) {
+    if (self->mirror_y) {
+        return self->half_height + 1;
+    }
+    return self->height;
+}
+
+// Sets row y to cover start_x through end_x inclusive after clipping them to the stored part of
+// the shape. Rows are left empty when nothing is left.
+static void set_clipped_row(displayio_shape_t *self, uint16_t y, int32_t start_x, int32_t end_x) {
+    int32_t max_x = self->mirror_x ? self->half_width : self->width - 1;
+    if (start_x < 0) {
+        start_x = 0;
+    }
+    if (end_x > max_x) {
+        end_x = max_x;
+    }
+    if (start_x > end_x) {
+        start_x = 1;
+        end_x = 0;
+    }
+    set_row(self, y, start_x, end_x);
+}
+
+static uint32_t isqrt(uint32_t n) {
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > n) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+void common_hal_displayio_shape_set_circle(displayio_shape_t *self, int16_t x, int16_t y, uint16_t radius) {
+    uint32_t radius_squared = (uint32_t) radius * radius;
+    for (uint16_t row = 0; row < stored_rows(self); row++) {
+        int32_t dy = row - y;
+        if (dy < -radius || dy > radius) {
+            set_clipped_row(self, row, 1, 0);
+            continue;
+        }
+        // Square the distance unsigned; dy * dy overflows int32_t once the radius passes 46340.
+        uint32_t distance = dy < 0 ? -dy : dy;
+        int32_t dx = isqrt(radius_squared - distance * distance);
+        set_clipped_row(self, row, x - dx, x + dx);
+    }
+}
+
+void common_hal_displayio_shape_set_rounded_rectangle(displayio_shape_t *self, int16_t x, int16_t y,
+        uint16_t width, uint16_t height, uint16_t radius) {
+    if (radius > width / 2) {
+        radius = width / 2;
+    }
+    if (radius > height / 2) {
+        radius = height / 2;
+    }
+    uint32_t radius_squared = (uint32_t) radius * radius;
+    for (uint16_t row = 0; row < stored_rows(self); row++) {
+        int32_t i = row - y;
+        if (i < 0 || i >= height) {
+            set_clipped_row(self, row, 1, 0);
+            continue;
+        }
+        // Distance into the rounded corners, counting the outermost row as radius.
+        int32_t d = 0;
+        if (i < radius) {
+            d = radius - i;
+        } else if (i >= height - radius) {
+            d = i - (height - 1 - radius);
+        }
+        int32_t inset = radius - isqrt(radius_squared - (uint32_t) d * d);
+        set_clipped_row(self, row, x + inset, x + width - 1 - inset);
+    }
+}
+
+static int32_t floor_div(int64_t numerator, int64_t denominator) {
+    int64_t quotient = numerator / denominator;
+    if (numerator % denominator != 0 && numerator < 0) {
+        quotient--;
+    }
+    return quotient;
+}
+
+static int32_t ceil_div(int64_t numerator, int64_t denominator) {
+    int64_t quotient = numerator / denominator;
+    if (numerator % denominator != 0 && numerator > 0) {
+        quotient++;
+    }
+    return quotient;
+}
+
+void common_hal_displayio_shape_set_polygon(displayio_shape_t *self, const int16_t* points, size_t point_count) {
+    for (uint16_t row = 0; row < stored_rows(self); row++) {
+        // A pixel is inside when its center is between the left and right most edges crossing the
+        // center of the row.
+        int32_t start_x = INT32_MAX;
+        int32_t end_x = INT32_MIN;
+        for (size_t i = 0; i < point_count; i++) {
+            int32_t x0 = points[2 * i];
+            int32_t y0 = points[2 * i + 1];
+            int32_t x1 = points[2 * ((i + 1) % point_count)];
+            int32_t y1 = points[2 * ((i + 1) % point_count) + 1];
+            int32_t center = 2 * row + 1;
+            if ((center < 2 * y0 && center < 2 * y1) || (center >= 2 * y0 && center >= 2 * y1)) {
+                continue;
+            }
+            // Where the edge crosses the row's center, less half a pixel, as a fraction.
+            int64_t numerator = (int64_t) 2 * (2 * x0 - 1) * (y1 - y0) + (int64_t) 2 * (center - 2 * y0) * (x1 - x0);
+            int64_t denominator = (int64_t) 4 * (y1 - y0);
+            if (denominator < 0) {
+                numerator = -numerator;
+                denominator = -denominator;
+            }
+            int32_t first = ceil_div(numerator, denominator);
+            int32_t last = floor_div(numerator, denominator);
+            if (first < start_x) {
+                start_x = first;
+            }
+            if (last > end_x) {
+                end_x = last;
+            }
+        }
+        if (start_x > end_x) {
+            set_clipped_row(self, row, 1, 0);
+        } else {
+            set_clipped_row(self, row, start_x, end_x);
+        }
+    }
 }
 
 uint32_t common_hal_displayio_shape_get_pixel(void *obj, int16_t x, int16_t y) {
@@ -88,3 +261,48 @@ uint32_t common_hal_displayio_shape_get_pixel(void *obj, int16_t x, int16_t y) {
     }
     return 1;
 }
+
+// Sets the values covered by the inclusive run start_x to end_x to 1.
+static void fill_run(int16_t x, uint16_t count, uint32_t* values, int32_t start_x, int32_t end_x) {
+    if (start_x < x) {
+        start_x = x;
+    }
+    if (end_x > x + count - 1) {
+        end_x = x + count - 1;
+    }
+    for (int32_t i = start_x; i <= end_x; i++) {
+        values[i - x] = 1;
+    }
+}
+
+void displayio_shape_get_span(displayio_shape_t *self, int16_t x, int16_t y, uint16_t count, uint32_t* values) {
+    memset(values, 0, count * sizeof(uint32_t));
+    if (y < 0 || y >= self->height) {
+        return;
+    }
+    if (self->mirror_y && y > self->half_height) {
+        y = self->height - y - 1;
+    }
+    int32_t start_x = self->data[2 * y];
+    int32_t end_x = self->data[2 * y + 1];
+    if (end_x >= self->width) {
+        end_x = self->width - 1;
+    }
+    fill_run(x, count, values, start_x, end_x);
+    if (self->mirror_x) {
+        fill_run(x, count, values, self->width - 1 - end_x, self->width - 1 - start_x);
+    }
+}
+
+bool displayio_shape_get_dirty_area(displayio_shape_t *self, displayio_area_t* area) {
+    if (displayio_area_empty(&self->dirty_area)) {
+        return false;
+    }
+    displayio_area_copy(&self->dirty_area, area);
+    return true;
+}
+
+void displayio_shape_finish_refresh(displayio_shape_t *self) {
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
+}
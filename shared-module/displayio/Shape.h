@@ -31,6 +31,7 @@
 #include <stdint.h>
 
 #include "py/obj.h"
+#include "shared-module/displayio/area.h"
 
 typedef struct {
     mp_obj_base_t base;
@@ -38,9 +39,15 @@ typedef struct {
     uint16_t height;
     uint16_t half_width;
     uint16_t half_height;
-    uint16_t* data;
+    uint16_t* data; // Inclusive start and end x of each stored row.
+    displayio_area_t dirty_area;
     bool mirror_x;
     bool mirror_y;
 } displayio_shape_t;
 
+// Reads count values from row y starting at x. Values outside of the shape are 0.
+void displayio_shape_get_span(displayio_shape_t *self, int16_t x, int16_t y, uint16_t count, uint32_t* values);
+bool displayio_shape_get_dirty_area(displayio_shape_t *self, displayio_area_t* area);
+void displayio_shape_finish_refresh(displayio_shape_t *self);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_SHAPE_H
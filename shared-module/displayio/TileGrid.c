@@ -29,6 +29,7 @@
 #include "shared-bindings/displayio/Bitmap.h"
 #include "shared-bindings/displayio/ColorConverter.h"
 #include "shared-bindings/displayio/OnDiskBitmap.h"
+#include "shared-bindings/displayio/RLEBitmap.h"
 #include "shared-bindings/displayio/Palette.h"
 #include "shared-bindings/displayio/Shape.h"
 
@@ -64,6 +65,14 @@ void common_hal_displayio_tilegrid_construct(displayio_tilegrid_t *self, mp_obj_
     self->tile_height = tile_height;
     self->bitmap = bitmap;
     self->pixel_shader = pixel_shader;
+    self->top_left_x = 0;
+    self->top_left_y = 0;
+    self->previous_top_left_y = 0;
+    self->previous_area.x1 = 0;
+    self->previous_area.x2 = 0;
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
+    self->full_change = false;
 }
 
 
@@ -74,8 +83,8 @@ void common_hal_displayio_tilegrid_set_x(displayio_tilegrid_t *self, mp_int_t x)
     if (self->area.x1 == x) {
         return;
     }
-    self->needs_refresh = true;
-    self->area.x2 += (self->area.x1 - x);
+    self->full_change = true;
+    self->area.x2 += (x - self->area.x1);
     self->area.x1 = x;
 }
 mp_int_t common_hal_displayio_tilegrid_get_y(displayio_tilegrid_t *self) {
@@ -86,8 +95,8 @@ void common_hal_displayio_tilegrid_set_y(displayio_tilegrid_t *self, mp_int_t y)
     if (self->area.y1 == y) {
         return;
     }
-    self->needs_refresh = true;
-    self->area.y2 += (self->area.y1 - y);
+    self->full_change = true;
+    self->area.y2 += (y - self->area.y1);
     self->area.y1 = y;
 }
 
@@ -97,7 +106,7 @@ mp_obj_t common_hal_displayio_tilegrid_get_pixel_shader(displayio_tilegrid_t *se
 
 void common_hal_displayio_tilegrid_set_pixel_shader(displayio_tilegrid_t *self, mp_obj_t pixel_shader) {
     self->pixel_shader = pixel_shader;
-    self->needs_refresh = true;
+    self->full_change = true;
 }
 
 
@@ -109,34 +118,185 @@ uint16_t common_hal_displayio_tilegrid_get_height(displayio_tilegrid_t *self) {
     return self->height_in_tiles;
 }
 
-uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
-    uint8_t* tiles = self->tiles;
+uint8_t* displayio_tilegrid_get_tiles(displayio_tilegrid_t *self) {
     if (self->inline_tiles) {
-        tiles = (uint8_t*) &self->tiles;
+        return (uint8_t*) &self->tiles;
     }
+    return self->tiles;
+}
+
+uint8_t common_hal_displayio_tilegrid_get_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
+    uint8_t* tiles = displayio_tilegrid_get_tiles(self);
     if (tiles == NULL) {
         return 0;
     }
     return tiles[y * self->width_in_tiles + x];
 }
 
-void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
-    uint8_t* tiles = self->tiles;
-    if (self->inline_tiles) {
-        tiles = (uint8_t*) &self->tiles;
+void displayio_tilegrid_mark_tiles_changed(displayio_tilegrid_t *self, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    // Mark where the tiles are shown, which moves with top_left. Shown tiles are only contiguous
+    // when they don't wrap around the edge so otherwise mark the whole width or height.
+    uint16_t shown_x1 = (x1 + self->width_in_tiles - self->top_left_x % self->width_in_tiles) % self->width_in_tiles;
+    uint16_t shown_x2 = shown_x1 + (x2 - x1);
+    if (shown_x2 > self->width_in_tiles) {
+        shown_x1 = 0;
+        shown_x2 = self->width_in_tiles;
+    }
+    uint16_t shown_y1 = (y1 + self->height_in_tiles - self->top_left_y % self->height_in_tiles) % self->height_in_tiles;
+    uint16_t shown_y2 = shown_y1 + (y2 - y1);
+    if (shown_y2 > self->height_in_tiles) {
+        shown_y1 = 0;
+        shown_y2 = self->height_in_tiles;
     }
+    displayio_area_t tile_area;
+    tile_area.x1 = self->area.x1 + shown_x1 * self->tile_width;
+    tile_area.y1 = self->area.y1 + shown_y1 * self->tile_height;
+    tile_area.x2 = self->area.x1 + shown_x2 * self->tile_width;
+    tile_area.y2 = self->area.y1 + shown_y2 * self->tile_height;
+    displayio_area_expand(&self->dirty_area, &tile_area);
+}
+
+void common_hal_displayio_tilegrid_set_tile(displayio_tilegrid_t *self, uint16_t x, uint16_t y, uint8_t tile_index) {
+    uint8_t* tiles = displayio_tilegrid_get_tiles(self);
     if (tiles == NULL) {
         return;
     }
     tiles[y * self->width_in_tiles + x] = tile_index;
-    self->needs_refresh = true;
+    displayio_tilegrid_mark_tiles_changed(self, x, y, x + 1, y + 1);
 }
 
 
 void common_hal_displayio_tilegrid_set_top_left(displayio_tilegrid_t *self, uint16_t x, uint16_t y) {
+    if (x != self->top_left_x) {
+        self->full_change = true;
+    }
+    uint16_t rows = (y + self->height_in_tiles - self->top_left_y % self->height_in_tiles) % self->height_in_tiles;
     self->top_left_x = x;
     self->top_left_y = y;
-    self->needs_refresh = true;
+    if (rows == 0 || displayio_area_empty(&self->dirty_area)) {
+        return;
+    }
+    // Changed tiles move up with the rest of the content. Cover the whole height when they wrap.
+    int16_t shift = rows * self->tile_height;
+    if (self->dirty_area.y1 - shift >= self->area.y1) {
+        self->dirty_area.y1 -= shift;
+        self->dirty_area.y2 -= shift;
+    } else if (self->dirty_area.y2 - shift <= self->area.y1) {
+        int16_t height = self->area.y2 - self->area.y1;
+        self->dirty_area.y1 += height - shift;
+        self->dirty_area.y2 += height - shift;
+    } else {
+        self->dirty_area.y1 = self->area.y1;
+        self->dirty_area.y2 = self->area.y2;
+    }
+}
+
+uint16_t displayio_tilegrid_get_scrolled_rows(displayio_tilegrid_t *self) {
+    if (self->full_change || displayio_area_empty(&self->previous_area) ||
+        !displayio_area_equal(&self->area, &self->previous_area)) {
+        return 0;
+    }
+    if (!displayio_area_empty(&self->dirty_area) && self->dirty_area.y1 <= self->area.y1 &&
+        self->dirty_area.y2 >= self->area.y2) {
+        return 0;
+    }
+    if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type) &&
+        displayio_palette_needs_refresh(self->pixel_shader)) {
+        return 0;
+    }
+    if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type) &&
+        displayio_colorconverter_needs_refresh(self->pixel_shader)) {
+        return 0;
+    }
+    return (self->top_left_y + self->height_in_tiles - self->previous_top_left_y % self->height_in_tiles) % self->height_in_tiles;
+}
+
+void displayio_tilegrid_finish_scroll(displayio_tilegrid_t *self) {
+    self->previous_top_left_y = self->top_left_y;
+}
+
+// Maximum number of bitmap values read at once. Longer tile rows are split into multiple spans.
+#define SPAN_LENGTH (32)
+
+// Set in a span value when the pixel shader made it transparent. Colors only use the lower 16 bits.
+#define TRANSPARENT_VALUE (0x10000)
+
+typedef void (*span_reader_t)(mp_obj_t bitmap, int16_t x, int16_t y, uint16_t count, uint32_t* values);
+
+static void bitmap_span(mp_obj_t bitmap, int16_t x, int16_t y, uint16_t count, uint32_t* values) {
+    displayio_bitmap_get_span(bitmap, x, y, count, values);
+}
+
+static void shape_span(mp_obj_t shape, int16_t x, int16_t y, uint16_t count, uint32_t* values) {
+    displayio_shape_get_span(shape, x, y, count, values);
+}
+
+static void ondiskbitmap_span(mp_obj_t bitmap, int16_t x, int16_t y, uint16_t count, uint32_t* values) {
+    displayio_ondiskbitmap_get_span(bitmap, x, y, count, values);
+}
+
+static void rlebitmap_span(mp_obj_t bitmap, int16_t x, int16_t y, uint16_t count, uint32_t* values) {
+    displayio_rlebitmap_get_span(bitmap, x, y, count, values);
+}
+
+static bool mask_is_empty(uint32_t* mask, uint32_t pixel_count) {
+    for (uint32_t i = 0; i < (pixel_count + 31) / 32; i++) {
+        if (mask[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool mask_is_full(uint32_t* mask, uint32_t pixel_count) {
+    for (uint32_t i = 0; i < pixel_count / 32; i++) {
+        if (mask[i] != 0xffffffff) {
+            return false;
+        }
+    }
+    uint32_t remainder = pixel_count % 32;
+    if (remainder == 0) {
+        return true;
+    }
+    uint32_t last = (1u << remainder) - 1;
+    return (mask[pixel_count / 32] & last) == last;
+}
+
+// Sets count bits in mask starting at bit start.
+static void fill_mask(uint32_t* mask, uint32_t start, uint32_t count) {
+    while (count > 0 && start % 32 != 0) {
+        mask[start / 32] |= 1u << (start % 32);
+        start++;
+        count--;
+    }
+    while (count >= 32) {
+        mask[start / 32] = 0xffffffff;
+        start += 32;
+        count -= 32;
+    }
+    if (count > 0) {
+        mask[start / 32] |= (1u << count) - 1;
+    }
+}
+
+// Writes count copies of value starting at offset and marks them in the mask.
+static void fill_pixels(uint16_t* pixels, uint32_t* mask, uint16_t offset, int16_t stride, uint16_t count, uint16_t value) {
+    if (stride == 1) {
+        for (uint16_t i = 0; i < count; i++) {
+            pixels[offset + i] = value;
+        }
+        fill_mask(mask, offset, count);
+    } else if (stride == -1) {
+        for (uint16_t i = 0; i < count; i++) {
+            pixels[offset - i] = value;
+        }
+        fill_mask(mask, offset - count + 1, count);
+    } else {
+        for (uint16_t i = 0; i < count; i++, offset += stride) {
+            pixels[offset] = value;
+            mask[offset / 32] |= 1u << (offset % 32);
+        }
+    }
 }
 
 bool displayio_tilegrid_get_area(displayio_tilegrid_t *self, displayio_buffer_transform_t* transform, displayio_area_t* area, uint32_t* mask, uint32_t *buffer) {
@@ -160,6 +320,29 @@ bool displayio_tilegrid_get_area(displayio_tilegrid_t *self, displayio_buffer_tr
         return false;
     }
 
+    // Pick how to read values and shade them once rather than for every pixel.
+    span_reader_t read_span;
+    if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
+        read_span = bitmap_span;
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type)) {
+        read_span = shape_span;
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_ondiskbitmap_type)) {
+        read_span = ondiskbitmap_span;
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_rlebitmap_type)) {
+        read_span = rlebitmap_span;
+    } else {
+        return false;
+    }
+    displayio_palette_t* palette = NULL;
+    displayio_colorconverter_t* colorconverter = NULL;
+    if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
+        palette = self->pixel_shader;
+    } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
+        colorconverter = self->pixel_shader;
+    } else if (self->pixel_shader != mp_const_none) {
+        return false;
+    }
+
     int16_t x_stride = 1;
     int16_t y_stride = displayio_area_width(area);
     if (transform->transpose_xy) {
@@ -180,92 +363,227 @@ bool displayio_tilegrid_get_area(displayio_tilegrid_t *self, displayio_buffer_tr
     // layers at that point.
     bool full_coverage = displayio_area_equal(area, &overlap);
 
-    // TODO(tannewt): Skip coverage tracking if all pixels outside the overlap have already been
-    // set and our palette is all opaque.
+    // When no layer above us has drawn into the area, opaque spans don't need to check the mask.
+    uint32_t area_size = displayio_area_size(area);
+    bool unmasked = mask_is_empty(mask, area_size);
 
-    // TODO(tannewt): Check to see if the pixel_shader has any transparency. If it doesn't then we
-    // can either return full coverage or bulk update the mask.
-    int16_t y = overlap.y1 - scaled_area.y1;
-    if (y < 0) {
-        y = 0;
-    }
+    uint16_t scale = transform->scale;
     int16_t x_shift = area->x1 - scaled_area.x1;
     int16_t y_shift = area->y1 - scaled_area.y1;
-    for (; y < overlap.y2 - scaled_area.y1; y++) {
-        int16_t x = overlap.x1 - scaled_area.x1;
-        if (x < 0) {
-            x = 0;
-        }
-        int16_t row_start = start + (y - y_shift) * y_stride;
-        int16_t local_y = y / transform->scale;
-        for (; x < overlap.x2 - scaled_area.x1; x++) {
-            // Compute the destination pixel in the buffer and mask based on the transformations.
-            uint16_t offset = row_start + (x - x_shift) * x_stride;
-
-            // This is super useful for debugging out range accesses. Uncomment to use.
-            // if (offset < 0 || offset >= displayio_area_size(area)) {
-            //     asm("bkpt");
-            // }
-
-            // Check the mask first to see if the pixel has already been set.
-            if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
-                continue;
+    int16_t x_start = overlap.x1 - scaled_area.x1;
+    int16_t x_end = overlap.x2 - scaled_area.x1;
+    uint16_t* pixels = (uint16_t*) buffer;
+    uint32_t values[SPAN_LENGTH];
+    for (int16_t y = overlap.y1 - scaled_area.y1; y < overlap.y2 - scaled_area.y1; y++) {
+        // Everything about the tile row is the same for the whole output row.
+        int16_t local_y = y / scale;
+        uint16_t row_in_tiles = (local_y / self->tile_height + self->top_left_y) % self->height_in_tiles;
+        uint8_t* tile_row = tiles + row_in_tiles * self->width_in_tiles;
+        uint16_t y_in_tile = local_y % self->tile_height;
+
+        int16_t local_x = x_start / scale;
+        // Number of times the first value still needs to be repeated when scaled.
+        uint16_t repeat = scale - x_start % scale;
+        uint16_t column_in_tiles = (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
+        uint16_t x_in_tile = local_x % self->tile_width;
+        uint16_t offset = start + (y - y_shift) * y_stride + (x_start - x_shift) * x_stride;
+        int16_t x = x_start;
+        while (x < x_end) {
+            // Read up to the end of the current tile.
+            uint16_t count = self->tile_width - x_in_tile;
+            uint16_t remaining = (x_end - x - repeat + scale - 1) / scale + 1;
+            if (count > remaining) {
+                count = remaining;
             }
-            int16_t local_x = x / transform->scale;
-            uint16_t tile_location = ((local_y / self->tile_height + self->top_left_y) % self->height_in_tiles) * self->width_in_tiles + (local_x / self->tile_width + self->top_left_x) % self->width_in_tiles;
-            uint8_t tile = tiles[tile_location];
-            uint16_t tile_x = (tile % self->bitmap_width_in_tiles) * self->tile_width + local_x % self->tile_width;
-            uint16_t tile_y = (tile / self->bitmap_width_in_tiles) * self->tile_height + local_y % self->tile_height;
-
-            uint32_t value = 0;
-            // We always want to read bitmap pixels by row first and then transpose into the destination
-            // buffer because most bitmaps are row associated.
-            if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
-                value = common_hal_displayio_bitmap_get_pixel(self->bitmap, tile_x, tile_y);
-            } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type)) {
-                value = common_hal_displayio_shape_get_pixel(self->bitmap, tile_x, tile_y);
-            } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_ondiskbitmap_type)) {
-                value = common_hal_displayio_ondiskbitmap_get_pixel(self->bitmap, tile_x, tile_y);
+            if (count > SPAN_LENGTH) {
+                count = SPAN_LENGTH;
             }
+            uint8_t tile = tile_row[column_in_tiles];
+            // We always want to read bitmap pixels by row first and then transpose into the
+            // destination buffer because most bitmaps are row associated.
+            read_span(self->bitmap,
+                      (tile % self->bitmap_width_in_tiles) * self->tile_width + x_in_tile,
+                      (tile / self->bitmap_width_in_tiles) * self->tile_height + y_in_tile,
+                      count, values);
 
-            uint16_t* pixel = ((uint16_t*) buffer) + offset;
-            if (self->pixel_shader == mp_const_none) {
-                *pixel = value;
-                return true;
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
-                if (!displayio_palette_get_color(self->pixel_shader, value, pixel)) {
-                    // A pixel is transparent so we haven't fully covered the area ourselves.
-                    full_coverage = false;
-                } else {
-                    mask[offset / 32] |= 1 << (offset % 32);
+            bool span_opaque = true;
+            if (palette != NULL) {
+                span_opaque = displayio_palette_get_colors(palette, values, count, TRANSPARENT_VALUE);
+            } else if (colorconverter != NULL) {
+                displayio_colorconverter_convert_span(colorconverter, values, count, x / scale, local_y);
+            } else {
+                for (uint16_t i = 0; i < count; i++) {
+                    values[i] &= 0xffff;
+                }
+            }
+
+            if (unmasked && span_opaque) {
+                // Nothing above us has drawn here and every value is opaque so write the pixels
+                // without checking the mask and then mark them all at once.
+                uint16_t first_offset = offset;
+                int16_t first_x = x;
+                for (uint16_t i = 0; i < count; i++) {
+                    uint16_t value = values[i];
+                    for (; repeat > 0 && x < x_end; repeat--, x++, offset += x_stride) {
+                        pixels[offset] = value;
+                    }
+                    repeat = scale;
                 }
-            } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
-                if (!common_hal_displayio_colorconverter_convert(self->pixel_shader, value, pixel)) {
-                    // A pixel is transparent so we haven't fully covered the area ourselves.
-                    full_coverage = false;
+                uint16_t written = x - first_x;
+                if (x_stride == 1) {
+                    fill_mask(mask, first_offset, written);
+                } else if (x_stride == -1) {
+                    fill_mask(mask, first_offset - written + 1, written);
                 } else {
-                    mask[offset / 32] |= 1 << (offset % 32);
+                    for (uint16_t i = 0, o = first_offset; i < written; i++, o += x_stride) {
+                        mask[o / 32] |= 1u << (o % 32);
+                    }
+                }
+            } else if (unmasked) {
+                // Some values are transparent. Skip them a run at a time and fill the opaque runs
+                // in between, which is how Shapes and sprites are normally drawn.
+                uint16_t i = 0;
+                while (i < count && x < x_end) {
+                    uint32_t value = values[i];
+                    uint16_t run = 1;
+                    while (i + run < count && values[i + run] == value) {
+                        run++;
+                    }
+                    i += run;
+                    uint16_t written = repeat + (run - 1) * scale;
+                    if (written > x_end - x) {
+                        written = x_end - x;
+                    }
+                    repeat = scale;
+                    if (value == TRANSPARENT_VALUE) {
+                        full_coverage = false;
+                    } else {
+                        fill_pixels(pixels, mask, offset, x_stride, written, value);
+                    }
+                    x += written;
+                    offset += written * x_stride;
+                }
+            } else {
+                for (uint16_t i = 0; i < count; i++) {
+                    uint32_t value = values[i];
+                    for (; repeat > 0 && x < x_end; repeat--, x++, offset += x_stride) {
+                        // This is super useful for debugging out range accesses. Uncomment to use.
+                        // if (offset < 0 || offset >= displayio_area_size(area)) {
+                        //     asm("bkpt");
+                        // }
+
+                        // Check the mask first to see if the pixel has already been set.
+                        if ((mask[offset / 32] & (1 << (offset % 32))) != 0) {
+                            continue;
+                        }
+                        if (value == TRANSPARENT_VALUE) {
+                            // A pixel is transparent so we haven't fully covered the area ourselves.
+                            full_coverage = false;
+                            continue;
+                        }
+                        pixels[offset] = value;
+                        mask[offset / 32] |= 1 << (offset % 32);
+                    }
+                    repeat = scale;
+                }
+            }
+
+            x_in_tile += count;
+            if (x_in_tile == self->tile_width) {
+                x_in_tile = 0;
+                column_in_tiles++;
+                if (column_in_tiles == self->width_in_tiles) {
+                    column_in_tiles = 0;
                 }
             }
         }
     }
+    // Layers above us may have filled in the rest of the area, in which case the ones below us
+    // don't need to be visited.
+    if (!full_coverage) {
+        full_coverage = mask_is_full(mask, area_size);
+    }
     return full_coverage;
 }
 
-bool displayio_tilegrid_needs_refresh(displayio_tilegrid_t *self) {
-    if (self->needs_refresh) {
-        return true;
-    } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
-        return displayio_palette_needs_refresh(self->pixel_shader);
+// Marks the parts of the TileGrid that show the changed area of our bitmap.
+static void mark_bitmap_changes(displayio_tilegrid_t *self, uint8_t* tiles, const displayio_area_t* changed) {
+    for (uint16_t y = 0; y < self->height_in_tiles; y++) {
+        for (uint16_t x = 0; x < self->width_in_tiles; x++) {
+            uint8_t tile = tiles[y * self->width_in_tiles + x];
+            displayio_area_t tile_area;
+            tile_area.x1 = (tile % self->bitmap_width_in_tiles) * self->tile_width;
+            tile_area.y1 = (tile / self->bitmap_width_in_tiles) * self->tile_height;
+            tile_area.x2 = tile_area.x1 + self->tile_width;
+            tile_area.y2 = tile_area.y1 + self->tile_height;
+            displayio_area_t overlap;
+            if (!displayio_area_compute_overlap(changed, &tile_area, &overlap) ||
+                displayio_area_empty(&overlap)) {
+                continue;
+            }
+            uint16_t shown_x = (x + self->width_in_tiles - self->top_left_x % self->width_in_tiles) % self->width_in_tiles;
+            uint16_t shown_y = (y + self->height_in_tiles - self->top_left_y % self->height_in_tiles) % self->height_in_tiles;
+            displayio_area_shift(&overlap,
+                                 self->area.x1 + shown_x * self->tile_width - tile_area.x1,
+                                 self->area.y1 + shown_y * self->tile_height - tile_area.y1);
+            displayio_area_expand(&self->dirty_area, &overlap);
+        }
+    }
+}
+
+void displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_list_t* areas, int16_t x, int16_t y, uint16_t scale) {
+    uint8_t* tiles = displayio_tilegrid_get_tiles(self);
+    if (tiles == NULL) {
+        return;
+    }
+
+    if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
+        self->full_change = self->full_change || displayio_palette_needs_refresh(self->pixel_shader);
     } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
-        return displayio_colorconverter_needs_refresh(self->pixel_shader);
+        self->full_change = self->full_change || displayio_colorconverter_needs_refresh(self->pixel_shader);
+    }
+
+    // Scrolling moves everything so it is a full change unless the display scrolled for us.
+    if (self->full_change || self->top_left_y != self->previous_top_left_y ||
+        displayio_area_empty(&self->previous_area)) {
+        // Redraw where we were and where we are now. The list merges them when they are close.
+        displayio_area_list_add(areas, &self->previous_area, x, y, scale);
+        displayio_area_list_add(areas, &self->area, x, y, scale);
+        return;
     }
 
-    return false;
+    displayio_area_t bitmap_changes;
+    if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type) &&
+        displayio_bitmap_get_dirty_area(self->bitmap, &bitmap_changes)) {
+        mark_bitmap_changes(self, tiles, &bitmap_changes);
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type) &&
+               displayio_shape_get_dirty_area(self->bitmap, &bitmap_changes)) {
+        mark_bitmap_changes(self, tiles, &bitmap_changes);
+    }
+    displayio_area_list_add(areas, &self->dirty_area, x, y, scale);
+}
+
+bool displayio_tilegrid_release_previous_area(displayio_tilegrid_t *self, displayio_area_t* area) {
+    if (displayio_area_empty(&self->previous_area)) {
+        return false;
+    }
+    displayio_area_copy(&self->previous_area, area);
+    self->previous_area.x1 = 0;
+    self->previous_area.x2 = 0;
+    return true;
 }
 
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self) {
-    self->needs_refresh = false;
+    self->full_change = false;
+    self->previous_top_left_y = self->top_left_y;
+    displayio_area_copy(&self->area, &self->previous_area);
+    self->dirty_area.x1 = 0;
+    self->dirty_area.x2 = 0;
+    if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_bitmap_type)) {
+        displayio_bitmap_finish_refresh(self->bitmap);
+    } else if (MP_OBJ_IS_TYPE(self->bitmap, &displayio_shape_type)) {
+        displayio_shape_finish_refresh(self->bitmap);
+    }
     if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_palette_type)) {
         displayio_palette_finish_refresh(self->pixel_shader);
     } else if (MP_OBJ_IS_TYPE(self->pixel_shader, &displayio_colorconverter_type)) {
@@ -45,13 +45,35 @@ typedef struct {
     uint16_t tile_height;
     uint16_t top_left_x;
     uint16_t top_left_y;
+    // top_left_y when last drawn. Changing it alone scrolls what was drawn rather than changing it.
+    uint16_t previous_top_left_y;
     uint8_t* tiles;
-    bool needs_refresh;
+    displayio_area_t previous_area; // Area drawn during the last refresh. Empty until drawn.
+    displayio_area_t dirty_area; // Area changed since the last refresh.
+    bool full_change;
     bool inline_tiles;
 } displayio_tilegrid_t;
 
 bool displayio_tilegrid_get_area(displayio_tilegrid_t *self, displayio_buffer_transform_t* transform, displayio_area_t* area, uint32_t* mask, uint32_t *buffer);
-bool displayio_tilegrid_needs_refresh(displayio_tilegrid_t *self);
+// Adds the areas that need to be redrawn to the list. x, y and scale convert the coordinates of our
+// parent Group into display coordinates.
+void displayio_tilegrid_get_refresh_areas(displayio_tilegrid_t *self, displayio_area_list_t* areas, int16_t x, int16_t y, uint16_t scale);
+// Returns the area drawn during the last refresh and forgets it so that the next refresh draws the
+// TileGrid as new. Used when the TileGrid is removed from its Group.
+bool displayio_tilegrid_release_previous_area(displayio_tilegrid_t *self, displayio_area_t* area);
 void displayio_tilegrid_finish_refresh(displayio_tilegrid_t *self);
 
+// Returns the tile indices in row major order or NULL when there are none. Changes made through it
+// must be passed to displayio_tilegrid_mark_tiles_changed.
+uint8_t* displayio_tilegrid_get_tiles(displayio_tilegrid_t *self);
+// Marks tiles x1 <= x < x2 and y1 <= y < y2, in tile coordinates, as changed.
+void displayio_tilegrid_mark_tiles_changed(displayio_tilegrid_t *self, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+// Returns how many rows of tiles the content moved up since the last refresh when only top_left_y
+// changed. The rest of the TileGrid is already up to date apart from its changed tiles. Returns 0
+// when there is nothing to scroll or the whole TileGrid has to be redrawn anyway.
+uint16_t displayio_tilegrid_get_scrolled_rows(displayio_tilegrid_t *self);
+// Called once the display has moved the pixels to match top_left_y so only changed tiles are
+// redrawn.
+void displayio_tilegrid_finish_scroll(displayio_tilegrid_t *self);
+
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_TILEGRID_H
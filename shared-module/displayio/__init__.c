@@ -15,6 +15,7 @@
 #include "supervisor/shared/display.h"
 #include "supervisor/memory.h"
 #include "supervisor/usb.h"
+#include "tick.h"
 
 primary_display_t displays[CIRCUITPY_DISPLAY_LIMIT];
 
@@ -27,6 +28,274 @@ static inline void swap(int16_t* a, int16_t* b) {
 // Check for recursive calls to displayio_refresh_displays.
 bool refresh_displays_in_progress = false;
 
+static uint64_t ticks_us(void) {
+    uint64_t ms;
+    uint32_t us_until_ms;
+    current_tick(&ms, &us_until_ms);
+    return ms * 1000 + 1000 - us_until_ms;
+}
+
+static void pixels_sent(void* context) {
+    *((volatile bool*) context) = false;
+}
+
+// Waits for the pixels being sent and releases the display bus.
+static void finish_send(displayio_display_obj_t* display) {
+    while (displayio_display_send_in_progress(display)) {}
+    displayio_display_end_transaction(display);
+
+    // TODO(tannewt): Make refresh displays faster so we don't starve other
+    // background tasks.
+    usb_background();
+}
+
+// Redraws the given area of the display. The area is in display coordinates. Returns false if the
+// display bus couldn't be acquired.
+static bool refresh_area(displayio_display_obj_t* display, const displayio_area_t* area) {
+    displayio_area_t whole_screen = {
+        .x1 = 0,
+        .y1 = 0,
+        .x2 = display->width,
+        .y2 = display->height
+    };
+    displayio_area_t clipped;
+    if (!displayio_area_compute_overlap(area, &whole_screen, &clipped) ||
+        displayio_area_empty(&clipped)) {
+        return true;
+    }
+    // Rows scrolled by the panel wrap around in its memory so split areas where they do. The panel
+    // only scrolls when display rows are panel rows.
+    uint16_t scroll_break = displayio_display_get_scroll_break(display, clipped.y1, clipped.y2);
+    if (scroll_break < clipped.y2) {
+        displayio_area_t rest;
+        displayio_area_copy(&clipped, &rest);
+        clipped.y2 = scroll_break;
+        rest.y1 = scroll_break;
+        return refresh_area(display, &clipped) && refresh_area(display, &rest);
+    }
+    if (display->transpose_xy) {
+        swap(&whole_screen.x2, &whole_screen.y2);
+    }
+
+    // Convert the area into panel coordinates by undoing the transpose and mirroring applied to
+    // each subrectangle below.
+    displayio_area_t panel_area;
+    displayio_area_copy(&clipped, &panel_area);
+    if (display->transpose_xy) {
+        swap(&panel_area.x1, &panel_area.y1);
+        swap(&panel_area.x2, &panel_area.y2);
+    }
+    if (display->mirror_x) {
+        uint16_t width = displayio_area_width(&whole_screen);
+        int16_t x1 = panel_area.x1;
+        panel_area.x1 = width - panel_area.x2;
+        panel_area.x2 = width - x1;
+    }
+    if (display->mirror_y != display->transpose_xy) {
+        uint16_t height = displayio_area_height(&whole_screen);
+        int16_t y1 = panel_area.y1;
+        panel_area.y1 = height - panel_area.y2;
+        panel_area.y2 = height - y1;
+    }
+
+    uint16_t buffer_size = CIRCUITPY_DISPLAY_BUFFER_SIZE; // In pixels.
+
+    uint16_t subrectangles = 1;
+    uint16_t rows_per_buffer = displayio_area_height(&panel_area);
+    if (displayio_area_size(&panel_area) > buffer_size) {
+        rows_per_buffer = buffer_size / displayio_area_width(&panel_area);
+        if (rows_per_buffer == 0) {
+            rows_per_buffer = 1;
+        }
+        subrectangles = displayio_area_height(&panel_area) / rows_per_buffer;
+        if (displayio_area_height(&panel_area) % rows_per_buffer != 0) {
+            subrectangles++;
+        }
+        buffer_size = rows_per_buffer * displayio_area_width(&panel_area);
+    }
+    // Two pixels fit in each word. One buffer is rendered while the other is being sent.
+    uint32_t buffers[2][(buffer_size + 1) / 2];
+    volatile bool buffer_sending[2] = {false, false};
+    uint32_t mask[(buffer_size / 32) + 1];
+    // Rendering may read from the bus, for example an OnDiskBitmap on an SD card next to the
+    // display. So the next subrectangle is only rendered while the last one goes out when the bus
+    // belongs to the display alone. Otherwise the bus is released before rendering.
+    bool overlap_send = !displayio_display_bus_shared(display);
+
+    bool ok = true;
+    for (uint16_t j = 0; j < subrectangles; j++) {
+        uint8_t current = j % 2;
+        uint32_t* buffer = buffers[current];
+        displayio_area_t subrectangle = {
+            .x1 = panel_area.x1,
+            .y1 = panel_area.y1 + rows_per_buffer * j,
+            .x2 = panel_area.x2,
+            .y2 = panel_area.y1 + rows_per_buffer * (j + 1)
+        };
+        if (subrectangle.y2 > panel_area.y2) {
+            subrectangle.y2 = panel_area.y2;
+        }
+        uint16_t subrectangle_size = displayio_area_size(&subrectangle);
+
+        // Handle display mirroring and transpose.
+        displayio_area_t transformed_subrectangle;
+        displayio_buffer_transform_t transform;
+        if (display->mirror_x) {
+            uint16_t width = displayio_area_width(&whole_screen);
+            transformed_subrectangle.x1 = width - subrectangle.x2;
+            transformed_subrectangle.x2 = width - subrectangle.x1;
+        } else {
+            transformed_subrectangle.x1 = subrectangle.x1;
+            transformed_subrectangle.x2 = subrectangle.x2;
+        }
+        if (display->mirror_y != display->transpose_xy) {
+            uint16_t height = displayio_area_height(&whole_screen);
+            transformed_subrectangle.y1 = height - subrectangle.y2;
+            transformed_subrectangle.y2 = height - subrectangle.y1;
+        } else {
+            transformed_subrectangle.y1 = subrectangle.y1;
+            transformed_subrectangle.y2 = subrectangle.y2;
+        }
+        transform.width = transformed_subrectangle.x2 - transformed_subrectangle.x1;
+        transform.height = transformed_subrectangle.y2 - transformed_subrectangle.y1;
+        if (display->transpose_xy) {
+            int16_t y1 = transformed_subrectangle.y1;
+            int16_t y2 = transformed_subrectangle.y2;
+            transformed_subrectangle.y1 = transformed_subrectangle.x1;
+            transformed_subrectangle.y2 = transformed_subrectangle.x2;
+            transformed_subrectangle.x1 = y1;
+            transformed_subrectangle.x2 = y2;
+        }
+        transform.transpose_xy = display->transpose_xy;
+        transform.mirror_x = display->mirror_x;
+        transform.mirror_y = display->mirror_y;
+        transform.scale = 1;
+
+        if (j > 0 && !overlap_send) {
+            finish_send(display);
+        }
+        // The buffer was sent two subrectangles ago so it is normally free already.
+        while (buffer_sending[current]) {
+            displayio_display_send_in_progress(display);
+        }
+
+        for (uint16_t k = 0; k < (subrectangle_size / 32) + 1; k++) {
+            mask[k] = 0x00000000;
+        }
+        uint64_t render_start = ticks_us();
+        bool full_coverage = displayio_group_get_area(display->current_group, &transform, &transformed_subrectangle, mask, buffer);
+        if (!full_coverage) {
+            for (uint32_t index = 0; index < subrectangle_size; index++) {
+                if ((mask[index / 32] & (1 << (index % 32))) == 0) {
+                    ((uint16_t*) buffer)[index] = 0x0000;
+                }
+            }
+        }
+        display->frame_render_time_us += ticks_us() - render_start;
+        display->pixels_sent += subrectangle_size;
+
+        // The region can only change once the previous subrectangle has gone out.
+        if (j > 0 && overlap_send) {
+            finish_send(display);
+        }
+
+        if (!displayio_display_begin_transaction(display)) {
+            // Can't acquire display bus; skip the rest of the data.
+            ok = false;
+            break;
+        }
+        displayio_display_set_region_to_update(display, subrectangle.x1, subrectangle.y1,
+                                                        subrectangle.x2, subrectangle.y2);
+        buffer_sending[current] = true;
+        displayio_display_begin_send_pixels(display, (uint8_t*) buffer, subrectangle_size * sizeof(uint16_t),
+                                            pixels_sent, (void*) &buffer_sending[current]);
+    }
+    if (ok) {
+        // Wait for the last subrectangle because its buffer is on our stack.
+        finish_send(display);
+    }
+    return ok;
+}
+
+// Number of pixels drawn between checks of a display's refresh time budget.
+#define BUDGET_CHECK_PIXELS (CIRCUITPY_DISPLAY_BUFFER_SIZE * 4)
+
+// Adds areas from first on to the ones drawn first on the next refresh.
+static void save_pending_areas(displayio_display_obj_t* display, displayio_area_list_t* areas, uint8_t first) {
+    for (uint8_t k = first; k < areas->count; k++) {
+        displayio_area_list_add(&display->pending_areas, &areas->areas[k], 0, 0, 1);
+    }
+}
+
+// Draws everything that has changed on the display. When time_budget_us isn't 0, drawing stops
+// once it has been used up and the rest is drawn first on the next call.
+static void refresh_display(displayio_display_obj_t* display, uint32_t time_budget_us) {
+    uint64_t start = ticks_us();
+    uint32_t render_time_before = display->frame_render_time_us;
+
+    displayio_area_list_t areas;
+    memcpy(&areas, &display->pending_areas, sizeof(areas));
+    displayio_area_list_t changed;
+    if (displayio_display_get_refresh_areas(display, &changed)) {
+        for (uint8_t i = 0; i < changed.count; i++) {
+            displayio_area_list_add(&areas, &changed.areas[i], 0, 0, 1);
+        }
+    }
+    if (areas.count > 0) {
+        if (!displayio_display_begin_transaction(display)) {
+            // Can't acquire display bus; skip updating this display. Nothing has been marked as
+            // drawn so we'll try again next time.
+            return;
+        }
+        displayio_display_end_transaction(display);
+        display->pending_areas.count = 0;
+
+        for (uint8_t j = 0; j < areas.count; j++) {
+            displayio_area_t* area = &areas.areas[j];
+            if (time_budget_us == 0) {
+                if (!refresh_area(display, area)) {
+                    // Lost the display bus. Save what's left for next time.
+                    save_pending_areas(display, &areas, j);
+                    break;
+                }
+                continue;
+            }
+            // Draw large areas in bands of rows so that we can stop part way through them.
+            int16_t band_rows = BUDGET_CHECK_PIXELS / displayio_area_width(area);
+            if (band_rows == 0) {
+                band_rows = 1;
+            }
+            displayio_area_t band;
+            displayio_area_copy(area, &band);
+            bool ok = true;
+            while (band.y1 < area->y2) {
+                band.y2 = band.y1 + band_rows;
+                if (band.y2 > area->y2) {
+                    band.y2 = area->y2;
+                }
+                ok = refresh_area(display, &band);
+                if (!ok) {
+                    break;
+                }
+                band.y1 = band.y2;
+                if (ticks_us() - start >= time_budget_us) {
+                    break;
+                }
+            }
+            if (!ok || band.y1 < area->y2 || (j + 1 < areas.count && ticks_us() - start >= time_budget_us)) {
+                // Out of time or lost the display bus. Save what's left, starting with the first
+                // band that wasn't drawn, for next time.
+                area->y1 = band.y1;
+                save_pending_areas(display, &areas, j);
+                break;
+            }
+        }
+        uint32_t render_time = display->frame_render_time_us - render_time_before;
+        display->frame_send_time_us += (ticks_us() - start) - render_time;
+    }
+    displayio_display_finish_refresh(display);
+}
+
 void displayio_refresh_displays(void) {
     if (mp_hal_is_interrupted()) {
         return;
@@ -56,132 +325,41 @@ void displayio_refresh_displays(void) {
             // Too soon. Try next display.
             continue;
         }
-        if (displayio_display_refresh_queued(display)) {
-            if (!displayio_display_begin_transaction(display)) {
-                // Can't acquire display bus; skip updating this display. Try next display.
-                continue;
-            }
-            displayio_display_end_transaction(display);
-
-            displayio_area_t whole_screen = {
-                .x1 = 0,
-                .y1 = 0,
-                .x2 = display->width,
-                .y2 = display->height
-            };
-            if (display->transpose_xy) {
-                swap(&whole_screen.x2, &whole_screen.y2);
-            }
-
-            uint16_t buffer_size = 512;
-
-            uint16_t subrectangles = 1;
-            uint16_t rows_per_buffer = displayio_area_height(&whole_screen);
-            if (displayio_area_size(&whole_screen) > buffer_size) {
-                rows_per_buffer = buffer_size / displayio_area_width(&whole_screen);
-                subrectangles = displayio_area_height(&whole_screen) / rows_per_buffer;
-                buffer_size = rows_per_buffer * displayio_area_width(&whole_screen);
-            }
-            uint32_t buffer[buffer_size / 2];
-
-            for (uint16_t j = 0; j < subrectangles; j++) {
-                displayio_area_t subrectangle = {
-                    .x1 = 0,
-                    .y1 = rows_per_buffer * j,
-                    .x2 = displayio_area_width(&whole_screen),
-                    .y2 = rows_per_buffer * (j + 1)
-                };
-
-                displayio_display_begin_transaction(display);
-                displayio_display_set_region_to_update(display, subrectangle.x1, subrectangle.y1,
-                                                                subrectangle.x2, subrectangle.y2);
-                displayio_display_end_transaction(display);
-
-                // Handle display mirroring and transpose.
-                displayio_area_t transformed_subrectangle;
-                displayio_buffer_transform_t transform;
-                if (display->mirror_x) {
-                    uint16_t width = displayio_area_width(&whole_screen);
-                    transformed_subrectangle.x1 = width - subrectangle.x2;
-                    transformed_subrectangle.x2 = width - subrectangle.x1;
-                } else {
-                    transformed_subrectangle.x1 = subrectangle.x1;
-                    transformed_subrectangle.x2 = subrectangle.x2;
-                }
-                if (display->mirror_y != display->transpose_xy) {
-                    uint16_t height = displayio_area_height(&whole_screen);
-                    transformed_subrectangle.y1 = height - subrectangle.y2;
-                    transformed_subrectangle.y2 = height - subrectangle.y1;
-                } else {
-                    transformed_subrectangle.y1 = subrectangle.y1;
-                    transformed_subrectangle.y2 = subrectangle.y2;
-                }
-                transform.width = transformed_subrectangle.x2 - transformed_subrectangle.x1;
-                transform.height = transformed_subrectangle.y2 - transformed_subrectangle.y1;
-                if (display->transpose_xy) {
-                    int16_t y1 = transformed_subrectangle.y1;
-                    int16_t y2 = transformed_subrectangle.y2;
-                    transformed_subrectangle.y1 = transformed_subrectangle.x1;
-                    transformed_subrectangle.y2 = transformed_subrectangle.x2;
-                    transformed_subrectangle.x1 = y1;
-                    transformed_subrectangle.x2 = y2;
-                }
-                transform.transpose_xy = display->transpose_xy;
-                transform.mirror_x = display->mirror_x;
-                transform.mirror_y = display->mirror_y;
-                transform.scale = 1;
-
-                uint32_t mask[(buffer_size / 32) + 1];
-                for (uint16_t k = 0; k < (buffer_size / 32) + 1; k++) {
-                    mask[k] = 0x00000000;
-                }
-                bool full_coverage = displayio_group_get_area(display->current_group, &transform, &transformed_subrectangle, mask, buffer);
-                if (!full_coverage) {
-                    uint32_t index = 0;
-                    uint32_t current_mask = 0;
-                    for (int16_t y = subrectangle.y1; y < subrectangle.y2; y++) {
-                        for (int16_t x = subrectangle.x1; x < subrectangle.x2; x++) {
-                            if (index % 32 == 0) {
-                                current_mask = mask[index / 32];
-                            }
-                            if ((current_mask & (1 << (index % 32))) == 0) {
-                                ((uint16_t*) buffer)[index] = 0x0000;
-                            }
-                            index++;
-                        }
-                    }
-                }
-
-                if (!displayio_display_begin_transaction(display)) {
-                    // Can't acquire display bus; skip the rest of the data. Try next display.
-                    break;
-                }
-                displayio_display_send_pixels(display, buffer, buffer_size / 2);
-                displayio_display_end_transaction(display);
-
-                // TODO(tannewt): Make refresh displays faster so we don't starve other
-                // background tasks.
-                usb_background();
-            }
-        }
-        displayio_display_finish_refresh(display);
+        refresh_display(display, display->max_refresh_time_us);
     }
 
     // All done.
     refresh_displays_in_progress = false;
 }
 
+void displayio_refresh_display(displayio_display_obj_t* display) {
+    if (refresh_displays_in_progress) {
+        return;
+    }
+    refresh_displays_in_progress = true;
+    refresh_display(display, 0);
+    refresh_displays_in_progress = false;
+}
+
 void common_hal_displayio_release_displays(void) {
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
-        mp_const_obj_t bus_type = displays[i].fourwire_bus.base.type;
+        mp_const_obj_t bus_type = displays[i].bus_base.type;
         if (bus_type == NULL) {
             continue;
+        #if CIRCUITPY_BUSIO
         } else if (bus_type == &displayio_fourwire_type) {
             common_hal_displayio_fourwire_deinit(&displays[i].fourwire_bus);
+        #endif
+        #if CIRCUITPY_DIGITALIO
         } else if (bus_type == &displayio_parallelbus_type) {
             common_hal_displayio_parallelbus_deinit(&displays[i].parallel_bus);
+        #endif
+        #if CIRCUITPY_DISPLAYIO_MEMORYBUS
+        } else if (bus_type == &displayio_memorybus_type) {
+            common_hal_displayio_memorybus_deinit(&displays[i].memory_bus);
+        #endif
         }
-        displays[i].fourwire_bus.base.type = &mp_type_NoneType;
+        displays[i].bus_base.type = &mp_type_NoneType;
     }
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         release_display(&displays[i].display);
@@ -193,6 +371,7 @@ void common_hal_displayio_release_displays(void) {
 
 void reset_displays(void) {
     #if CIRCUITPY_DISPLAYIO
+    #if CIRCUITPY_BUSIO
     // The SPI buses used by FourWires may be allocated on the heap so we need to move them inline.
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         if (displays[i].fourwire_bus.base.type != &displayio_fourwire_type) {
@@ -220,6 +399,7 @@ void reset_displays(void) {
             }
         }
     }
+    #endif
 
     for (uint8_t i = 0; i < CIRCUITPY_DISPLAY_LIMIT; i++) {
         if (displays[i].display.base.type == NULL) {
@@ -285,3 +465,81 @@ bool displayio_area_equal(const displayio_area_t* a, const displayio_area_t* b)
            a->x2 == b->x2 &&
            a->y2 == b->y2;
 }
+
+bool displayio_area_empty(const displayio_area_t* a) {
+    return a->x1 >= a->x2 || a->y1 >= a->y2;
+}
+
+void displayio_area_copy(const displayio_area_t* src, displayio_area_t* dst) {
+    dst->x1 = src->x1;
+    dst->y1 = src->y1;
+    dst->x2 = src->x2;
+    dst->y2 = src->y2;
+}
+
+void displayio_area_scale(displayio_area_t* area, uint16_t scale) {
+    area->x1 *= scale;
+    area->y1 *= scale;
+    area->x2 *= scale;
+    area->y2 *= scale;
+}
+
+void displayio_area_expand(displayio_area_t* a, const displayio_area_t* b) {
+    if (displayio_area_empty(b)) {
+        return;
+    }
+    if (displayio_area_empty(a)) {
+        displayio_area_copy(b, a);
+        return;
+    }
+    if (b->x1 < a->x1) {
+        a->x1 = b->x1;
+    }
+    if (b->y1 < a->y1) {
+        a->y1 = b->y1;
+    }
+    if (b->x2 > a->x2) {
+        a->x2 = b->x2;
+    }
+    if (b->y2 > a->y2) {
+        a->y2 = b->y2;
+    }
+}
+
+void displayio_area_list_add(displayio_area_list_t* list, const displayio_area_t* area,
+                             int16_t x, int16_t y, uint16_t scale) {
+    displayio_area_t added;
+    displayio_area_copy(area, &added);
+    displayio_area_scale(&added, scale);
+    displayio_area_shift(&added, x, y);
+    if (displayio_area_empty(&added)) {
+        return;
+    }
+
+    // Merge with an existing area when the union costs no more pixels than drawing both. This
+    // also drops areas that are already covered.
+    uint8_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for (uint8_t i = 0; i < list->count; i++) {
+        displayio_area_t merged;
+        displayio_area_copy(&list->areas[i], &merged);
+        displayio_area_expand(&merged, &added);
+        uint32_t merged_size = displayio_area_size(&merged);
+        if (merged_size <= displayio_area_size(&list->areas[i]) + displayio_area_size(&added)) {
+            displayio_area_copy(&merged, &list->areas[i]);
+            return;
+        }
+        uint32_t growth = merged_size - displayio_area_size(&list->areas[i]);
+        if (growth < best_growth) {
+            best = i;
+            best_growth = growth;
+        }
+    }
+    if (list->count < CIRCUITPY_DISPLAY_AREA_LIMIT) {
+        displayio_area_copy(&added, &list->areas[list->count]);
+        list->count++;
+        return;
+    }
+    // Out of room so grow whichever area needs the fewest extra pixels.
+    displayio_area_expand(&list->areas[best], &added);
+}
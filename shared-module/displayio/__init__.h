@@ -28,14 +28,29 @@
 #define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO___INIT___H
 
 #include "shared-bindings/displayio/Display.h"
-#include "shared-bindings/displayio/FourWire.h"
 #include "shared-bindings/displayio/Group.h"
+#if CIRCUITPY_BUSIO
+#include "shared-bindings/displayio/FourWire.h"
+#endif
+#if CIRCUITPY_DIGITALIO
 #include "shared-bindings/displayio/ParallelBus.h"
+#endif
+#if CIRCUITPY_DISPLAYIO_MEMORYBUS
+#include "shared-bindings/displayio/MemoryBus.h"
+#endif
 
 typedef struct {
     union {
+        mp_obj_base_t bus_base;
+        #if CIRCUITPY_BUSIO
         displayio_fourwire_obj_t fourwire_bus;
+        #endif
+        #if CIRCUITPY_DIGITALIO
         displayio_parallelbus_obj_t parallel_bus;
+        #endif
+        #if CIRCUITPY_DISPLAYIO_MEMORYBUS
+        displayio_memorybus_obj_t memory_bus;
+        #endif
     };
     displayio_display_obj_t display;
 } primary_display_t;
@@ -45,6 +60,9 @@ extern primary_display_t displays[CIRCUITPY_DISPLAY_LIMIT];
 extern displayio_group_t circuitpython_splash;
 
 void displayio_refresh_displays(void);
+// Draws everything that has changed on the given display now, regardless of its frame rate and
+// time budget.
+void displayio_refresh_display(displayio_display_obj_t* display);
 void reset_displays(void);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO___INIT___H
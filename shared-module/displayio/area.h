@@ -27,6 +27,11 @@
 #ifndef MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 #define MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+
 // Implementations are in __init__.c
 
 typedef struct {
@@ -45,6 +50,13 @@ typedef struct {
     bool transpose_xy;
 } displayio_buffer_transform_t;
 
+// Bounded set of areas that need to be redrawn. Once it is full, new areas are merged into the
+// existing area that grows the least.
+typedef struct {
+    displayio_area_t areas[CIRCUITPY_DISPLAY_AREA_LIMIT];
+    uint8_t count;
+} displayio_area_list_t;
+
 void displayio_area_shift(displayio_area_t* area, int16_t dx, int16_t dy);
 bool displayio_area_compute_overlap(const displayio_area_t* a,
                                     const displayio_area_t* b,
@@ -53,5 +65,14 @@ uint16_t displayio_area_width(const displayio_area_t* area);
 uint16_t displayio_area_height(const displayio_area_t* area);
 uint32_t displayio_area_size(const displayio_area_t* area);
 bool displayio_area_equal(const displayio_area_t* a, const displayio_area_t* b);
+bool displayio_area_empty(const displayio_area_t* a);
+void displayio_area_copy(const displayio_area_t* src, displayio_area_t* dst);
+void displayio_area_scale(displayio_area_t* area, uint16_t scale);
+// Unions b into a. Empty areas are ignored.
+void displayio_area_expand(displayio_area_t* a, const displayio_area_t* b);
+
+// Scales area and then shifts it by x, y before adding it to the list.
+void displayio_area_list_add(displayio_area_list_t* list, const displayio_area_t* area,
+                             int16_t x, int16_t y, uint16_t scale);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_DISPLAYIO_AREA_H
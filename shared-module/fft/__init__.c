@@ -0,0 +1,460 @@
+/*
+ * This file is part of the MicroPython project, http://micropython.org/
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019 Scott Shawcroft for Adafruit Industries
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "shared-bindings/fft/__init__.h"
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+
+// sin(2 * pi * i / FFT_MAX_LENGTH) in Q31 for the first quarter turn. The rest of the turn is
+// found by symmetry.
+STATIC const int32_t quarter_sine[FFT_MAX_LENGTH / 4 + 1] = {
+    0, 6588387, 13176712, 19764913, 26352928, 32940695,
+    39528151, 46115236, 52701887, 59288042, 65873638, 72458615,
+    79042909, 85626460, 92209205, 98791081, 105372028, 111951983,
+    118530885, 125108670, 131685278, 138260647, 144834714, 151407418,
+    157978697, 164548489, 171116733, 177683365, 184248325, 190811551,
+    197372981, 203932553, 210490206, 217045878, 223599506, 230151030,
+    236700388, 243247518, 249792358, 256334847, 262874923, 269412525,
+    275947592, 282480061, 289009871, 295536961, 302061269, 308582734,
+    315101295, 321616889, 328129457, 334638936, 341145265, 347648383,
+    354148230, 360644742, 367137861, 373627523, 380113669, 386596237,
+    393075166, 399550396, 406021865, 412489512, 418953276, 425413098,
+    431868915, 438320667, 444768294, 451211734, 457650927, 464085813,
+    470516330, 476942419, 483364019, 489781069, 496193509, 502601279,
+    509004318, 515402566, 521795963, 528184449, 534567963, 540946445,
+    547319836, 553688076, 560051104, 566408860, 572761285, 579108320,
+    585449903, 591785976, 598116479, 604441352, 610760536, 617073971,
+    623381598, 629683357, 635979190, 642269036, 648552838, 654830535,
+    661102068, 667367379, 673626408, 679879097, 686125387, 692365218,
+    698598533, 704825272, 711045377, 717258790, 723465451, 729665303,
+    735858287, 742044345, 748223418, 754395449, 760560380, 766718151,
+    772868706, 779011986, 785147934, 791276492, 797397602, 803511207,
+    809617249, 815715670, 821806413, 827889422, 833964638, 840032004,
+    846091463, 852142959, 858186435, 864221832, 870249095, 876268167,
+    882278992, 888281512, 894275671, 900261413, 906238681, 912207419,
+    918167572, 924119082, 930061894, 935995952, 941921200, 947837582,
+    953745043, 959643527, 965532978, 971413342, 977284562, 983146583,
+    988999351, 994842810, 1000676905, 1006501581, 1012316784, 1018122458,
+    1023918550, 1029705004, 1035481766, 1041248781, 1047005996, 1052753357,
+    1058490808, 1064218296, 1069935768, 1075643169, 1081340445, 1087027544,
+    1092704411, 1098370993, 1104027237, 1109673089, 1115308496, 1120933406,
+    1126547765, 1132151521, 1137744621, 1143327011, 1148898640, 1154459456,
+    1160009405, 1165548435, 1171076495, 1176593533, 1182099496, 1187594332,
+    1193077991, 1198550419, 1204011567, 1209461382, 1214899813, 1220326809,
+    1225742318, 1231146291, 1236538675, 1241919421, 1247288478, 1252645794,
+    1257991320, 1263325005, 1268646800, 1273956653, 1279254516, 1284540337,
+    1289814068, 1295075659, 1300325060, 1305562222, 1310787095, 1315999631,
+    1321199781, 1326387494, 1331562723, 1336725419, 1341875533, 1347013017,
+    1352137822, 1357249901, 1362349204, 1367435685, 1372509294, 1377569986,
+    1382617710, 1387652422, 1392674072, 1397682613, 1402678000, 1407660183,
+    1412629117, 1417584755, 1422527051, 1427455956, 1432371426, 1437273414,
+    1442161874, 1447036760, 1451898025, 1456745625, 1461579514, 1466399645,
+    1471205974, 1475998456, 1480777044, 1485541696, 1490292364, 1495029006,
+    1499751576, 1504460029, 1509154322, 1513834411, 1518500250, 1523151797,
+    1527789007, 1532411837, 1537020244, 1541614183, 1546193612, 1550758488,
+    1555308768, 1559844408, 1564365367, 1568871601, 1573363068, 1577839726,
+    1582301533, 1586748447, 1591180426, 1595597428, 1599999411, 1604386335,
+    1608758157, 1613114838, 1617456335, 1621782608, 1626093616, 1630389319,
+    1634669676, 1638934646, 1643184191, 1647418269, 1651636841, 1655839867,
+    1660027308, 1664199124, 1668355276, 1672495725, 1676620432, 1680729357,
+    1684822463, 1688899711, 1692961062, 1697006479, 1701035922, 1705049355,
+    1709046739, 1713028037, 1716993211, 1720942225, 1724875040, 1728791620,
+    1732691928, 1736575927, 1740443581, 1744294853, 1748129707, 1751948107,
+    1755750017, 1759535401, 1763304224, 1767056450, 1770792044, 1774510970,
+    1778213194, 1781898681, 1785567396, 1789219305, 1792854372, 1796472565,
+    1800073849, 1803658189, 1807225553, 1810775906, 1814309216, 1817825449,
+    1821324572, 1824806552, 1828271356, 1831718951, 1835149306, 1838562388,
+    1841958164, 1845336604, 1848697674, 1852041343, 1855367581, 1858676355,
+    1861967634, 1865241388, 1868497586, 1871736196, 1874957189, 1878160535,
+    1881346202, 1884514161, 1887664383, 1890796837, 1893911494, 1897008325,
+    1900087301, 1903148392, 1906191570, 1909216806, 1912224073, 1915213340,
+    1918184581, 1921137767, 1924072871, 1926989864, 1929888720, 1932769411,
+    1935631910, 1938476190, 1941302225, 1944109987, 1946899451, 1949670589,
+    1952423377, 1955157788, 1957873796, 1960571375, 1963250501, 1965911148,
+    1968553292, 1971176906, 1973781967, 1976368450, 1978936331, 1981485585,
+    1984016189, 1986528118, 1989021350, 1991495860, 1993951625, 1996388622,
+    1998806829, 2001206222, 2003586779, 2005948478, 2008291295, 2010615210,
+    2012920201, 2015206245, 2017473321, 2019721407, 2021950484, 2024160529,
+    2026351522, 2028523442, 2030676269, 2032809982, 2034924562, 2037019988,
+    2039096241, 2041153301, 2043191150, 2045209767, 2047209133, 2049189231,
+    2051150040, 2053091544, 2055013723, 2056916560, 2058800036, 2060664133,
+    2062508835, 2064334124, 2066139983, 2067926394, 2069693342, 2071440808,
+    2073168777, 2074877233, 2076566160, 2078235540, 2079885360, 2081515603,
+    2083126254, 2084717298, 2086288720, 2087840505, 2089372638, 2090885105,
+    2092377892, 2093850985, 2095304370, 2096738032, 2098151960, 2099546139,
+    2100920556, 2102275199, 2103610054, 2104925109, 2106220352, 2107495770,
+    2108751352, 2109987085, 2111202959, 2112398960, 2113575080, 2114731305,
+    2115867626, 2116984031, 2118080511, 2119157054, 2120213651, 2121250292,
+    2122266967, 2123263666, 2124240380, 2125197100, 2126133817, 2127050522,
+    2127947206, 2128823862, 2129680480, 2130517052, 2131333572, 2132130030,
+    2132906420, 2133662734, 2134398966, 2135115107, 2135811153, 2136487095,
+    2137142927, 2137778644, 2138394240, 2138989708, 2139565043, 2140120240,
+    2140655293, 2141170197, 2141664948, 2142139541, 2142593971, 2143028234,
+    2143442326, 2143836244, 2144209982, 2144563539, 2144896910, 2145210092,
+    2145503083, 2145775880, 2146028480, 2146260881, 2146473080, 2146665076,
+    2146836866, 2146988450, 2147119825, 2147230991, 2147321946, 2147392690,
+    2147443222, 2147473542, 2147483647,
+};
+
+// sin(2 * pi * index / FFT_MAX_LENGTH) in Q31.
+STATIC int32_t sine(uint32_t index) {
+    const uint32_t quarter = FFT_MAX_LENGTH / 4;
+    index &= FFT_MAX_LENGTH - 1;
+    if (index <= quarter) {
+        return quarter_sine[index];
+    } else if (index <= 2 * quarter) {
+        return quarter_sine[2 * quarter - index];
+    } else if (index <= 3 * quarter) {
+        return -quarter_sine[index - 2 * quarter];
+    }
+    return -quarter_sine[4 * quarter - index];
+}
+
+STATIC int32_t cosine(uint32_t index) {
+    return sine(index + FFT_MAX_LENGTH / 4);
+}
+
+// Rounds Q31 to Q15. One turns into 32768 so Q15 values are kept in 32 bits.
+STATIC int32_t q15(int32_t value) {
+    return ((value >> 15) + 1) >> 1;
+}
+
+STATIC int16_t saturate(int32_t value) {
+    if (value > 32767) {
+        return 32767;
+    } else if (value < -32768) {
+        return -32768;
+    }
+    return value;
+}
+
+// True when count is an odd power of two, which leaves a radix 2 stage after the radix 4 ones.
+STATIC bool odd_power_of_two(uint32_t count) {
+    return (count & 0xaaaaaaaa) != 0;
+}
+
+STATIC void bit_reverse_q15(int16_t* data, uint32_t count) {
+    for (uint32_t i = 1, j = 0; i < count; i++) {
+        uint32_t bit = count >> 1;
+        for (; (j & bit) != 0; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            int16_t re = data[2 * i];
+            int16_t im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+}
+
+// In place complex FFT of count interleaved Q15 values. Each radix 4 stage scales by 1/4 and the
+// radix 2 stage by 1/2 so the result is the transform divided by count.
+//
+// After bit reversal each group of 4 * half values holds four transforms of half values. They are
+// of the inputs that are 0, 2, 1 and 3 modulo 4 within the group, in that order, and a radix 4
+// butterfly combines them.
+STATIC void fft_q15(int16_t* data, uint32_t count) {
+    bit_reverse_q15(data, count);
+
+    uint32_t half = 1;
+    if (odd_power_of_two(count)) {
+        for (uint32_t i = 0; i < 2 * count; i += 4) {
+            int32_t ar = data[i];
+            int32_t ai = data[i + 1];
+            int32_t br = data[i + 2];
+            int32_t bi = data[i + 3];
+            data[i] = (ar + br + 1) >> 1;
+            data[i + 1] = (ai + bi + 1) >> 1;
+            data[i + 2] = (ar - br + 1) >> 1;
+            data[i + 3] = (ai - bi + 1) >> 1;
+        }
+        half = 2;
+    }
+
+    for (; half < count; half *= 4) {
+        uint32_t step = FFT_MAX_LENGTH / (4 * half);
+        for (uint32_t j = 0; j < half; j++) {
+            // Twiddles are cos - i sin.
+            int32_t c1 = q15(cosine(j * step));
+            int32_t s1 = q15(sine(j * step));
+            int32_t c2 = q15(cosine(2 * j * step));
+            int32_t s2 = q15(sine(2 * j * step));
+            int32_t c3 = q15(cosine(3 * j * step));
+            int32_t s3 = q15(sine(3 * j * step));
+            for (uint32_t a = j; a < count; a += 4 * half) {
+                int16_t* p0 = data + 2 * a;
+                int16_t* p1 = p0 + 2 * half;
+                int16_t* p2 = p1 + 2 * half;
+                int16_t* p3 = p2 + 2 * half;
+                int32_t t1r = (p2[0] * c1 + p2[1] * s1) >> 15;
+                int32_t t1i = (p2[1] * c1 - p2[0] * s1) >> 15;
+                int32_t t2r = (p1[0] * c2 + p1[1] * s2) >> 15;
+                int32_t t2i = (p1[1] * c2 - p1[0] * s2) >> 15;
+                int32_t t3r = (p3[0] * c3 + p3[1] * s3) >> 15;
+                int32_t t3i = (p3[1] * c3 - p3[0] * s3) >> 15;
+                int32_t pr = p0[0] + t2r;
+                int32_t pi = p0[1] + t2i;
+                int32_t qr = p0[0] - t2r;
+                int32_t qi = p0[1] - t2i;
+                int32_t rr = t1r + t3r;
+                int32_t ri = t1i + t3i;
+                int32_t sr = t1r - t3r;
+                int32_t si = t1i - t3i;
+                p0[0] = saturate((pr + rr + 2) >> 2);
+                p0[1] = saturate((pi + ri + 2) >> 2);
+                p1[0] = saturate((qr + si + 2) >> 2);
+                p1[1] = saturate((qi - sr + 2) >> 2);
+                p2[0] = saturate((pr - rr + 2) >> 2);
+                p2[1] = saturate((pi - ri + 2) >> 2);
+                p3[0] = saturate((qr - si + 2) >> 2);
+                p3[1] = saturate((qi + sr + 2) >> 2);
+            }
+        }
+    }
+}
+
+// The real transform treats pairs of samples as complex values, transforms them at half the length
+// and then separates the transforms of the even and odd samples to combine them.
+void shared_modules_fft_rfft_q15(int16_t* data, uint32_t length) {
+    uint32_t count = length / 2;
+    fft_q15(data, count);
+
+    int32_t r0 = data[0];
+    int32_t i0 = data[1];
+    data[0] = saturate((r0 + i0 + 1) >> 1);
+    data[1] = saturate((r0 - i0 + 1) >> 1);
+
+    uint32_t step = FFT_MAX_LENGTH / length;
+    for (uint32_t k = 1; k <= count / 2; k++) {
+        int16_t* zk = data + 2 * k;
+        int16_t* zm = data + 2 * (count - k);
+        // Twice the even and odd transforms. The odd one is (di - i dr) / 2.
+        int32_t er = zk[0] + zm[0];
+        int32_t ei = zk[1] - zm[1];
+        int32_t dr = zk[0] - zm[0];
+        int32_t di = zk[1] + zm[1];
+        int32_t c = q15(cosine(k * step));
+        int32_t s = q15(sine(k * step));
+        // These can be 33 bits before the shift.
+        int32_t tr = ((int64_t) di * c - (int64_t) dr * s) >> 15;
+        int32_t ti = (-(int64_t) dr * c - (int64_t) di * s) >> 15;
+        zk[0] = saturate((er + tr + 2) >> 2);
+        zk[1] = saturate((ei + ti + 2) >> 2);
+        zm[0] = saturate((er - tr + 2) >> 2);
+        zm[1] = saturate((ti - ei + 2) >> 2);
+    }
+}
+
+void shared_modules_fft_window_q15(int16_t* data, uint32_t length, fft_window_t window) {
+    uint32_t step = FFT_MAX_LENGTH / length;
+    for (uint32_t n = 0; n < length; n++) {
+        int32_t c = q15(cosine(n * step));
+        int32_t w;
+        if (window == FFT_WINDOW_HANN) {
+            w = 16384 - (c >> 1);
+        } else if (window == FFT_WINDOW_HAMMING) {
+            // 0.54 and 0.46 in Q15.
+            w = 17695 - ((15073 * c) >> 15);
+        } else {
+            // 0.42, 0.5 and 0.08 in Q15.
+            int32_t c2 = q15(cosine(2 * n * step));
+            w = 13763 - (c >> 1) + ((2621 * c2) >> 15);
+        }
+        data[n] = (data[n] * w + 16384) >> 15;
+    }
+}
+
+STATIC uint32_t square_root(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+void shared_modules_fft_magnitude_q15(const int16_t* spectrum, int16_t* output, uint32_t length) {
+    int32_t first = spectrum[0];
+    output[0] = saturate(first < 0 ? -first : first);
+    for (uint32_t k = 1; k < length / 2; k++) {
+        int32_t re = spectrum[2 * k];
+        int32_t im = spectrum[2 * k + 1];
+        // Both parts can be -32768 so the sum only fits unsigned.
+        output[k] = saturate(square_root((uint32_t) (re * re) + (uint32_t) (im * im)));
+    }
+}
+
+#if CIRCUITPY_FFT_FLOAT
+STATIC float to_float(int32_t q31) {
+    return q31 * (1.0f / 2147483648.0f);
+}
+
+STATIC void bit_reverse_float(float* data, uint32_t count) {
+    for (uint32_t i = 1, j = 0; i < count; i++) {
+        uint32_t bit = count >> 1;
+        for (; (j & bit) != 0; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            float re = data[2 * i];
+            float im = data[2 * i + 1];
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+}
+
+// The same as fft_q15 without the scaling.
+STATIC void fft_float(float* data, uint32_t count) {
+    bit_reverse_float(data, count);
+
+    uint32_t half = 1;
+    if (odd_power_of_two(count)) {
+        for (uint32_t i = 0; i < 2 * count; i += 4) {
+            float ar = data[i];
+            float ai = data[i + 1];
+            data[i] = ar + data[i + 2];
+            data[i + 1] = ai + data[i + 3];
+            data[i + 2] = ar - data[i + 2];
+            data[i + 3] = ai - data[i + 3];
+        }
+        half = 2;
+    }
+
+    for (; half < count; half *= 4) {
+        uint32_t step = FFT_MAX_LENGTH / (4 * half);
+        for (uint32_t j = 0; j < half; j++) {
+            float c1 = to_float(cosine(j * step));
+            float s1 = to_float(sine(j * step));
+            float c2 = to_float(cosine(2 * j * step));
+            float s2 = to_float(sine(2 * j * step));
+            float c3 = to_float(cosine(3 * j * step));
+            float s3 = to_float(sine(3 * j * step));
+            for (uint32_t a = j; a < count; a += 4 * half) {
+                float* p0 = data + 2 * a;
+                float* p1 = p0 + 2 * half;
+                float* p2 = p1 + 2 * half;
+                float* p3 = p2 + 2 * half;
+                float t1r = p2[0] * c1 + p2[1] * s1;
+                float t1i = p2[1] * c1 - p2[0] * s1;
+                float t2r = p1[0] * c2 + p1[1] * s2;
+                float t2i = p1[1] * c2 - p1[0] * s2;
+                float t3r = p3[0] * c3 + p3[1] * s3;
+                float t3i = p3[1] * c3 - p3[0] * s3;
+                float pr = p0[0] + t2r;
+                float pi = p0[1] + t2i;
+                float qr = p0[0] - t2r;
+                float qi = p0[1] - t2i;
+                float rr = t1r + t3r;
+                float ri = t1i + t3i;
+                float sr = t1r - t3r;
+                float si = t1i - t3i;
+                p0[0] = pr + rr;
+                p0[1] = pi + ri;
+                p1[0] = qr + si;
+                p1[1] = qi - sr;
+                p2[0] = pr - rr;
+                p2[1] = pi - ri;
+                p3[0] = qr - si;
+                p3[1] = qi + sr;
+            }
+        }
+    }
+}
+
+void shared_modules_fft_rfft_float(float* data, uint32_t length) {
+    uint32_t count = length / 2;
+    fft_float(data, count);
+
+    float r0 = data[0];
+    float i0 = data[1];
+    data[0] = r0 + i0;
+    data[1] = r0 - i0;
+
+    uint32_t step = FFT_MAX_LENGTH / length;
+    for (uint32_t k = 1; k <= count / 2; k++) {
+        float* zk = data + 2 * k;
+        float* zm = data + 2 * (count - k);
+        float er = 0.5f * (zk[0] + zm[0]);
+        float ei = 0.5f * (zk[1] - zm[1]);
+        float dr = 0.5f * (zk[0] - zm[0]);
+        float di = 0.5f * (zk[1] + zm[1]);
+        float c = to_float(cosine(k * step));
+        float s = to_float(sine(k * step));
+        float tr = di * c - dr * s;
+        float ti = -dr * c - di * s;
+        zk[0] = er + tr;
+        zk[1] = ei + ti;
+        zm[0] = er - tr;
+        zm[1] = ti - ei;
+    }
+}
+
+void shared_modules_fft_window_float(float* data, uint32_t length, fft_window_t window) {
+    uint32_t step = FFT_MAX_LENGTH / length;
+    for (uint32_t n = 0; n < length; n++) {
+        float c = to_float(cosine(n * step));
+        float w;
+        if (window == FFT_WINDOW_HANN) {
+            w = 0.5f - 0.5f * c;
+        } else if (window == FFT_WINDOW_HAMMING) {
+            w = 0.54f - 0.46f * c;
+        } else {
+            w = 0.42f - 0.5f * c + 0.08f * to_float(cosine(2 * n * step));
+        }
+        data[n] *= w;
+    }
+}
+
+void shared_modules_fft_magnitude_float(const float* spectrum, float* output, uint32_t length) {
+    output[0] = fabsf(spectrum[0]);
+    for (uint32_t k = 1; k < length / 2; k++) {
+        float re = spectrum[2 * k];
+        float im = spectrum[2 * k + 1];
+        output[k] = sqrtf(re * re + im * im);
+    }
+}
+#endif
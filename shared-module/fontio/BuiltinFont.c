@@ -46,34 +46,53 @@ uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_
     if (codepoint >= 0x20 && codepoint <= 0x7e) {
         return codepoint - 0x20;
     }
-    // Do a linear search of the mapping for unicode.
-    const byte* j = self->unicode_characters;
-    uint8_t k = 0;
-    while (j < self->unicode_characters + self->unicode_characters_len) {
-        unichar potential_c = utf8_get_char(j);
-        j = utf8_next_char(j);
+    // Binary search the sorted codepoints of the unicode glyphs.
+    uint16_t low = 0;
+    uint16_t high = self->unicode_codepoint_count;
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        mp_uint_t potential_c = self->unicode_codepoints[middle];
         if (codepoint == potential_c) {
-            return 0x7f - 0x20 + k;
+            return 0x7f - 0x20 + middle;
+        } else if (codepoint > potential_c) {
+            low = middle + 1;
+        } else {
+            high = middle;
         }
-        k++;
     }
     return 0xff;
 }
 
-mp_obj_t common_hal_fontio_builtinfont_get_glyph(const fontio_builtinfont_t *self, mp_uint_t codepoint) {
+bool fontio_builtinfont_get_glyph_info(const fontio_builtinfont_t *self, mp_uint_t codepoint, fontio_glyph_info_t* glyph) {
     uint8_t glyph_index = fontio_builtinfont_get_glyph_index(self, codepoint);
     if (glyph_index == 0xff) {
+        return false;
+    }
+    glyph->bitmap = self->bitmap;
+    glyph->tile_index = glyph_index;
+    glyph->width = self->width;
+    glyph->height = self->height;
+    glyph->dx = 0;
+    glyph->dy = 0;
+    glyph->shift_x = self->width;
+    glyph->shift_y = 0;
+    return true;
+}
+
+mp_obj_t common_hal_fontio_builtinfont_get_glyph(const fontio_builtinfont_t *self, mp_uint_t codepoint) {
+    fontio_glyph_info_t glyph;
+    if (!fontio_builtinfont_get_glyph_info(self, codepoint, &glyph)) {
         return mp_const_none;
     }
     mp_obj_t field_values[8] = {
-        MP_OBJ_FROM_PTR(self->bitmap),
-        MP_OBJ_NEW_SMALL_INT(glyph_index),
-        MP_OBJ_NEW_SMALL_INT(self->width),
-        MP_OBJ_NEW_SMALL_INT(self->height),
-        MP_OBJ_NEW_SMALL_INT(0),
-        MP_OBJ_NEW_SMALL_INT(0),
-        MP_OBJ_NEW_SMALL_INT(self->width),
-        MP_OBJ_NEW_SMALL_INT(0)
+        MP_OBJ_FROM_PTR(glyph.bitmap),
+        MP_OBJ_NEW_SMALL_INT(glyph.tile_index),
+        MP_OBJ_NEW_SMALL_INT(glyph.width),
+        MP_OBJ_NEW_SMALL_INT(glyph.height),
+        MP_OBJ_NEW_SMALL_INT(glyph.dx),
+        MP_OBJ_NEW_SMALL_INT(glyph.dy),
+        MP_OBJ_NEW_SMALL_INT(glyph.shift_x),
+        MP_OBJ_NEW_SMALL_INT(glyph.shift_y)
     };
     return namedtuple_make_new((const mp_obj_type_t*) &fontio_glyph_type, 8, field_values, NULL);
 }
@@ -38,10 +38,27 @@ typedef struct {
     const displayio_bitmap_t* bitmap;
     uint8_t width;
     uint8_t height;
-    const byte* unicode_characters;
-    uint16_t unicode_characters_len;
+    // Codepoints of the glyphs after ASCII in ascending order. Their glyphs follow ASCII's in the
+    // bitmap in the same order.
+    const uint16_t* unicode_codepoints;
+    uint16_t unicode_codepoint_count;
 } fontio_builtinfont_t;
 
+// The fields of a fontio.Glyph for C code that doesn't need the object.
+typedef struct {
+    const displayio_bitmap_t* bitmap;
+    uint8_t tile_index;
+    uint8_t width;
+    uint8_t height;
+    int16_t dx;
+    int16_t dy;
+    int16_t shift_x;
+    int16_t shift_y;
+} fontio_glyph_info_t;
+
+// Returns the tile index of the codepoint's glyph in the bitmap or 0xff when there is none.
 uint8_t fontio_builtinfont_get_glyph_index(const fontio_builtinfont_t *self, mp_uint_t codepoint);
+// Fills in glyph without allocating. Returns false when the font has no glyph for the codepoint.
+bool fontio_builtinfont_get_glyph_info(const fontio_builtinfont_t *self, mp_uint_t codepoint, fontio_glyph_info_t* glyph);
 
 #endif // MICROPY_INCLUDED_SHARED_MODULE_FONTIO_BUILTINFONT_H
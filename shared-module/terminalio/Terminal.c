@@ -26,6 +26,8 @@
 
 #include "shared-module/terminalio/Terminal.h"
 
+#include <string.h>
+
 #include "shared-module/fontio/BuiltinFont.h"
 #include "shared-bindings/displayio/TileGrid.h"
 
@@ -38,17 +40,27 @@ void common_hal_terminalio_terminal_construct(terminalio_terminal_obj_t *self, d
 }
 
 size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, const byte *data, size_t len, int *errcode) {
+    displayio_tilegrid_t* grid = self->tilegrid;
+    uint8_t* tiles = displayio_tilegrid_get_tiles(grid);
+    if (tiles == NULL) {
+        return len;
+    }
+    uint16_t width = grid->width_in_tiles;
+    uint16_t height = grid->height_in_tiles;
+    // Tiles are written directly and the tiles changed on the cursor's row are marked once the
+    // cursor leaves the row or the write is done rather than one at a time.
+    uint16_t changed_x1 = width;
+    uint16_t changed_x2 = 0;
     const byte* i = data;
     uint16_t start_y = self->cursor_y;
     while (i < data + len) {
         unichar c = utf8_get_char(i);
         i = utf8_next_char(i);
+        uint8_t tile_index = 0xff;
         // Always handle ASCII.
         if (c < 128) {
             if (c >= 0x20 && c <= 0x7e) {
-                uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-                common_hal_displayio_tilegrid_set_tile(self->tilegrid, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
+                tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
             } else if (c == '\r') {
                 self->cursor_x = 0;
             } else if (c == '\n') {
@@ -62,9 +74,11 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 if (i[0] == '[') {
                     if (i[1] == 'K') {
                         // Clear the rest of the line.
-                        for (uint16_t j = self->cursor_x; j < self->tilegrid->width_in_tiles; j++) {
-                            common_hal_displayio_tilegrid_set_tile(self->tilegrid, j, self->cursor_y, 0);
+                        memset(tiles + self->cursor_y * width + self->cursor_x, 0, width - self->cursor_x);
+                        if (self->cursor_x < changed_x1) {
+                            changed_x1 = self->cursor_x;
                         }
+                        changed_x2 = width;
                         i += 2;
                     } else {
                         // Handle commands of the form \x1b[####D
@@ -91,29 +105,41 @@ size_t common_hal_terminalio_terminal_write(terminalio_terminal_obj_t *self, con
                 }
             }
         } else {
-            uint8_t tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
-            if (tile_index != 0xff) {
-                common_hal_displayio_tilegrid_set_tile(self->tilegrid, self->cursor_x, self->cursor_y, tile_index);
-                self->cursor_x++;
-
+            tile_index = fontio_builtinfont_get_glyph_index(self->font, c);
+        }
+        if (tile_index != 0xff) {
+            tiles[self->cursor_y * width + self->cursor_x] = tile_index;
+            if (self->cursor_x < changed_x1) {
+                changed_x1 = self->cursor_x;
+            }
+            if (self->cursor_x >= changed_x2) {
+                changed_x2 = self->cursor_x + 1;
             }
+            self->cursor_x++;
         }
-        if (self->cursor_x >= self->tilegrid->width_in_tiles) {
+        if (self->cursor_x >= width) {
             self->cursor_y++;
-            self->cursor_x %= self->tilegrid->width_in_tiles;
+            self->cursor_x %= width;
         }
-        if (self->cursor_y >= self->tilegrid->height_in_tiles) {
-            self->cursor_y %= self->tilegrid->height_in_tiles;
+        if (self->cursor_y >= height) {
+            self->cursor_y %= height;
         }
         if (self->cursor_y != start_y) {
-            // clear the new row
-            for (uint16_t j = 0; j < self->tilegrid->width_in_tiles; j++) {
-                common_hal_displayio_tilegrid_set_tile(self->tilegrid, j, self->cursor_y, 0);
-                start_y = self->cursor_y;
+            if (changed_x1 < changed_x2) {
+                displayio_tilegrid_mark_tiles_changed(grid, changed_x1, start_y, changed_x2, start_y + 1);
             }
-            common_hal_displayio_tilegrid_set_top_left(self->tilegrid, 0, (start_y + self->tilegrid->height_in_tiles + 1) % self->tilegrid->height_in_tiles);
+            // Clear the new row and scroll it to the bottom. It is marked as changed once we're
+            // done with it so that it is marked where it ends up.
+            memset(tiles + self->cursor_y * width, 0, width);
+            changed_x1 = 0;
+            changed_x2 = width;
+            start_y = self->cursor_y;
+            common_hal_displayio_tilegrid_set_top_left(grid, 0, (start_y + height + 1) % height);
         }
     }
+    if (changed_x1 < changed_x2) {
+        displayio_tilegrid_mark_tiles_changed(grid, changed_x1, start_y, changed_x2, start_y + 1);
+    }
     return i - data;
 }
 
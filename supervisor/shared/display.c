@@ -150,6 +150,7 @@ displayio_palette_t blinka_palette = {
     .opaque = blinka_transparency,
     .colors = blinka_colors,
     .color_count = 16,
+    .transparent_count = 1,
     .needs_refresh = false
 };
 
@@ -171,7 +172,7 @@ displayio_tilegrid_t blinka_sprite = {
     .top_left_x = 16,
     .top_left_y = 16,
     .tiles = 0,
-    .needs_refresh = false,
+    .full_change = false,
     .inline_tiles = true
 };
 
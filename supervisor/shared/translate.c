@@ -83,7 +83,9 @@ inline __attribute__((always_inline)) const compressed_string_t* translate(const
     #ifndef NO_QSTR
     #define QDEF(id, str)
     #define TRANSLATION(id, len, compressed...) if (strcmp(original, id) == 0) { static const compressed_string_t v = {.length = len, .data = compressed}; return &v; } else
+    #define QINDEX(...)
     #include "genhdr/qstrdefs.generated.h"
+    #undef QINDEX
     #undef TRANSLATION
     #undef QDEF
     #endif
@@ -0,0 +1,30 @@
+# Shared setup for the audioio benchmarks. Each scene plays a sample into a NullSink and times how
+# quickly the sink can pull its buffers.
+
+import utime
+import audioio
+
+SAMPLE_RATE = 16000
+SECONDS = 60
+
+
+def run(name, sample, channel_count, bits_per_sample, start=None, seconds=SECONDS):
+    sink = audioio.NullSink()
+    sink.play(sample, loop=True)
+    # Mixers stop their voices when they start playing so voices are started afterwards.
+    if start:
+        start()
+    frame_size = channel_count * bits_per_sample // 8
+    # Fill the first buffers before timing.
+    sink.skip(frame_size * 1024)
+    begin = utime.ticks_us()
+    received = sink.skip(frame_size * SAMPLE_RATE * seconds)
+    elapsed = utime.ticks_diff(utime.ticks_us(), begin)
+    report(name, received // frame_size, elapsed)
+
+
+def report(name, samples, elapsed):
+    # CPU time spent per second of output at SAMPLE_RATE.
+    cpu = elapsed * SAMPLE_RATE // samples
+    print("{}: {} samples per second, {} us per second of audio".format(
+        name, samples * 1000000 // elapsed, cpu))
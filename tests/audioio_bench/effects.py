@@ -0,0 +1,213 @@
+# Checks each audioio effect against a reference written in Python and then times it. The
+# references use floats for the filters, so the fixed point output only has to be within a couple
+# of LSB, and repeat the integer math of Echo and Limiter exactly. Timings are given in
+# nanoseconds per frame over the cost of playing the bare sample. Multiply by the clock in GHz for
+# cycles per frame.
+
+import array
+import math
+import audioio
+from audiobench import report, SAMPLE_RATE, SECONDS
+
+import utime
+
+LENGTH = 4000
+
+
+def make_data(channel_count, amplitude):
+    data = array.array("h", [0] * (LENGTH * channel_count))
+    seed = 1
+    for i in range(LENGTH):
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff
+        noise = (seed >> 16) / 32768 - 1
+        # Swell in and out so that the limiter has loud and quiet parts to work on.
+        swell = 0.25 + 0.75 * math.sin(math.pi * i / LENGTH)
+        for c in range(channel_count):
+            value = (math.sin(2 * math.pi * 220 * (c + 1) * i / SAMPLE_RATE) * 0.6 +
+                     math.sin(2 * math.pi * 3100 * i / SAMPLE_RATE) * 0.2 + noise * 0.2)
+            data[i * channel_count + c] = int(value * swell * amplitude)
+    return data
+
+
+def make_sample(data, channel_count):
+    return audioio.RawSample(data, sample_rate=SAMPLE_RATE, channel_count=channel_count)
+
+
+def render(effect, count, typecode="h"):
+    sink = audioio.NullSink()
+    sink.play(effect)
+    out = array.array(typecode, [0] * count)
+    received = sink.readinto(out)
+    return out[:received // (2 if typecode == "h" else 1)]
+
+
+def saturate(value):
+    return max(-32768, min(32767, value))
+
+
+def biquad_coefficients(mode, frequency, q, gain):
+    w0 = 2 * math.pi * frequency / SAMPLE_RATE
+    cos_w0 = math.cos(w0)
+    alpha = math.sin(w0) / (2 * q)
+    a = 10 ** (gain / 40)
+    shelf = 2 * math.sqrt(a) * alpha
+    if mode == audioio.Biquad.LOWPASS:
+        b = ((1 - cos_w0) / 2, 1 - cos_w0, (1 - cos_w0) / 2)
+        d = (1 + alpha, -2 * cos_w0, 1 - alpha)
+    elif mode == audioio.Biquad.HIGHPASS:
+        b = ((1 + cos_w0) / 2, -(1 + cos_w0), (1 + cos_w0) / 2)
+        d = (1 + alpha, -2 * cos_w0, 1 - alpha)
+    elif mode == audioio.Biquad.BANDPASS:
+        b = (alpha, 0, -alpha)
+        d = (1 + alpha, -2 * cos_w0, 1 - alpha)
+    elif mode == audioio.Biquad.LOWSHELF:
+        b = (a * ((a + 1) - (a - 1) * cos_w0 + shelf), 2 * a * ((a - 1) - (a + 1) * cos_w0),
+             a * ((a + 1) - (a - 1) * cos_w0 - shelf))
+        d = ((a + 1) + (a - 1) * cos_w0 + shelf, -2 * ((a - 1) + (a + 1) * cos_w0),
+             (a + 1) + (a - 1) * cos_w0 - shelf)
+    else:
+        b = (a * ((a + 1) + (a - 1) * cos_w0 + shelf), -2 * a * ((a - 1) + (a + 1) * cos_w0),
+             a * ((a + 1) + (a - 1) * cos_w0 - shelf))
+        d = ((a + 1) - (a - 1) * cos_w0 + shelf, 2 * ((a - 1) - (a + 1) * cos_w0),
+             (a + 1) - (a - 1) * cos_w0 - shelf)
+    return [x / d[0] for x in b + d[1:]]
+
+
+def biquad_reference(data, channel_count, mode, frequency, q=0.7071, gain=0.0):
+    b0, b1, b2, a1, a2 = biquad_coefficients(mode, frequency, q, gain)
+    out = array.array("h", data)
+    for c in range(channel_count):
+        x1 = x2 = y1 = y2 = 0.0
+        for i in range(c, len(data), channel_count):
+            x0 = data[i]
+            y0 = b0 * x0 + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2
+            x2, x1, y2, y1 = x1, x0, y1, y0
+            out[i] = saturate(round(y0))
+    return out
+
+
+def one_pole_reference(data, channel_count, frequency, highpass=False):
+    k = 1 - math.exp(-2 * math.pi * frequency / SAMPLE_RATE)
+    out = array.array("h", data)
+    for c in range(channel_count):
+        level = 0.0
+        for i in range(c, len(data), channel_count):
+            level += (data[i] - level) * k
+            out[i] = saturate(round(data[i] - level if highpass else level))
+    return out
+
+
+def echo_reference(data, channel_count, delay, feedback=0.5, mix=0.5):
+    feedback = int(feedback * 32768 + 0.5)
+    mix = int(mix * 32768 + 0.5)
+    line = [0] * (int(delay * SAMPLE_RATE + 0.5) * channel_count)
+    out = array.array("h", data)
+    position = 0
+    for i in range(len(data)):
+        delayed = line[position]
+        out[i] = saturate(data[i] + ((delayed * mix) >> 15))
+        line[position] = saturate(data[i] + ((delayed * feedback) >> 15))
+        position = (position + 1) % len(line)
+    return out
+
+
+def limiter_reference(data, channel_count, threshold=0.9, release=0.1):
+    block = 16
+    threshold = int(threshold * 32767 + 0.5)
+    release = int((1 - math.exp(-block / (release * SAMPLE_RATE))) * 65536 + 0.5)
+    gain = 32768
+    out = array.array("h", data)
+    for start in range(0, len(data), block * channel_count):
+        chunk = data[start:start + block * channel_count]
+        peak = max(abs(x) for x in chunk)
+        target = (threshold << 15) // peak if peak > threshold else 32768
+        if target <= gain:
+            gain = target
+            step = 0
+        else:
+            step = ((target - gain) * release + 0xffff) >> 16
+        frames = len(chunk) // channel_count
+        for i in range(frames):
+            g = gain + ((step * i) >> 4)
+            for c in range(channel_count):
+                out[start + i * channel_count + c] = (chunk[i * channel_count + c] * g) >> 15
+        gain += (step * frames) >> 4
+    return out
+
+
+def check(name, effect, expected, tolerance):
+    out = render(effect, len(expected))
+    if len(out) != len(expected):
+        raise AssertionError("{}: {} samples instead of {}".format(name, len(out), len(expected)))
+    error = max(abs(out[i] - expected[i]) for i in range(len(out)))
+    print("{}: max error {} LSB".format(name, error))
+    if error > tolerance:
+        raise AssertionError("{}: off by more than {} LSB".format(name, tolerance))
+
+
+MODES = (("lowpass", audioio.Biquad.LOWPASS, 1000, 0.7071, 0),
+         ("highpass", audioio.Biquad.HIGHPASS, 300, 0.7071, 0),
+         ("bandpass", audioio.Biquad.BANDPASS, 1000, 2.0, 0),
+         ("low shelf", audioio.Biquad.LOWSHELF, 200, 0.7071, 6),
+         ("high shelf", audioio.Biquad.HIGHSHELF, 4000, 0.7071, -6),
+         ("lowpass at 50 Hz", audioio.Biquad.LOWPASS, 50, 0.7071, 0))
+
+for channel_count in (1, 2):
+    data = make_data(channel_count, 20000)
+    sample = make_sample(data, channel_count)
+    prefix = "{} channel".format(channel_count)
+    for name, mode, frequency, q, gain in MODES:
+        effect = audioio.Biquad(sample, mode=mode, frequency=frequency, q=q, gain=gain)
+        check("{} biquad {}".format(prefix, name), effect,
+              biquad_reference(data, channel_count, mode, frequency, q, gain), 2)
+    check(prefix + " one pole lowpass", audioio.OnePole(sample, frequency=500),
+          one_pole_reference(data, channel_count, 500), 1)
+    check(prefix + " one pole highpass", audioio.OnePole(sample, frequency=100, highpass=True),
+          one_pole_reference(data, channel_count, 100, True), 1)
+    check(prefix + " echo", audioio.Echo(sample, delay=0.01, feedback=0.6, mix=0.7),
+          echo_reference(data, channel_count, 0.01, 0.6, 0.7), 0)
+    loud = make_data(channel_count, 32767)
+    loud_sample = make_sample(loud, channel_count)
+    limiter = audioio.Limiter(loud_sample, threshold=0.5, release=0.02)
+    check(prefix + " limiter", limiter, limiter_reference(loud, channel_count, 0.5, 0.02), 0)
+    out = render(audioio.Limiter(loud_sample, threshold=0.5), len(loud))
+    if max(abs(x) for x in out) > 16384:
+        raise AssertionError(prefix + " limiter went over its threshold")
+
+# 8 bit unsigned samples are filtered at 16 bits and rounded back to 8 bits.
+data = make_data(1, 20000)
+bytes_data = array.array("B", [((x >> 8) + 128) for x in data])
+expected = biquad_reference(array.array("h", [(x >> 8) << 8 for x in data]), 1,
+                            audioio.Biquad.LOWPASS, 1000)
+out = render(audioio.Biquad(make_sample(bytes_data, 1), frequency=1000), LENGTH, "B")
+error = max(abs(out[i] - (min(127, (expected[i] + 0x80) >> 8) + 128)) for i in range(LENGTH))
+print("8 bit biquad lowpass: max error {} LSB".format(error))
+if error > 1:
+    raise AssertionError("8 bit biquad lowpass: off by more than 1 LSB")
+
+
+def cost(name, sample, channel_count, baseline):
+    sink = audioio.NullSink()
+    sink.play(sample, loop=True)
+    frame_size = channel_count * 2
+    sink.skip(frame_size * 1024)
+    begin = utime.ticks_us()
+    received = sink.skip(frame_size * SAMPLE_RATE * SECONDS) // frame_size
+    elapsed = utime.ticks_diff(utime.ticks_us(), begin)
+    report(name, received, elapsed)
+    if baseline is not None:
+        print("  {:.1f} ns per frame".format((elapsed - baseline) * 1000 / received))
+    return elapsed
+
+
+for channel_count in (1, 2):
+    data = make_data(channel_count, 20000)
+    sample = make_sample(data, channel_count)
+    prefix = "{} channel".format(channel_count)
+    baseline = cost(prefix + " bare sample", sample, channel_count, None)
+    cost(prefix + " biquad", audioio.Biquad(sample, frequency=1000), channel_count, baseline)
+    cost(prefix + " one pole", audioio.OnePole(sample, frequency=1000), channel_count, baseline)
+    cost(prefix + " echo", audioio.Echo(sample, delay=0.25), channel_count, baseline)
+    cost(prefix + " limiter", audioio.Limiter(sample, threshold=0.5), channel_count, baseline)
+    chain = audioio.Limiter(audioio.Echo(audioio.Biquad(sample, frequency=1000), delay=0.25))
+    cost(prefix + " biquad, echo and limiter", chain, channel_count, baseline)
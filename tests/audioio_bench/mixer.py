@@ -0,0 +1,84 @@
+# Mixes looping RawSamples on 1, 2, 4 and 8 voices at full level and again scaled and panned. Each
+# voice's sample has a different length so that voices reload at different points in the buffer.
+# Before timing, the mixed output is checked against the expected levels, pans and sums.
+
+import array
+import audioio
+from audiobench import run, SAMPLE_RATE
+
+VOICES = (1, 2, 4, 8)
+CHECK_LENGTH = 4000
+
+
+def make_sample(typecode, length, amplitude, offset, channel_count):
+    data = array.array(typecode, [0] * length)
+    for i in range(length):
+        data[i] = (i * 37) % (2 * amplitude + 1) - amplitude + offset
+    return audioio.RawSample(data, sample_rate=SAMPLE_RATE, channel_count=channel_count)
+
+
+def mix(samples, typecode, bits_per_sample, samples_signed, channel_count, level=1.0, pan=0.0):
+    mixer = audioio.Mixer(voice_count=len(samples), sample_rate=SAMPLE_RATE,
+                          channel_count=channel_count, bits_per_sample=bits_per_sample,
+                          samples_signed=samples_signed)
+    sink = audioio.NullSink()
+    sink.play(mixer)
+    for v, sample in enumerate(samples):
+        mixer.play(sample, voice=v, loop=True, level=level, pan=pan)
+    out = array.array(typecode, [0] * (CHECK_LENGTH * channel_count))
+    sink.readinto(out)
+    return out
+
+
+def expect(name, out, expected):
+    errors = sum(1 for i in range(len(out)) if out[i] != expected(i))
+    print("{}: {} samples off".format(name, errors))
+    if errors:
+        raise AssertionError(name + " doesn't match")
+
+
+def saturate(value, low, high):
+    return max(low, min(high, value))
+
+
+# Half level panned halfway right keeps half of the right channel and a quarter of the left.
+constant = array.array("h", [10000] * 400)
+out = mix([audioio.RawSample(constant, sample_rate=SAMPLE_RATE, channel_count=2)], "h", 16, True,
+          2, level=0.5, pan=0.5)
+expect("level 0.5 pan 0.5", out, lambda i: 5000 if i & 1 else 2500)
+
+# At unity the mix is the saturated sum of the voices, as it was before levels and pans.
+lengths = (1000, 1244)
+data = [array.array("h", [(i * 37) % 40001 - 20000 for i in range(length)]) for length in lengths]
+out = mix([audioio.RawSample(d, sample_rate=SAMPLE_RATE, channel_count=2) for d in data], "h", 16,
+          True, 2)
+expect("16 bit signed stereo two voice unity", out,
+       lambda i: saturate(sum(d[i % len(d)] for d in data), -32768, 32767))
+
+# Unsigned 8 bit voices add around the 128 midpoint and clamp at both ends.
+data = [array.array("B", [(i * 37) % 256 for i in range(length)]) for length in lengths]
+out = mix([audioio.RawSample(d, sample_rate=SAMPLE_RATE) for d in data], "B", 8, False, 1)
+expect("8 bit unsigned mono two voice sum", out,
+       lambda i: saturate(sum(d[i % len(d)] - 128 for d in data), -128, 127) + 128)
+
+
+def scene(name, typecode, bits_per_sample, samples_signed, channel_count, amplitude, offset):
+    for voice_count in VOICES:
+        samples = [make_sample(typecode, 1000 + 122 * v, amplitude, offset, channel_count)
+                   for v in range(voice_count)]
+        for level, pan in ((1.0, 0.0), (0.5, 0.25)):
+            mixer = audioio.Mixer(voice_count=voice_count, sample_rate=SAMPLE_RATE,
+                                  channel_count=channel_count, bits_per_sample=bits_per_sample,
+                                  samples_signed=samples_signed)
+
+            def start():
+                for v in range(voice_count):
+                    mixer.play(samples[v], voice=v, loop=True, level=level, pan=pan)
+
+            label = "unity" if level == 1.0 else "scaled"
+            run("{} {} voices {}".format(name, voice_count, label), mixer, channel_count,
+                bits_per_sample, start)
+
+
+scene("16 bit signed stereo", "h", 16, True, 2, 8000, 0)
+scene("8 bit unsigned mono", "B", 8, False, 1, 30, 128)
@@ -0,0 +1,137 @@
+# Checks audiobusio.PDMDecimator, which runs PDMIn's filters, on tones turned into PDM by a second
+# order sigma-delta modulator written in Python. The level, noise and aliasing of each tone are
+# measured by projecting the output onto the tone. Then times the decimation at each oversampling
+# ratio.
+
+import array
+import math
+import audiobusio
+from audiobench import report, SAMPLE_RATE, SECONDS
+
+import utime
+
+# Samples skipped while the filters settle and then measured. A multiple of 16 so that every tone
+# below has whole cycles in it.
+SETTLE = 32
+LENGTH = 512
+
+
+def modulate(frequency, amplitude, oversample, count):
+    pdm = bytearray(count * oversample // 8)
+    step = 2 * math.pi * frequency / (SAMPLE_RATE * oversample)
+    integrator1 = integrator2 = 0.0
+    feedback = 1.0
+    bit = 0
+    for i in range(len(pdm)):
+        byte = 0
+        for j in range(8):
+            x = amplitude * math.sin(step * bit)
+            bit += 1
+            integrator1 += x - feedback
+            integrator2 += integrator1 - feedback
+            feedback = 1.0 if integrator2 >= 0 else -1.0
+            byte = (byte << 1) | (feedback > 0)
+        pdm[i] = byte
+    return pdm
+
+
+def decimate(pdm, oversample, bit_depth=16, pieces=None):
+    decimator = audiobusio.PDMDecimator(oversample=oversample, bit_depth=bit_depth,
+                                        buffer_size=len(pdm))
+    if pieces:
+        start = 0
+        while start < len(pdm):
+            decimator.write(pdm[start:start + pieces])
+            start += pieces
+    else:
+        decimator.write(pdm)
+    out = array.array("H" if bit_depth == 16 else "B", [0] * (len(pdm) * 8 // oversample))
+    received = decimator.readinto(out)
+    if received != len(out) * bit_depth // 8:
+        raise AssertionError("{} bytes instead of {}".format(received, len(out) * bit_depth // 8))
+    return out
+
+
+def measure(out, frequency):
+    # Level of the tone and of everything else, relative to full scale.
+    values = [x - 32768 for x in out[SETTLE:SETTLE + LENGTH]]
+    mean = sum(values) / LENGTH
+    step = 2 * math.pi * frequency / SAMPLE_RATE
+    a = sum(v * math.sin(step * i) for i, v in enumerate(values)) * 2 / LENGTH
+    b = sum(v * math.cos(step * i) for i, v in enumerate(values)) * 2 / LENGTH
+    noise = 0
+    for i, v in enumerate(values):
+        noise += (v - mean - a * math.sin(step * i) - b * math.cos(step * i)) ** 2
+    noise = math.sqrt(noise / LENGTH)
+    return math.sqrt(a * a + b * b) / 32768, max(noise, 0.5) / 32768
+
+
+def db(ratio):
+    return 20 * math.log(max(ratio, 1e-9)) / math.log(10)
+
+
+# Lowest signal to noise ratio accepted at each ratio. The modulator's noise rises 15dB for every
+# halving of the oversampling.
+MIN_SNR = ((16, 35), (32, 48), (64, 64), (128, 78), (256, 80))
+
+for oversample, min_snr in MIN_SNR:
+    prefix = "{}x".format(oversample)
+    pdm = modulate(1000, 0.5, oversample, SETTLE + LENGTH)
+    out = decimate(pdm, oversample)
+    level, noise = measure(out, 1000)
+    snr = db(level / math.sqrt(2) / noise)
+    print("{} 1 kHz at -6 dB: level {:.2f} dB, SNR {:.1f} dB".format(prefix, db(level), snr))
+    if abs(db(level / 0.5)) > 0.2:
+        raise AssertionError(prefix + " 1 kHz level is off")
+    if snr < min_snr:
+        raise AssertionError("{} SNR below {} dB".format(prefix, min_snr))
+
+    # Writing in odd sized pieces doesn't change the output.
+    if decimate(pdm, oversample, pieces=7) != out:
+        raise AssertionError(prefix + " output changed when written in pieces")
+    # 8 bit samples are the top of the 16 bit ones.
+    if decimate(pdm, oversample, 8) != array.array("B", [x >> 8 for x in out]):
+        raise AssertionError(prefix + " 8 bit output isn't the top of the 16 bit output")
+
+for oversample in (32, 64):
+    prefix = "{}x".format(oversample)
+    # Near the top of the passband.
+    level, noise = measure(decimate(modulate(6000, 0.5, oversample, SETTLE + LENGTH), oversample),
+                           6000)
+    print("{} 6 kHz: level {:.2f} dB".format(prefix, db(level / 0.5)))
+    if abs(db(level / 0.5)) > 0.5:
+        raise AssertionError(prefix + " 6 kHz level is off")
+    # 11 kHz would alias to 5 kHz.
+    out = decimate(modulate(11000, 0.5, oversample, SETTLE + LENGTH), oversample)
+    level, noise = measure(out, 5000)
+    print("{} 11 kHz aliased to 5 kHz: level {:.1f} dB".format(prefix, db(level / 0.5)))
+    if db(level / 0.5) > -50:
+        raise AssertionError(prefix + " 11 kHz isn't removed")
+
+# Samples that don't fit are dropped and counted. Reading makes room for more.
+decimator = audiobusio.PDMDecimator(buffer_size=60)
+silence = b"\x55" * 800
+decimator.write(silence)
+if decimator.in_waiting != 64 or decimator.overruns != 68:
+    raise AssertionError("{} bytes waiting and {} overruns".format(decimator.in_waiting,
+                                                                    decimator.overruns))
+if decimator.read(10) != b"\x00\x80" * 5:
+    raise AssertionError("silence didn't decimate to the middle of the range")
+decimator.write(silence[:40])
+if decimator.in_waiting != 64 or decimator.overruns != 68:
+    raise AssertionError("written samples weren't added after a read")
+if len(decimator.read()) != 64 or decimator.readinto(bytearray(2)) is not None:
+    raise AssertionError("samples were left after reading them all")
+print("overruns: ok")
+
+for oversample in (16, 32, 64, 128, 256):
+    decimator = audiobusio.PDMDecimator(oversample=oversample, buffer_size=1024)
+    pdm = bytes(modulate(1000, 0.5, oversample, 512))
+    out = bytearray(1024)
+    total = 0
+    begin = utime.ticks_us()
+    while total < SAMPLE_RATE * SECONDS:
+        decimator.write(pdm)
+        total += decimator.readinto(out) // 2
+    elapsed = utime.ticks_diff(utime.ticks_us(), begin)
+    report("{}x decimation".format(oversample), total, elapsed)
@@ -0,0 +1,83 @@
+# Converts looping RawSamples from common rates to the benchmark rate with each Resampler quality.
+# Before timing, it checks the quality of each kind of resampling against a pure tone.
+
+import array
+import math
+import audioio
+from audiobench import run, SAMPLE_RATE
+
+LENGTH = 2000
+QUALITIES = (("linear", audioio.Resampler.LINEAR), ("fir", audioio.Resampler.FIR))
+AMPLITUDE = 16000
+
+
+def tone(frequency, rate, length):
+    return array.array("h", [int(math.sin(2 * math.pi * frequency * i / rate) * AMPLITUDE)
+                             for i in range(length)])
+
+
+def resample(data, rate, output_rate, quality, typecode="h"):
+    resampler = audioio.Resampler(audioio.RawSample(data, sample_rate=rate),
+                                  sample_rate=output_rate, quality=quality)
+    sink = audioio.NullSink()
+    sink.play(resampler)
+    out = array.array(typecode, [0] * (len(data) * output_rate // rate))
+    received = sink.readinto(out)
+    return out[:received // (2 if typecode == "h" else 1)]
+
+
+def decibels(ratio):
+    return 10 * math.log(ratio) / math.log(10)
+
+
+def check(name, value, limit):
+    print("{}: {:.1f} dB".format(name, value))
+    if value < limit:
+        raise AssertionError("{} below {} dB".format(name, limit))
+
+
+# Output frame n falls exactly on input time n * rate / output_rate, so an upsampled tone is
+# compared to the same tone computed at the output rate. The ends are skipped because the filter
+# runs into the silence before and after the sample there.
+for name, quality, snr in (("linear", audioio.Resampler.LINEAR, 35),
+                           ("fir", audioio.Resampler.FIR, 70)):
+    out = resample(tone(440, 8000, 4000), 8000, 22050, quality)
+    expected = tone(440, 22050, len(out))
+    signal = 0
+    noise = 0
+    for i in range(32, len(out) - 32):
+        signal += expected[i] * expected[i]
+        noise += (out[i] - expected[i]) ** 2
+    check("440 Hz from 8000 to 22050 Hz {} SNR".format(name), decibels(signal / noise), snr)
+
+# A tone above the output's Nyquist frequency should be filtered out rather than alias down.
+for name, quality, attenuation in (("linear", audioio.Resampler.LINEAR, 2),
+                                   ("fir", audioio.Resampler.FIR, 50)):
+    data = tone(14000, 44100, 8820)
+    out = resample(data, 44100, 16000, quality)
+    power_in = sum(x * x for x in data) / len(data)
+    power_out = sum(out[i] * out[i] for i in range(32, len(out) - 32)) / (len(out) - 64)
+    check("14 kHz from 44100 to 16000 Hz {} attenuation".format(name),
+          decibels(power_in / power_out), attenuation)
+
+# 8 bit output is rounded, so a constant level comes through unchanged.
+for name, quality in QUALITIES:
+    out = resample(array.array("B", [200] * 1000), 8000, 22050, quality, "B")
+    middle = out[32:len(out) - 32]
+    print("8 bit 200 from 8000 to 22050 Hz {}: {} to {}".format(name, min(middle), max(middle)))
+    if min(middle) != 200 or max(middle) != 200:
+        raise AssertionError("8 bit {} changed a constant level".format(name))
+
+
+def make_sample(rate, channel_count):
+    data = array.array("h", [0] * (LENGTH * channel_count))
+    for i in range(LENGTH * channel_count):
+        data[i] = int(math.sin(i * 0.05) * 16000)
+    return audioio.RawSample(data, sample_rate=rate, channel_count=channel_count)
+
+
+for rate, channel_count in ((8000, 1), (22050, 1), (44100, 2)):
+    sample = make_sample(rate, channel_count)
+    for name, quality in QUALITIES:
+        resampler = audioio.Resampler(sample, sample_rate=SAMPLE_RATE, quality=quality)
+        run("{} Hz {} channel {}".format(rate, channel_count, name), resampler, channel_count, 16)
@@ -0,0 +1,35 @@
+# Renders sustained notes on 1, 4 and 8 Synthesizer voices with the built in sine and with a
+# longer user waveform, and the same notes through a Mixer voice so the two paths can be compared.
+
+import array
+import audioio
+from audiobench import run, SAMPLE_RATE
+
+VOICES = (1, 4, 8)
+FREQUENCIES = (261.63, 329.63, 392.0, 493.88, 523.25, 659.25, 783.99, 987.77)
+
+saw = array.array("h", [0] * 1024)
+for i in range(len(saw)):
+    saw[i] = (i * 64) - 32768
+
+
+def notes(synth, voice_count):
+    def start():
+        for v in range(voice_count):
+            synth.note_on(FREQUENCIES[v], voice=v, level=1 / voice_count)
+    return start
+
+
+for voice_count in VOICES:
+    for name, waveform in (("sine", None), ("1024 sample saw", saw)):
+        synth = audioio.Synthesizer(voice_count=voice_count, sample_rate=SAMPLE_RATE,
+                                    waveform=waveform)
+        run("{} voices {}".format(voice_count, name), synth, 1, 16, notes(synth, voice_count))
+
+    synth = audioio.Synthesizer(voice_count=voice_count, sample_rate=SAMPLE_RATE)
+    mixer = audioio.Mixer(voice_count=1, sample_rate=SAMPLE_RATE, channel_count=1)
+
+    def start():
+        mixer.play(synth, level=0.5)
+        notes(synth, voice_count)()
+    run("{} voices sine through a mixer".format(voice_count), mixer, 1, 16, start)
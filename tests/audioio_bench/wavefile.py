@@ -0,0 +1,149 @@
+# Checks the decoders against known A-law, mu-law and IMA ADPCM vectors and then plays wave files in
+# each supported encoding from a FAT filesystem in RAM so that decoding cost can be compared with
+# the cost of reading PCM. Any bytes are valid compressed samples so the timed data is a fixed
+# pattern. PCM is also played with different buffer layouts from a contiguous and a
+# fragmented file to compare how often the block device is read and how often read ahead falls
+# behind.
+
+import array
+import ustruct as struct
+import uos
+import audioio
+from audiobench import run, SAMPLE_RATE
+
+
+class RAMBlockDevice:
+    SECTOR_SIZE = 512
+
+    def __init__(self, sectors):
+        self.data = bytearray(sectors * self.SECTOR_SIZE)
+        self.reads = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        start = n * self.SECTOR_SIZE
+        buf[:] = self.data[start:start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.SECTOR_SIZE
+        self.data[start:start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:  # sector count
+            return len(self.data) // self.SECTOR_SIZE
+        if op == 5:  # sector size
+            return self.SECTOR_SIZE
+
+
+def write_wave(vfs, name, audio_format, channel_count, bits_per_sample, block_align, extra, frames,
+               fragment=False):
+    if audio_format == 0x11:
+        frames_per_block = 1 + (block_align - 4 * channel_count) * 2 // channel_count
+        data_length = (frames + frames_per_block - 1) // frames_per_block * block_align
+    else:
+        data_length = frames * block_align
+    fmt = struct.pack("<HHIIHH", audio_format, channel_count, SAMPLE_RATE,
+                      SAMPLE_RATE * block_align, block_align, bits_per_sample) + extra
+    pattern = bytes(range(7, 256, 6)) * 4
+    # Growing another file at the same time interleaves the clusters of the two.
+    padding = vfs.open("padding.bin", "wb") if fragment else None
+    with vfs.open(name, "wb") as f:
+        f.write(b"RIFF" + struct.pack("<I", 20 + len(fmt) + data_length) + b"WAVEfmt ")
+        f.write(struct.pack("<I", len(fmt)) + fmt)
+        f.write(b"data" + struct.pack("<I", data_length))
+        for i in range(0, data_length, len(pattern)):
+            f.write(pattern[:data_length - i])
+            if padding:
+                f.flush()
+                padding.write(pattern)
+                padding.flush()
+    if padding:
+        padding.close()
+    return data_length
+
+
+def write_data(vfs, name, audio_format, channel_count, bits_per_sample, block_align, extra, data):
+    fmt = struct.pack("<HHIIHH", audio_format, channel_count, SAMPLE_RATE,
+                      SAMPLE_RATE * block_align, block_align, bits_per_sample) + extra
+    with vfs.open(name, "wb") as f:
+        f.write(b"RIFF" + struct.pack("<I", 20 + len(fmt) + len(data)) + b"WAVEfmt ")
+        f.write(struct.pack("<I", len(fmt)) + fmt)
+        f.write(b"data" + struct.pack("<I", len(data)) + data)
+
+
+def check_decode(name, audio_format, channel_count, bits_per_sample, block_align, extra, data,
+                 expected):
+    write_data(vfs, "check.wav", audio_format, channel_count, bits_per_sample, block_align, extra,
+               data)
+    with vfs.open("check.wav", "rb") as f:
+        sink = audioio.NullSink()
+        sink.play(audioio.WaveFile(f))
+        out = array.array("h", [0] * (len(expected) + 16))
+        received = sink.readinto(out) // 2
+    uos.VfsFat.remove(vfs, "check.wav")
+    out = list(out[:received])
+    print("{}: {} samples, {}".format(name, received, "match" if out == expected else "differ"))
+    if out != expected:
+        raise AssertionError("{} decoded to {} instead of {}".format(name, out, expected))
+
+
+def make_vfs():
+    uos.VfsFat.mkfs(bdev)
+    return uos.VfsFat(bdev)
+
+
+bdev = RAMBlockDevice(512)
+vfs = make_vfs()
+
+# Expected samples are from the G.711 and IMA ADPCM reference decoders.
+check_decode("mu-law", 0x07, 1, 8, 1, b"\x00\x00",
+             b"\x00\x0f\x10\x3c\x7e\x7f\x80\x8f\xa5\xe0\xfe\xff",
+             [-32124, -16764, -15996, -2364, -8, 0, 32124, 16764, 6652, 372, 8, 0])
+check_decode("a-law", 0x06, 1, 8, 1, b"\x00\x00",
+             b"\x00\x13\x2a\x55\x7f\x80\x93\xaa\xd5\xff\x34\xb4",
+             [-5504, -2880, -32256, -8, -848, 5504, 2880, 32256, 8, 848, -8960, 8960])
+# A full mono block of 17 frames followed by a final block cut short after three bytes of samples.
+check_decode("mono ima adpcm", 0x11, 1, 4, 12, struct.pack("<HH", 2, 17),
+             struct.pack("<hBB", -1000, 20, 0) + b"\x07\x7f\x70\x12\x9a\xbc\xf0\x0f" +
+             struct.pack("<hBB", 500, 60, 0) + b"\x88\x34\xe5",
+             [-1000, -907, -894, -1075, -684, -628, 137, 684, 982, 530, 284, -388, -1021, -939,
+              -2059, -4462, -4119, 500, 216, -42, 2070, 4058, 6898, 1984])
+# A stereo block that starts near both ends of the range so that the decoder has to clamp.
+check_decode("stereo ima adpcm", 0x11, 2, 4, 16, struct.pack("<HH", 2, 9),
+             struct.pack("<hBBhBB", 30000, 70, 0, -32000, 88, 0) + b"\x31\x42\xf7\x08" +
+             b"\x9c\xd5\x6e\x7f",
+             [30000, -32000, 32209, -32768, 32767, -32768, 32767, 8198, 32767, -32768, 32767,
+              -32768, 11231, 20477, 8154, -32768, 10952, 28668])
+
+# name, format, bits per sample in the file, bytes per block, extra format fields
+ENCODINGS = (
+    ("pcm", 0x01, 16, 2, b""),
+    ("mu-law", 0x07, 8, 1, b"\x00\x00"),
+    ("a-law", 0x06, 8, 1, b"\x00\x00"),
+    ("ima adpcm", 0x11, 4, 256, struct.pack("<HH", 2, 505)),
+)
+
+for channel_count in (1, 2):
+    for name, audio_format, bits, block_align, extra in ENCODINGS:
+        block_align *= channel_count
+        if audio_format == 0x11:
+            extra = struct.pack("<HH", 2, 1 + (block_align - 4 * channel_count) * 2 // channel_count)
+        length = write_wave(vfs, "bench.wav", audio_format, channel_count, bits, block_align, extra,
+                            SAMPLE_RATE)
+        with vfs.open("bench.wav", "rb") as f:
+            wave = audioio.WaveFile(f)
+            run("{} channel {}, {} bytes per second".format(channel_count, name, length), wave,
+                channel_count, 16)
+        uos.VfsFat.remove(vfs, "bench.wav")
+
+for fragment in (False, True):
+    vfs = make_vfs()
+    write_wave(vfs, "bench.wav", 0x01, 2, 16, 4, b"", SAMPLE_RATE, fragment=fragment)
+    for buffer_size, buffer_count in ((512, 2), (1536, 3), (4096, 4), (1024, 8)):
+        with vfs.open("bench.wav", "rb") as f:
+            wave = audioio.WaveFile(f, buffer_size=buffer_size, buffer_count=buffer_count)
+            reads = bdev.reads
+            run("2 channel pcm {}, {} buffers of {} bytes".format(
+                "fragmented" if fragment else "contiguous", buffer_count,
+                buffer_size // buffer_count), wave, 2, 16)
+            print("  {} block reads, {} underruns".format(bdev.reads - reads, wave.underruns))
@@ -0,0 +1,26 @@
+import bench
+import math
+
+
+def rfft(x):
+    # Textbook recursive radix 2 transform of the real samples as complex values.
+    n = len(x)
+    if n == 1:
+        return [complex(x[0])]
+    even = rfft(x[0::2])
+    odd = rfft(x[1::2])
+    out = [0] * n
+    for k in range(n // 2):
+        t = math.e ** (-2j * math.pi * k / n) * odd[k]
+        out[k] = even[k] + t
+        out[k + n // 2] = even[k] - t
+    return out
+
+
+def test(num):
+    samples = [int(16000 * math.sin(i / 3)) for i in range(256)]
+    for i in range(num // 20000):
+        rfft(samples)
+
+
+bench.run(test)
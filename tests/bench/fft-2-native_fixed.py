@@ -0,0 +1,15 @@
+import bench
+import array
+import math
+import fft
+
+
+def test(num):
+    samples = array.array('h', [int(16000 * math.sin(i / 3)) for i in range(256)])
+    buf = array.array('h', samples)
+    for i in range(num // 20000):
+        buf[:] = samples
+        fft.rfft(buf)
+
+
+bench.run(test)
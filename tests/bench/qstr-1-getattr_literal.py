@@ -0,0 +1,21 @@
+import bench
+
+
+class A:
+    pass
+
+
+def test(num):
+    # as many names as a large program interns
+    a = A()
+    for i in range(1000):
+        setattr(a, 'attr_%d' % i, i)
+    # literal names are interned when compiled so getattr doesn't look them up
+    for i in range(num // 40):
+        getattr(a, 'attr_1')
+        getattr(a, 'attr_500')
+        getattr(a, 'attr_999')
+        getattr(a, 'attr_0')
+
+
+bench.run(test)
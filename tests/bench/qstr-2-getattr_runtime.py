@@ -0,0 +1,22 @@
+import bench
+
+
+class A:
+    pass
+
+
+def test(num):
+    # as many names as a large program interns
+    a = A()
+    for i in range(1000):
+        setattr(a, 'attr_%d' % i, i)
+    # names built at runtime are looked up in the qstr pools on every getattr
+    n1, n2, n3, n4 = '1', '500', '999', '0'
+    for i in range(num // 40):
+        getattr(a, 'attr_' + n1)
+        getattr(a, 'attr_' + n2)
+        getattr(a, 'attr_' + n3)
+        getattr(a, 'attr_' + n4)
+
+
+bench.run(test)
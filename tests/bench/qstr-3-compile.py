@@ -0,0 +1,21 @@
+import bench
+
+# Compiling interns every name in the source, the same work as importing a module. Most of these
+# names are built in so they're found in the last pool searched.
+SOURCE = '\n'.join(['def function_%d(self, items):\n    for item in range(len(items)):\n        self.append(str(items[item]).format(key=min(item, %d)))' % (i, i) for i in range(50)])
+
+
+class A:
+    pass
+
+
+def test(num):
+    # as many names as a large program interns
+    a = A()
+    for i in range(2000):
+        setattr(a, 'attr_%d' % i, i)
+    for i in range(num // 100000):
+        compile(SOURCE, 'module.py', 'exec')
+
+
+bench.run(test)
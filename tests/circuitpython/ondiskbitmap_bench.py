@@ -0,0 +1,28 @@
+# Times full screen redraws of an OnDiskBitmap on a board with a built in display.
+#
+# Copy a BMP at least as large as the display to BMP_PATH. Each frame redraws every pixel so the
+# time per frame is dominated by reading and decoding the file.
+
+import board
+import displayio
+import time
+
+BMP_PATH = "/bench.bmp"
+FRAMES = 10
+
+display = board.DISPLAY
+splash = displayio.Group()
+
+with open(BMP_PATH, "rb") as f:
+    odb = displayio.OnDiskBitmap(f)
+    splash.append(displayio.TileGrid(odb, pixel_shader=displayio.ColorConverter()))
+    display.show(splash)
+    display.wait_for_frame()
+
+    start = time.monotonic()
+    for i in range(FRAMES):
+        display.refresh_soon()
+        display.wait_for_frame()
+    elapsed = time.monotonic() - start
+
+print("{}x{}: {:.1f} ms per frame".format(odb.width, odb.height, elapsed * 1000 / FRAMES))
@@ -0,0 +1,66 @@
+# Times common updates of a 600 pixel strip in _pixelbuf without sending the pixels anywhere.
+#
+# Brightness is below 1 so every write goes through the brightness table. At 60 Hz a frame has
+# 16.7 ms for the update and the write together.
+
+import _pixelbuf
+import time
+
+PIXELS = 600
+FRAMES = 20
+
+
+def bench(name, update, **kwargs):
+    buf = bytearray(PIXELS * 3)
+    pixels = _pixelbuf.PixelBuf(PIXELS, buf, byteorder=_pixelbuf.GRB, brightness=0.5, **kwargs)
+    start = time.monotonic()
+    for frame in range(FRAMES):
+        update(pixels, frame)
+        pixels.show()
+    elapsed = time.monotonic() - start
+    print("{}: {:.0f} us per frame".format(name, elapsed * 1000000 / FRAMES))
+
+
+def set_each(pixels, frame):
+    for i in range(PIXELS):
+        pixels[i] = frame << 16 | i
+
+
+def set_slice(pixels, frame):
+    pixels[0:PIXELS] = [frame << 16 | i for i in range(PIXELS)]
+
+
+colors = bytearray(PIXELS * 3)
+for i in range(len(colors)):
+    colors[i] = i & 0xff
+
+
+def set_bytes(pixels, frame):
+    pixels[0:PIXELS] = colors
+
+
+def fill(pixels, frame):
+    pixels.fill((frame, 0x20, 0x40))
+
+
+def rotate(pixels, frame):
+    pixels.rotate(1)
+
+
+def change_brightness(pixels, frame):
+    pixels.brightness = frame / FRAMES
+
+
+def read_back(pixels, frame):
+    pixels[0:PIXELS]
+
+
+bench("set each pixel", set_each)
+bench("set each pixel, deferred brightness", set_each, rawbuf=bytearray(PIXELS * 3),
+      defer_brightness=True)
+bench("set slice from list", set_slice)
+bench("set slice from bytes", set_bytes)
+bench("fill", fill)
+bench("rotate", rotate)
+bench("change brightness", change_brightness, rawbuf=bytearray(PIXELS * 3))
+bench("read slice", read_back)
@@ -0,0 +1,90 @@
+# Test that displayio only sends the areas that changed since the last refresh. Needs the unix port
+# built with "make displayio":
+#   MICROPY_MICROPYTHON=../ports/unix/micropython_displayio ./run-tests -d displayio
+
+try:
+    import displayio
+    displayio.MemoryBus
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 64
+HEIGHT = 48
+
+displayio.release_displays()
+bus = displayio.MemoryBus(width=WIDTH, height=HEIGHT)
+display = displayio.Display(bus, b"", width=WIDTH, height=HEIGHT)
+display.auto_refresh = False
+
+
+def sent(action=None):
+    if action:
+        action()
+    pixels = display.pixels_sent
+    bytes_sent = bus.bytes_sent
+    display.refresh()
+    return display.pixels_sent - pixels, bus.bytes_sent - bytes_sent
+
+
+def red_box():
+    # bounds of the red pixels in the framebuffer
+    xs = []
+    ys = []
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if bus[x, y] == 0xf800:
+                xs.append(x)
+                ys.append(y)
+    if not xs:
+        return None
+    return min(xs), min(ys), max(xs), max(ys)
+
+
+bitmap = displayio.Bitmap(8, 8, 2)
+for i in range(64):
+    bitmap[i] = 1
+palette = displayio.Palette(2)
+palette[0] = 0x000000
+palette[1] = 0xff0000
+sprite = displayio.TileGrid(bitmap, pixel_shader=palette, x=4, y=4)
+group = displayio.Group(max_size=4)
+group.append(sprite)
+
+# the first frame covers the whole screen
+print(sent(lambda: display.show(group)))
+print(red_box())
+
+# nothing changed
+print(sent())
+
+
+def move(x, y):
+    def action():
+        sprite.x = x
+        sprite.y = y
+    return action
+
+
+# overlapping moves send the union of the old and new 8x8 areas
+print(sent(move(8, 4)))
+print(red_box())
+print(sent(move(8, 6)))
+print(red_box())
+
+# far moves send the two areas separately
+print(sent(move(40, 30)))
+print(red_box())
+
+
+def recolor():
+    palette[1] = 0x00ff00
+
+
+# changing the palette redraws the sprite only
+print(sent(recolor))
+print(red_box(), bus[40, 30] == 0x07e0)
+
+# removing the sprite clears its area
+print(sent(group.pop))
+print(bus[40, 30], red_box())
@@ -0,0 +1,143 @@
+# Test Shape rendering a span at a time. Rows set directly, mirrored rows, circles, rounded
+# rectangles and a circle too large to square its row offsets in 32 bits are compared with a per
+# pixel model. The framebuffer checksums are kept in the .exp file.
+
+try:
+    import displayio
+    displayio.MemoryBus
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 48
+HEIGHT = 32
+
+displayio.release_displays()
+bus = displayio.MemoryBus(width=WIDTH, height=HEIGHT)
+display = displayio.Display(bus, b"", width=WIDTH, height=HEIGHT)
+display.auto_refresh = False
+
+palette = displayio.Palette(2)
+palette[1] = 0xffffff
+palette.make_transparent(0)
+
+
+def checksum():
+    total = 0
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            total = (total * 31 + bus[x, y]) & 0xffffff
+    return total
+
+
+def isqrt(n):
+    root = n
+    next_root = (root + 1) // 2
+    while next_root < root:
+        root = next_root
+        next_root = (root + n // root) // 2
+    return root
+
+
+class Model:
+    # Rows are stored like Shape stores them: inclusive start and end per stored row.
+    def __init__(self, width, height, mirror_x=False, mirror_y=False):
+        self.width = width
+        self.height = height
+        self.mirror_x = mirror_x
+        self.mirror_y = mirror_y
+        self.half_width = width // 2 + width % 2 - 1 if mirror_x else width
+        self.half_height = height // 2 + height % 2 - 1 if mirror_y else height
+        rows = self.half_height + 1 if mirror_y else height
+        self.rows = [(0, self.half_width)] * rows
+        self.shape = displayio.Shape(width, height, mirror_x=mirror_x, mirror_y=mirror_y)
+
+    def set_boundary(self, y, start_x, end_x):
+        self.rows[y] = (start_x, end_x)
+        self.shape.set_boundary(y, start_x, end_x)
+
+    def clipped(self, y, start_x, end_x):
+        start_x = max(start_x, 0)
+        end_x = min(end_x, self.half_width if self.mirror_x else self.width - 1)
+        self.rows[y] = (start_x, end_x) if start_x <= end_x else (1, 0)
+
+    def set_circle(self, x, y, radius):
+        for row in range(len(self.rows)):
+            dy = row - y
+            if -radius <= dy <= radius:
+                dx = isqrt(radius * radius - dy * dy)
+                self.clipped(row, x - dx, x + dx)
+            else:
+                self.clipped(row, 1, 0)
+        self.shape.set_circle(x, y, radius)
+
+    def set_rounded_rectangle(self, x, y, width, height, radius):
+        radius = min(radius, width // 2, height // 2)
+        for row in range(len(self.rows)):
+            i = row - y
+            if not 0 <= i < height:
+                self.clipped(row, 1, 0)
+                continue
+            d = 0
+            if i < radius:
+                d = radius - i
+            elif i >= height - radius:
+                d = i - (height - 1 - radius)
+            inset = radius - isqrt(radius * radius - d * d)
+            self.clipped(row, x + inset, x + width - 1 - inset)
+        self.shape.set_rounded_rectangle(x, y, width, height, radius)
+
+    def pixel(self, x, y):
+        if not (0 <= x < self.width and 0 <= y < self.height):
+            return 0
+        if self.mirror_x and x > self.half_width:
+            x = self.width - 1 - x
+        if self.mirror_y and y > self.half_height:
+            y = self.height - y - 1
+        start_x, end_x = self.rows[y]
+        return 1 if start_x <= x <= end_x else 0
+
+
+def check(models):
+    root = displayio.Group(max_size=len(models))
+    for model, x, y in models:
+        root.append(displayio.TileGrid(model.shape, pixel_shader=palette, x=x, y=y))
+    display.show(root)
+    display.refresh()
+    bad = 0
+    for py in range(HEIGHT):
+        for px in range(WIDTH):
+            value = 0
+            for model, x, y in models:
+                value |= model.pixel(px - x, py - y)
+            if bus[px, py] != (0xffff if value else 0):
+                bad += 1
+    print(bad, hex(checksum()))
+
+
+rows = Model(20, 12)
+for y in range(12):
+    rows.set_boundary(y, (y * 5) % 11, (y * 5) % 11 + y % 7)
+rows.set_boundary(4, 6, 5)
+
+mirrored = Model(15, 11, mirror_x=True, mirror_y=True)
+for y in range(6):
+    mirrored.set_boundary(y, 6 - y, 7 - y % 3)
+
+circle = Model(20, 16)
+circle.set_circle(9, 7, 6)
+
+rounded = Model(20, 14, mirror_x=True)
+rounded.set_rounded_rectangle(1, 1, 18, 12, 5)
+
+check(((rows, 2, 2), (mirrored, 25, 2), (circle, 2, 15), (rounded, 26, 16)))
+
+# Move the circle partly off the shape so rows get clipped on both sides.
+circle.set_circle(-2, 12, 9)
+rounded.set_rounded_rectangle(-4, 3, 30, 8, 20)
+check(((rows, 2, 2), (mirrored, 25, 2), (circle, 2, 15), (rounded, 26, 16)))
+
+# Rows this far from the center of a radius 50000 circle overflow when squared as int32.
+arc = Model(WIDTH, 15100)
+arc.set_circle(-16824, -32000, 50000)
+check(((arc, 0, -15070),))
@@ -0,0 +1,117 @@
+# Test that _stage draws sprites in all eight rotations over a tile map exactly like a per pixel
+# model of the layers, including sprites that hang off the edges of the screen and regions that are
+# sent in several pieces.
+
+try:
+    import _stage
+    import displayio
+    displayio.MemoryBus
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 64
+HEIGHT = 48
+TRANSPARENT = 0x1ff8
+
+displayio.release_displays()
+bus = displayio.MemoryBus(width=WIDTH, height=HEIGHT)
+display = displayio.Display(bus, b"", width=WIDTH, height=HEIGHT)
+display.auto_refresh = False
+
+
+def make_palette(colors):
+    palette = bytearray(32)
+    for i, color in enumerate(colors):
+        palette[2 * i] = color & 0xff
+        palette[2 * i + 1] = color >> 8
+    return palette
+
+
+# Asymmetric graphics so that every rotation looks different.
+graphic = bytearray((i * 73 + (i >> 3) * 29 + (i >> 7)) & 0xff for i in range(2048))
+tiles = bytearray((i * 37 + 11) & 0xff for i in range(2048))
+sprite_palette = make_palette([TRANSPARENT] + [0x0841 * i + 0x1000 for i in range(1, 16)])
+tile_palette = make_palette([0xf000 + 0x0101 * i for i in range(16)])
+grid = bytearray((i * 5 + 3) & 0xff for i in range(6))
+background = _stage.Layer(WIDTH // 16, HEIGHT // 16, tiles, tile_palette, grid)
+sprites = []
+for rotation in range(8):
+    sprite = _stage.Layer(1, 1, graphic, sprite_palette)
+    sprite.frame(rotation + 3, rotation)
+    sprites.append(sprite)
+layers = sprites + [background]
+
+
+def nibble(data, frame, x, y):
+    value = data[frame * 128 + y * 8 + x // 2]
+    return value & 0x0f if x & 1 else value >> 4
+
+
+def rotate(rotation, x, y):
+    if rotation == 1:
+        return y, 15 - x
+    if rotation == 2:
+        return 15 - x, 15 - y
+    if rotation == 3:
+        return 15 - y, x
+    if rotation == 4:
+        return 15 - x, y
+    if rotation == 5:
+        return y, x
+    if rotation == 6:
+        return x, 15 - y
+    if rotation == 7:
+        return 15 - y, 15 - x
+    return x, y
+
+
+def color(palette, index):
+    return palette[2 * index] | palette[2 * index + 1] << 8
+
+
+def expected(positions, x, y):
+    for i, (sx, sy) in enumerate(positions):
+        lx = x - sx
+        ly = y - sy
+        if 0 <= lx < 16 and 0 <= ly < 16:
+            c = color(sprite_palette, nibble(graphic, i + 3, *rotate(i, lx, ly)))
+            if c != TRANSPARENT:
+                return c
+    tx = x // 16
+    ty = y // 16
+    frame = nibble(grid, 0, ty * (WIDTH // 16) + tx, 0)
+    return color(tile_palette, nibble(tiles, frame, x & 15, y & 15))
+
+
+def check(positions):
+    mismatches = 0
+    total = 0
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            c = expected(positions, x, y)
+            # The colors go out in buffer order, so the bus sees them byte swapped.
+            if bus[x, y] != (c & 0xff) << 8 | c >> 8:
+                mismatches += 1
+            total = (total * 31 + bus[x, y]) & 0xffffff
+    print(mismatches, hex(total))
+
+
+def place(positions):
+    for sprite, position in zip(sprites, positions):
+        sprite.move(*position)
+
+
+positions = [(i * 8 - 4, (i * 11) % 40 - 2) for i in range(8)]
+place(positions)
+_stage.render(0, 0, WIDTH, HEIGHT, layers, bytearray(512), display)
+check(positions)
+
+# Overlapping sprites hanging off every edge, sent as two regions through a buffer that doesn't
+# divide the rows evenly.
+positions = [(-9, -5), (57, 40), (20, 20), (26, 24), (-3, 38), (50, -12), (8, 8), (14, 12)]
+place(positions)
+buffer = bytearray(2 * 37)
+_stage.render(0, 0, WIDTH, 21, layers, buffer, display)
+_stage.render(0, 21, WIDTH, HEIGHT, layers, buffer, display)
+check(positions)
@@ -0,0 +1,71 @@
+# Test that a Terminal scrolled by the panel shows the same rows as a full redraw. The panel memory
+# is taller than the display, and a display without a memory height redraws instead of scrolling.
+
+try:
+    import displayio
+    import terminalio
+    displayio.MemoryBus
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 60
+HEIGHT = 112
+MIPI_COMMAND_SET_SCROLL_START = 0x37
+
+font = terminalio.FONT
+tile_width, tile_height = font.get_bounding_box()
+palette = displayio.Palette(2)
+palette[0] = 0x000000
+palette[1] = 0xffffff
+
+
+def checksum(bus):
+    total = 0
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            total = (total * 31 + bus[x, y]) & 0xffffff
+    return total
+
+
+def run(memory_height):
+    displayio.release_displays()
+    bus = displayio.MemoryBus(width=WIDTH, height=memory_height or HEIGHT)
+    display = displayio.Display(bus, b"", width=WIDTH, height=HEIGHT,
+                                set_vertical_scroll=MIPI_COMMAND_SET_SCROLL_START,
+                                memory_height=memory_height)
+    display.auto_refresh = False
+    grid = displayio.TileGrid(font.bitmap, pixel_shader=palette, width=WIDTH // tile_width,
+                              height=HEIGHT // tile_height, tile_width=tile_width,
+                              tile_height=tile_height)
+    root = displayio.Group(max_size=1)
+    root.append(grid)
+    display.show(root)
+    terminal = terminalio.Terminal(grid, font)
+    display.refresh()
+
+    sums = []
+    sent = []
+    for line in range(14):
+        terminal.write("{} {}\r\n".format(line, "abcdefgh"[line % 8:]).encode())
+        start = bus.bytes_sent
+        display.refresh()
+        sent.append(bus.bytes_sent - start)
+        shown = checksum(bus)
+        # Drawing everything again has to give the same picture.
+        display.show(displayio.Group())
+        display.show(root)
+        display.refresh()
+        sums.append(shown == checksum(bus))
+        sums.append(hex(shown))
+    print(sums)
+    return sent
+
+
+# Once the terminal is full each new line scrolls the panel and only that line is sent.
+scrolled = run(128)
+redrawn = run(0)
+print(scrolled)
+print(redrawn)
+rows = HEIGHT // tile_height
+print(all(s * 2 < r for s, r in zip(scrolled[rows:], redrawn[rows:])))
@@ -0,0 +1,115 @@
+# Test TileGrid rendering over runs of transparent and opaque pixels, including tiles that are
+# offset from the display grid and a scaled group. The framebuffer is compared with a simple per
+# pixel model of the scene and its checksum is kept in the .exp file.
+
+try:
+    import displayio
+    displayio.MemoryBus
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+WIDTH = 48
+HEIGHT = 32
+
+displayio.release_displays()
+bus = displayio.MemoryBus(width=WIDTH, height=HEIGHT)
+display = displayio.Display(bus, b"", width=WIDTH, height=HEIGHT)
+display.auto_refresh = False
+
+
+def rgb565(color):
+    return (color >> 19 & 0x1f) << 11 | (color >> 10 & 0x3f) << 5 | (color >> 3 & 0x1f)
+
+
+def checksum():
+    total = 0
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            total = (total * 31 + bus[x, y]) & 0xffffff
+    return total
+
+
+def make_palette(colors):
+    palette = displayio.Palette(len(colors))
+    for i, color in enumerate(colors):
+        palette[i] = color
+    return palette
+
+
+BACKGROUND = (0x102030, 0x405060, 0x708090, 0xa0b0c0)
+FOREGROUND = (0x000000, 0xff0000, 0x00ff00)
+SMALL = (0xffff00, 0x000000, 0x0000ff)
+
+background = displayio.Bitmap(WIDTH, HEIGHT, 4)
+for y in range(HEIGHT):
+    for x in range(WIDTH):
+        background[x, y] = (x // 3 + y // 2) % 4
+background_palette = make_palette(BACKGROUND)
+
+# Two 8x8 tiles whose values switch between transparent 0 and opaque runs of varying length.
+tiles = displayio.Bitmap(16, 8, 3)
+for y in range(8):
+    for x in range(16):
+        tiles[x, y] = 0 if (x * 7 + y * 3) % 5 < 2 else 1 + (x + y) % 2
+foreground_palette = make_palette(FOREGROUND)
+foreground_palette.make_transparent(0)
+TILE_INDEXES = (0, 1, 1, 0, 1, 0, 0, 1)
+foreground = displayio.TileGrid(tiles, pixel_shader=foreground_palette, width=4, height=2,
+                                tile_width=8, tile_height=8, x=5, y=7)
+for i, tile in enumerate(TILE_INDEXES):
+    foreground[i] = tile
+
+small = displayio.Bitmap(5, 3, 3)
+for y in range(3):
+    for x in range(5):
+        small[x, y] = (x + 2 * y) % 3
+small_palette = make_palette(SMALL)
+small_palette.make_transparent(1)
+scaled = displayio.Group(max_size=1, scale=2, x=30, y=2)
+scaled.append(displayio.TileGrid(small, pixel_shader=small_palette))
+
+root = displayio.Group(max_size=3)
+root.append(displayio.TileGrid(background, pixel_shader=background_palette))
+root.append(foreground)
+root.append(scaled)
+display.show(root)
+
+
+def model(transparent):
+    frame = [[rgb565(BACKGROUND[background[x, y]]) for x in range(WIDTH)] for y in range(HEIGHT)]
+    for y in range(16):
+        for x in range(32):
+            tile = TILE_INDEXES[y // 8 * 4 + x // 8]
+            value = tiles[tile * 8 + x % 8, y % 8]
+            if value not in transparent:
+                frame[7 + y][5 + x] = rgb565(FOREGROUND[value])
+    for y in range(6):
+        for x in range(10):
+            value = small[x // 2, y // 2]
+            if value != 1:
+                frame[2 + y][30 + x] = rgb565(SMALL[value])
+    return frame
+
+
+def check(transparent):
+    display.refresh()
+    expected = model(transparent)
+    bad = 0
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            if bus[x, y] != expected[y][x]:
+                bad += 1
+    print(bad, hex(checksum()))
+
+
+check((0,))
+
+# Making another color transparent opens up more runs.
+foreground_palette.make_transparent(2)
+check((0, 2))
+
+# And making them opaque again fills them back in.
+foreground_palette.make_opaque(0)
+foreground_palette.make_opaque(2)
+check(())
@@ -0,0 +1,29 @@
+# Test that wait_for_frame draws a frame itself when auto_refresh is off rather than waiting for a
+# background refresh that never comes.
+
+try:
+    import displayio
+    displayio.MemoryBus
+except (ImportError, AttributeError):
+    print("SKIP")
+    raise SystemExit
+
+displayio.release_displays()
+bus = displayio.MemoryBus(width=32, height=16)
+display = displayio.Display(bus, b"", width=32, height=16)
+display.auto_refresh = False
+
+bitmap = displayio.Bitmap(4, 4, 2)
+bitmap.fill(1)
+palette = displayio.Palette(2)
+palette[1] = 0x0000ff
+group = displayio.Group()
+group.append(displayio.TileGrid(bitmap, pixel_shader=palette, x=2, y=3))
+display.show(group)
+
+print(display.wait_for_frame())
+print(display.pixels_sent, bus[2, 3], bus[6, 3])
+
+group[0].x = 10
+print(display.wait_for_frame())
+print(display.pixels_sent, bus[2, 3], bus[10, 3])
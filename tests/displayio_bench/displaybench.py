@@ -0,0 +1,41 @@
+# Shared setup for the displayio benchmarks. Each scene builds a group on a memory backed display and
+# then times refreshes while it moves things around.
+
+import sys
+import utime
+import displayio
+
+WIDTH = 320
+HEIGHT = 240
+FRAMES = 30
+
+displayio.release_displays()
+bus = displayio.MemoryBus(width=WIDTH, height=HEIGHT)
+display = displayio.Display(bus, b"", width=WIDTH, height=HEIGHT)
+display.auto_refresh = False
+
+
+def run(name, root, step, frames=FRAMES):
+    display.show(root)
+    # The first frame draws the whole screen so it isn't counted.
+    display.refresh()
+    start_bytes = bus.bytes_sent
+    render = 0
+    start = utime.ticks_us()
+    for frame in range(frames):
+        step(frame)
+        display.refresh()
+        render += display.last_render_time
+    elapsed = utime.ticks_diff(utime.ticks_us(), start)
+    report(name, elapsed // frames, int(render * 1000000) // frames,
+           (bus.bytes_sent - start_bytes) // frames)
+
+
+def report(name, elapsed, render, sent):
+    print("{}: {} us per frame, {} us rendering, {} bytes per frame".format(
+        name, elapsed, render, sent))
+
+    # Pass a directory to keep the last frame for comparison.
+    if len(sys.argv) > 1:
+        with open("{}/{}.ppm".format(sys.argv[1], name), "wb") as f:
+            bus.dump_ppm(f)
@@ -0,0 +1,67 @@
+# Redraws a full screen OnDiskBitmap every frame. The BMP lives on a FAT filesystem in RAM so the
+# time is spent reading and decoding it rather than waiting on storage. The block device counts its
+# reads so that the number of storage accesses per frame can be compared too.
+
+import ustruct as struct
+import uos
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+
+class RAMBlockDevice:
+    def __init__(self, blocks, block_size=512):
+        self.block_size = block_size
+        self.data = bytearray(blocks * block_size)
+        self.reads = 0
+
+    def readblocks(self, n, buf):
+        self.reads += 1
+        start = n * self.block_size
+        buf[:] = self.data[start:start + len(buf)]
+
+    def writeblocks(self, n, buf):
+        start = n * self.block_size
+        self.data[start:start + len(buf)] = buf
+
+    def ioctl(self, op, arg):
+        if op == 4:
+            return len(self.data) // self.block_size
+        if op == 5:
+            return self.block_size
+
+
+# Leave a bit of room over the image for the filesystem itself.
+stride = WIDTH * 3
+device = RAMBlockDevice(stride * HEIGHT // 512 + 64)
+uos.VfsFat.mkfs(device)
+uos.mount(uos.VfsFat(device), "/ram")
+
+with open("/ram/bench.bmp", "wb") as f:
+    f.write(b"BM" + struct.pack("<IHHI", 54 + stride * HEIGHT, 0, 0, 54))
+    f.write(struct.pack("<IiiHHIIiiII", 40, WIDTH, HEIGHT, 1, 24, 0, stride * HEIGHT, 0, 0, 0, 0))
+    row = bytearray(stride)
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            row[x * 3] = x * 255 // WIDTH
+            row[x * 3 + 1] = y * 255 // HEIGHT
+            row[x * 3 + 2] = (x ^ y) & 0xff
+        f.write(row)
+
+f = open("/ram/bench.bmp", "rb")
+grid = displayio.TileGrid(displayio.OnDiskBitmap(f), pixel_shader=displayio.ColorConverter())
+root = displayio.Group()
+root.append(grid)
+
+
+def step(frame):
+    # Moving the grid by a pixel forces every row to be read again.
+    grid.x = frame % 2
+
+
+FRAMES = 10
+reads = device.reads
+run("ondiskbitmap", root, step, frames=FRAMES)
+# The first, uncounted frame is included so the average is over FRAMES + 1 full redraws.
+print("  {} block reads per frame for {} sectors of pixels".format(
+    (device.reads - reads) // (FRAMES + 1), (stride * HEIGHT + 511) // 512))
+f.close()
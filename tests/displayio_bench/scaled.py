@@ -0,0 +1,34 @@
+# Moves a small tile grid around inside nested scaled groups so each source pixel covers up to six
+# screen pixels.
+
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+bitmap = displayio.Bitmap(24, 24, 4)
+for y in range(24):
+    for x in range(24):
+        bitmap[x, y] = (x // 6 + y // 6) % 4
+palette = displayio.Palette(4)
+palette[0] = 0x000000
+palette[1] = 0x00ffff
+palette[2] = 0xff00ff
+palette[3] = 0xffffff
+
+inner = displayio.Group(scale=3)
+tiles = displayio.TileGrid(bitmap, pixel_shader=palette)
+inner.append(tiles)
+outer = displayio.Group(scale=2)
+outer.append(inner)
+root = displayio.Group()
+root.append(outer)
+
+limit_x = WIDTH // 6 - 24
+limit_y = HEIGHT // 6 - 24
+
+
+def step(frame):
+    tiles.x = frame % limit_x
+    tiles.y = frame * 2 % limit_y
+
+
+run("scaled", root, step)
@@ -0,0 +1,44 @@
+# Sweeps the needle of a gauge built from Shapes. The needle polygon and the level bar are set
+# again every frame like a live reading would.
+
+import math
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+SIZE = 200
+CENTER = SIZE // 2
+
+palette = displayio.Palette(2)
+palette.make_transparent(0)
+palette[1] = 0x404040
+dial = displayio.Shape(SIZE, SIZE, mirror_x=True, mirror_y=True)
+dial.set_circle(CENTER, CENTER, CENTER - 1)
+
+needle_palette = displayio.Palette(2)
+needle_palette.make_transparent(0)
+needle_palette[1] = 0xff0000
+needle = displayio.Shape(SIZE, SIZE)
+
+bar_palette = displayio.Palette(2)
+bar_palette.make_transparent(0)
+bar_palette[1] = 0x00ff00
+bar = displayio.Shape(WIDTH, 24)
+
+root = displayio.Group(max_size=3)
+root.append(displayio.TileGrid(dial, pixel_shader=palette, x=(WIDTH - SIZE) // 2))
+root.append(displayio.TileGrid(needle, pixel_shader=needle_palette, x=(WIDTH - SIZE) // 2))
+root.append(displayio.TileGrid(bar, pixel_shader=bar_palette, y=HEIGHT - 24))
+
+
+def step(frame):
+    angle = math.pi * (frame % 60) / 60
+    dx = math.cos(angle)
+    dy = -math.sin(angle)
+    tip = (CENTER + int(dx * (CENTER - 10)), CENTER + int(dy * (CENTER - 10)))
+    left = (CENTER + int(-dy * 4), CENTER + int(dx * 4))
+    right = (CENTER + int(dy * 4), CENTER + int(-dx * 4))
+    needle.set_polygon((left, tip, right))
+    bar.set_rounded_rectangle(0, 0, 16 + frame * 10 % (WIDTH - 16), 24, 8)
+
+
+run("shapes", root, step)
@@ -0,0 +1,49 @@
+# Moves a set of partly transparent sprites over a static background. Only the areas the sprites
+# leave and enter are redrawn.
+
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+SPRITE = 32
+SPRITES = 16
+
+background = displayio.Bitmap(WIDTH, HEIGHT, 4)
+for y in range(HEIGHT):
+    for x in range(WIDTH):
+        background[x, y] = (x // 40 + y // 40) % 4
+background_palette = displayio.Palette(4)
+background_palette[0] = 0x202040
+background_palette[1] = 0x204020
+background_palette[2] = 0x402020
+background_palette[3] = 0x404040
+
+sprite = displayio.Bitmap(SPRITE, SPRITE, 3)
+for y in range(SPRITE):
+    for x in range(SPRITE):
+        d = (x - SPRITE // 2) ** 2 + (y - SPRITE // 2) ** 2
+        if d < 100:
+            sprite[x, y] = 1
+        elif d < 225:
+            sprite[x, y] = 2
+sprite_palette = displayio.Palette(3)
+sprite_palette[1] = 0xffff00
+sprite_palette[2] = 0xff0000
+sprite_palette.make_transparent(0)
+
+root = displayio.Group(max_size=SPRITES + 1)
+root.append(displayio.TileGrid(background, pixel_shader=background_palette))
+sprites = []
+for i in range(SPRITES):
+    s = displayio.TileGrid(sprite, pixel_shader=sprite_palette,
+                           x=(i * 37) % (WIDTH - SPRITE), y=(i * 53) % (HEIGHT - SPRITE))
+    sprites.append(s)
+    root.append(s)
+
+
+def step(frame):
+    for i, s in enumerate(sprites):
+        s.x = (s.x + 1 + i % 3) % (WIDTH - SPRITE)
+        s.y = (s.y + 1 + i % 2) % (HEIGHT - SPRITE)
+
+
+run("sprites", root, step)
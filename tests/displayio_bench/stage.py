@@ -0,0 +1,66 @@
+# Sprites moving over a tile map with a line of text, drawn by _stage straight to the display
+# rather than through a displayio group. Odd frames redraw the whole screen and even frames redraw
+# the area under each sprite first, the way stage games update dirty rectangles.
+
+import urandom
+import utime
+import _stage
+from displaybench import WIDTH, HEIGHT, FRAMES, bus, display, report
+
+urandom.seed(7)
+
+
+def random_bytes(count):
+    return bytearray(urandom.getrandbits(8) for i in range(count))
+
+
+def random_palette(colors, transparent=None):
+    palette = bytearray(32)
+    for i in range(colors):
+        color = 0x1ff8 if i == transparent else urandom.getrandbits(16)
+        palette[2 * i] = color & 0xff
+        palette[2 * i + 1] = color >> 8
+    return palette
+
+
+# Color 0 of the sprite palette is the transparent 0x1ff8.
+palette = random_palette(16, transparent=0)
+background = _stage.Layer(WIDTH // 16, HEIGHT // 16,
+                          bytearray(b | 0x11 for b in random_bytes(16 * 128)), palette,
+                          random_bytes(WIDTH // 16 * HEIGHT // 16 // 2))
+graphic = random_bytes(16 * 128)
+sprites = []
+for i in range(8):
+    sprite = _stage.Layer(1, 1, graphic, palette)
+    sprite.frame(i, i)
+    sprites.append(sprite)
+text = _stage.Text(12, 2, random_bytes(2048), random_palette(8), random_bytes(24))
+text.move(5, 3)
+layers = [text] + sprites + [background]
+buffer = bytearray(512)
+
+
+def sprite_position(i, frame):
+    return ((i * 23 + frame * (i + 1)) % (WIDTH + 32) - 16,
+            (i * 17 + frame * 2) % (HEIGHT + 32) - 16)
+
+
+def step(frame):
+    for i, sprite in enumerate(sprites):
+        sprite.move(*sprite_position(i, frame))
+    if frame % 2 == 0:
+        for i in range(len(sprites)):
+            x, y = sprite_position(i, frame)
+            x = max(0, x)
+            y = max(0, y)
+            _stage.render(x, y, min(WIDTH, x + 16), min(HEIGHT, y + 16), layers, buffer, display)
+    _stage.render(0, 0, WIDTH, HEIGHT, layers, buffer, display)
+
+
+step(0)
+start_bytes = bus.bytes_sent
+start = utime.ticks_us()
+for frame in range(FRAMES):
+    step(frame)
+elapsed = utime.ticks_diff(utime.ticks_us(), start) // FRAMES
+report("stage", elapsed, elapsed, (bus.bytes_sent - start_bytes) // FRAMES)
@@ -0,0 +1,43 @@
+# Scrolls a screen of text up by one pixel per frame. The glyphs are drawn from a generated 1 bit
+# sheet, the same way terminalio draws characters from a font bitmap.
+
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+GLYPH_WIDTH = 6
+GLYPH_HEIGHT = 12
+GLYPHS = 64
+
+sheet = displayio.Bitmap(GLYPH_WIDTH * GLYPHS, GLYPH_HEIGHT, 2)
+for glyph in range(GLYPHS):
+    for y in range(1, GLYPH_HEIGHT - 2):
+        for x in range(GLYPH_WIDTH - 1):
+            if (glyph >> (x + y) % 6) & 1:
+                sheet[glyph * GLYPH_WIDTH + x, y] = 1
+
+palette = displayio.Palette(2)
+palette[0] = 0x000000
+palette[1] = 0xffffff
+
+columns = WIDTH // GLYPH_WIDTH
+rows = HEIGHT // GLYPH_HEIGHT + 1
+text = displayio.TileGrid(sheet, pixel_shader=palette, width=columns, height=rows,
+                          tile_width=GLYPH_WIDTH, tile_height=GLYPH_HEIGHT)
+for y in range(rows):
+    for x in range(columns):
+        text[x, y] = (x * 7 + y * 13) % GLYPHS
+
+root = displayio.Group()
+root.append(text)
+
+
+def step(frame):
+    text.y = -(frame % GLYPH_HEIGHT)
+    if frame % GLYPH_HEIGHT == GLYPH_HEIGHT - 1:
+        # Write a new line the way a terminal would.
+        row = frame // GLYPH_HEIGHT % rows
+        for x in range(columns):
+            text[x, row] = (x + frame) % GLYPHS
+
+
+run("text", root, step)
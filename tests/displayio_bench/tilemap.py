@@ -0,0 +1,35 @@
+# Scrolls a map of 16x16 tiles one pixel per frame so every frame redraws the whole screen.
+
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+TILE = 16
+TILES = 8
+
+sheet = displayio.Bitmap(TILE * TILES, TILE, TILES)
+for tile in range(TILES):
+    for y in range(TILE):
+        for x in range(TILE):
+            sheet[tile * TILE + x, y] = (tile + (x ^ y) // 4) % TILES
+
+palette = displayio.Palette(TILES)
+for i in range(TILES):
+    palette[i] = (i * 0x1f) << 16 | (0xff - i * 0x1f) << 8 | i * 0x10
+
+columns = WIDTH // TILE + 1
+rows = HEIGHT // TILE
+grid = displayio.TileGrid(sheet, pixel_shader=palette, width=columns, height=rows,
+                          tile_width=TILE, tile_height=TILE)
+for y in range(rows):
+    for x in range(columns):
+        grid[x, y] = (x * 3 + y * 5) % TILES
+
+root = displayio.Group()
+root.append(grid)
+
+
+def step(frame):
+    grid.x = -(frame % TILE)
+
+
+run("tilemap", root, step)
@@ -0,0 +1,45 @@
+# Moves a highlight over a screen full of small labels. Each label is a group with a tile grid per
+# character like the ones text libraries build. Each frame redraws a small area so most of the time goes to finding the layers in it.
+
+import displayio
+from displaybench import run, WIDTH, HEIGHT
+
+CHARACTERS = 6
+GLYPH_WIDTH = 6
+LABEL_WIDTH = CHARACTERS * GLYPH_WIDTH + 4
+LABEL_HEIGHT = 12
+
+glyph = displayio.Bitmap(GLYPH_WIDTH, LABEL_HEIGHT, 2)
+for y in range(2, LABEL_HEIGHT - 2):
+    for x in range(GLYPH_WIDTH - 1):
+        if (x + y) % 3 == 0:
+            glyph[x, y] = 1
+palette = displayio.Palette(2)
+palette[1] = 0xffffff
+palette.make_transparent(0)
+
+columns = WIDTH // LABEL_WIDTH
+rows = HEIGHT // LABEL_HEIGHT
+root = displayio.Group(max_size=columns * rows + 1)
+for row in range(rows):
+    for column in range(columns):
+        label = displayio.Group(max_size=CHARACTERS, x=column * LABEL_WIDTH, y=row * LABEL_HEIGHT)
+        for i in range(CHARACTERS):
+            label.append(displayio.TileGrid(glyph, pixel_shader=palette, x=i * GLYPH_WIDTH))
+        root.append(label)
+
+HIGHLIGHT = 48
+
+highlight_bitmap = displayio.Bitmap(HIGHLIGHT, HIGHLIGHT, 1)
+highlight_palette = displayio.Palette(1)
+highlight_palette[0] = 0x00ff00
+highlight = displayio.TileGrid(highlight_bitmap, pixel_shader=highlight_palette)
+root.append(highlight)
+
+
+def step(frame):
+    highlight.x = frame * 3 % (WIDTH - HIGHLIGHT)
+    highlight.y = frame * 2 % (HEIGHT - HIGHLIGHT)
+
+
+run("widgets", root, step, frames=100)
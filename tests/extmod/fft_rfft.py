@@ -0,0 +1,80 @@
+# test fft module transforms, windows and magnitudes
+
+try:
+    import array
+    import fft
+except ImportError:
+    print("SKIP")
+    raise SystemExit
+
+import math
+
+N = 64
+
+# a full scale cosine at bin 4, a half scale sine at bin 9 and an offset
+samples = [int(16000 * math.cos(2 * math.pi * 4 * i / N) + 8000 * math.sin(2 * math.pi * 9 * i / N)) + 1000 for i in range(N)]
+
+# fixed point spectra are divided by the length
+h = array.array('h', samples)
+fft.rfft(h)
+print(h[0], h[1])
+print([h[2 * k] for k in (4, 9)], [h[2 * k + 1] for k in (4, 9)])
+print(max(abs(h[i]) for i in list(range(2, 8)) + list(range(10, 18)) + list(range(20, N))) <= 2)
+
+f = array.array('f', samples)
+fft.rfft(f)
+print(round(f[0] / N), round(f[1] / N))
+print([round(f[2 * k] / N) for k in (4, 9)], [round(f[2 * k + 1] / N) for k in (4, 9)])
+
+# magnitudes can be written over the spectrum
+fft.magnitude(h, h)
+print([h[k] for k in (0, 4, 9)])
+m = array.array('f', [0] * (N // 2))
+fft.magnitude(f, m)
+print([round(m[k] / N) for k in (0, 4, 9)])
+
+# magnitudes of full scale bins saturate
+h = array.array('h', [-32768, 0, -32768, -32768, 32767, -32768, 3, 4] + [0] * 8)
+fft.magnitude(h, h)
+print(list(h[:4]))
+
+# every length
+for n in (16, 32, 128, 256, 512, 1024, 2048):
+    h = array.array('h', [int(20000 * math.sin(2 * math.pi * 3 * i / n)) for i in range(n)])
+    fft.rfft(h)
+    print(n, h[6], h[7])
+
+# windows
+for window in (fft.HANN, fft.HAMMING, fft.BLACKMAN):
+    h = array.array('h', [32767] * 16)
+    fft.window(h, window)
+    print(list(h))
+    f = array.array('f', [1] * 16)
+    fft.window(f, window)
+    print([round(x * 1000) for x in f])
+h = array.array('h', [1000] * 16)
+fft.window(h)
+print(list(h))
+
+# errors
+for buf in (array.array('h', [0] * 48), array.array('h', [0] * 8), array.array('h', [0] * 4096), array.array('i', [0] * 64)):
+    try:
+        fft.rfft(buf)
+    except ValueError:
+        print('ValueError')
+try:
+    fft.magnitude(array.array('h', [0] * 64), array.array('h', [0] * 31))
+except ValueError:
+    print('ValueError')
+try:
+    fft.magnitude(array.array('h', [0] * 64), array.array('f', [0] * 32))
+except ValueError:
+    print('ValueError')
+try:
+    fft.window(array.array('h', [0] * 64), 3)
+except ValueError:
+    print('ValueError')
+try:
+    fft.rfft(b'1234567890123456')
+except TypeError:
+    print('TypeError')
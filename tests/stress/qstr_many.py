@@ -0,0 +1,29 @@
+# intern enough names at runtime to fill many qstr pools and check they are all found again
+
+class A:
+    pass
+
+a = A()
+for i in range(1500):
+    setattr(a, 'attr_%d' % i, i)
+print(all(getattr(a, 'attr_%d' % i) == i for i in range(1500)))
+print(sum(getattr(a, 'attr_%d' % i) for i in range(0, 1500, 7)))
+
+# names that aren't there yet
+print(hasattr(a, 'attr_1500'), hasattr(a, 'attr_'))
+
+# built in names looked up from strings made at runtime
+l = []
+getattr(l, 'app' + 'end')(1)
+getattr(l, ''.join(['ext', 'end']))([2, 3])
+print(l, getattr(a, '__cl' + 'ass__') is A)
+
+# names differing only in their last character, so their hashes are close
+d = {}
+for c in range(32, 127):
+    d['qstr_' + chr(c)] = c
+print(sorted(d.values()) == list(range(32, 127)))
+b = A()
+for c in range(32, 127):
+    setattr(b, 'x' + chr(c), c)
+print(all(getattr(b, 'x' + chr(c)) == c for c in range(32, 127)))
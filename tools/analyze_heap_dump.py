@@ -57,10 +57,12 @@ SKIP_SYMBOLS = [".debug_ranges", ".debug_frame", ".debug_loc", ".comment", ".deb
 @click.option("--draw-heap-ownership/--no-draw-heap-ownership", default=False,
               help="Draw the ownership graph of blocks on the heap")
 @click.option("--analyze-snapshots", default="last", type=click.Choice(['all', 'last']))
+@click.option("--qstr-hash-index/--no-qstr-hash-index", default=False,
+              help="Whether the build has MICROPY_QSTR_HASH_INDEX, which adds two words to qstr pools")
 def do_all_the_things(ram_filename, bin_filename, map_filename, print_block_contents,
                       print_unknown_types, print_block_state, print_conflicting_symbols,
                       print_heap_structure, output_directory, draw_heap_layout,
-                      draw_heap_ownership, analyze_snapshots):
+                      draw_heap_ownership, analyze_snapshots, qstr_hash_index):
     with open(ram_filename, "rb") as f:
         ram_dump = f.read()
 
@@ -396,7 +398,7 @@ def do_all_the_things(ram_filename, bin_filename, map_filename, print_block_cont
                     pool = rom[rom_offset:rom_offset + 32 + length * 4]
 
                 if qstr_index >= total_prev_len:
-                    offset = (qstr_index - total_prev_len) * 4 + 16
+                    offset = (qstr_index - total_prev_len) * 4 + (24 if qstr_hash_index else 16)
                     start = struct.unpack_from("<I", pool, offset=offset)[0]
                     if start < heap_start:
                         start -= rom_start
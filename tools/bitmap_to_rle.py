@@ -0,0 +1,241 @@
+"""Converts BMP and PNG images into the run-length encoded format read by displayio.RLEBitmap.
+
+Indexed images and images with at most 256 colors are stored as one byte palette indices and the
+palette is printed as Python so it can be pasted next to the RLEBitmap. Other images are stored as
+RGB565 values for use with
+``displayio.ColorConverter(input_colorspace=displayio.Colorspace.RGB565)``.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+# Longest run or literal sequence a single packet can hold.
+MAX_PACKET = 128
+
+# Shortest run that is stored as a run rather than as part of a literal sequence.
+MIN_RUN = 3
+
+
+class Image:
+    def __init__(self, width, height, rows, palette=None):
+        self.width = width
+        self.height = height
+        # Each row is a list of palette indices when palette is set and RGB888 ints otherwise.
+        self.rows = rows
+        self.palette = palette
+
+
+def read_bmp(data):
+    if data[:2] != b"BM":
+        raise ValueError("not a BMP file")
+    data_offset = struct.unpack_from("<I", data, 10)[0]
+    header_size, width, height, _, bits, compression = struct.unpack_from("<IiiHHI", data, 14)
+    if compression not in (0, 3):
+        raise ValueError("compressed BMP files are not supported")
+    if bits not in (1, 2, 4, 8, 24, 32):
+        raise ValueError("unsupported BMP depth {}".format(bits))
+    top_down = height < 0
+    height = abs(height)
+
+    palette = None
+    if bits <= 8:
+        color_count = struct.unpack_from("<I", data, 46)[0] or 1 << bits
+        start = 14 + header_size
+        palette = []
+        for i in range(color_count):
+            b, g, r = data[start + i * 4:start + i * 4 + 3]
+            palette.append(r << 16 | g << 8 | b)
+
+    stride = (width * bits + 31) // 32 * 4
+    rows = []
+    for y in range(height):
+        file_row = y if top_down else height - 1 - y
+        row_data = data[data_offset + file_row * stride:data_offset + (file_row + 1) * stride]
+        row = []
+        for x in range(width):
+            if bits <= 8:
+                bit = x * bits
+                row.append(row_data[bit // 8] >> (8 - bits - bit % 8) & ((1 << bits) - 1))
+            else:
+                start = x * bits // 8
+                b, g, r = row_data[start:start + 3]
+                row.append(r << 16 | g << 8 | b)
+        rows.append(row)
+    return Image(width, height, rows, palette)
+
+
+def paeth(a, b, c):
+    p = a + b - c
+    pa = abs(p - a)
+    pb = abs(p - b)
+    pc = abs(p - c)
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+
+def read_png(data):
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG file")
+    offset = 8
+    compressed = b""
+    palette = None
+    while offset < len(data):
+        length, chunk_type = struct.unpack_from(">I4s", data, offset)
+        chunk = data[offset + 8:offset + 8 + length]
+        offset += 12 + length
+        if chunk_type == b"IHDR":
+            width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif chunk_type == b"PLTE":
+            palette = [chunk[i] << 16 | chunk[i + 1] << 8 | chunk[i + 2]
+                       for i in range(0, len(chunk), 3)]
+        elif chunk_type == b"IDAT":
+            compressed += chunk
+        elif chunk_type == b"IEND":
+            break
+    if interlace != 0:
+        raise ValueError("interlaced PNG files are not supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    if depth != 8 and (color_type != 3 and color_type != 0 or depth > 8):
+        raise ValueError("unsupported PNG depth {}".format(depth))
+
+    raw = zlib.decompress(compressed)
+    bits_per_pixel = depth * channels
+    stride = (width * bits_per_pixel + 7) // 8
+    filter_bytes = max(1, bits_per_pixel // 8)
+    previous = bytearray(stride)
+    rows = []
+    for y in range(height):
+        start = y * (stride + 1)
+        filter_type = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            left = line[i - filter_bytes] if i >= filter_bytes else 0
+            up = previous[i]
+            up_left = previous[i - filter_bytes] if i >= filter_bytes else 0
+            if filter_type == 1:
+                line[i] = (line[i] + left) & 0xff
+            elif filter_type == 2:
+                line[i] = (line[i] + up) & 0xff
+            elif filter_type == 3:
+                line[i] = (line[i] + (left + up) // 2) & 0xff
+            elif filter_type == 4:
+                line[i] = (line[i] + paeth(left, up, up_left)) & 0xff
+        previous = line
+
+        row = []
+        for x in range(width):
+            if depth < 8:
+                bit = x * depth
+                value = line[bit // 8] >> (8 - depth - bit % 8) & ((1 << depth) - 1)
+                if color_type == 0:
+                    value = value * 255 // ((1 << depth) - 1)
+                    value = value << 16 | value << 8 | value
+                row.append(value)
+                continue
+            pixel = line[x * channels:(x + 1) * channels]
+            if color_type == 3:
+                row.append(pixel[0])
+            elif color_type in (0, 4):
+                row.append(pixel[0] << 16 | pixel[0] << 8 | pixel[0])
+            else:
+                row.append(pixel[0] << 16 | pixel[1] << 8 | pixel[2])
+        rows.append(row)
+    if color_type != 3:
+        palette = None
+    return Image(width, height, rows, palette)
+
+
+def to_rgb565(color):
+    return (color >> 8 & 0xf800) | (color >> 5 & 0x07e0) | (color >> 3 & 0x001f)
+
+
+def encode_row(row, value_format):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_PACKET]
+            del literal[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            for value in chunk:
+                out.extend(struct.pack(value_format, value))
+
+    x = 0
+    while x < len(row):
+        run = 1
+        while x + run < len(row) and run < MAX_PACKET and row[x + run] == row[x]:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(struct.pack(value_format, row[x]))
+            x += run
+        else:
+            literal.append(row[x])
+            x += 1
+    flush_literal()
+    return out
+
+
+def encode(image, bytes_per_value):
+    value_format = "<B" if bytes_per_value == 1 else "<H"
+    encoded_rows = [encode_row(row, value_format) for row in image.rows]
+    header = b"RLEB" + struct.pack("<HHB3x", image.width, image.height, bytes_per_value)
+    offset = len(header) + 4 * image.height
+    offsets = bytearray()
+    for row in encoded_rows:
+        offsets.extend(struct.pack("<I", offset))
+        offset += len(row)
+    return header + offsets + b"".join(encoded_rows)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a BMP or PNG into an RLEBitmap file.")
+    parser.add_argument("input", type=argparse.FileType("rb"), help="BMP or PNG file")
+    parser.add_argument("output", type=argparse.FileType("wb"), help="RLE file to write")
+    parser.add_argument("--rgb565", action="store_true",
+                        help="Store RGB565 colors even when a palette would do")
+    args = parser.parse_args()
+
+    data = args.input.read()
+    if data[:2] == b"BM":
+        image = read_bmp(data)
+    else:
+        image = read_png(data)
+
+    if image.palette is None and not args.rgb565:
+        colors = sorted(set(color for row in image.rows for color in row))
+        if len(colors) <= 256:
+            index = {color: i for i, color in enumerate(colors)}
+            image.rows = [[index[color] for color in row] for row in image.rows]
+            image.palette = colors
+    elif image.palette is not None and args.rgb565:
+        image.rows = [[image.palette[value] for value in row] for row in image.rows]
+        image.palette = None
+
+    if image.palette is None:
+        image.rows = [[to_rgb565(color) for color in row] for row in image.rows]
+        encoded = encode(image, 2)
+        print("pixel_shader = displayio.ColorConverter("
+              "input_colorspace=displayio.Colorspace.RGB565)")
+    else:
+        encoded = encode(image, 1)
+        print("pixel_shader = displayio.Palette({})".format(len(image.palette)))
+        for i, color in enumerate(image.palette):
+            print("pixel_shader[{}] = 0x{:06x}".format(i, color))
+    args.output.write(encoded)
+
+    raw_size = image.width * image.height * (1 if image.palette is not None else 2)
+    print("# {}x{} {} bytes, {} bytes uncompressed".format(image.width, image.height,
+                                                           len(encoded), raw_size),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -41,14 +41,17 @@ if args.sample_file:
         for c in line.strip():
             sample_characters.add(c)
 
-# Merge visible ascii, sample characters and extra characters.
+# Merge visible ascii, sample characters and extra characters. Characters beyond ASCII are sorted
+# by codepoint so that BuiltinFont can binary search for them.
 visible_ascii = bytes(range(0x20, 0x7f)).decode("utf-8")
-all_characters = visible_ascii
-for c in sample_characters:
-    if c not in all_characters:
-        all_characters += c
+unicode_characters = set(sample_characters)
 if args.extra_characters:
-    all_characters.extend(args.extra_characters)
+    unicode_characters.update(args.extra_characters)
+unicode_characters = sorted(c for c in unicode_characters if c not in visible_ascii)
+for c in unicode_characters:
+    if ord(c) > 0xffff:
+        raise RuntimeError("Only characters up to U+FFFF are supported: {}".format(c))
+all_characters = visible_ascii + "".join(unicode_characters)
 filtered_characters = all_characters
 
 # Try to pre-load all of the glyphs. Misses will still be slow later.
@@ -67,34 +70,43 @@ for c in all_characters:
     real_bb[0] = max(real_bb[0], x - dx)
     real_bb[1] = max(real_bb[1], y - dy)
 
+# Tile index 0xff means no glyph.
+if len(filtered_characters) > 0xff:
+    raise RuntimeError("Too many characters for the font: {}".format(len(filtered_characters)))
+
 tile_x, tile_y = real_bb
-total_bits = tile_x * len(all_characters)
-total_bits += 32 - total_bits % 32
-bytes_per_row = total_bits // 8
-b = bytearray(bytes_per_row * tile_y)
 
-for x, c in enumerate(filtered_characters):
-    g = f.get_glyph(ord(c))
-    start_bit = x * tile_x + g["bounds"][2]
-    start_y = (tile_y - 2) - (g["bounds"][1] + g["bounds"][3])
-    for y, row in enumerate(g["bitmap"].rows):
-        for i in range(g["bounds"][0]):
-            byte = i // 8
-            bit = i % 8
-            if row[byte] & (1 << (7-bit)) != 0:
-                overall_bit = start_bit + (start_y + y) * bytes_per_row * 8 + i
-                b[overall_bit // 8] |= 1 << (7 - (overall_bit % 8))
-
-
-extra_characters = ""
-for c in filtered_characters:
-    if c not in visible_ascii:
-        extra_characters += c
+
+# Bitmap reads whole size_t words, so rows are padded to the word size of the target. Boards are
+# 32 bit but the unix port is usually 64 bit.
+def render(word_bits):
+    total_bits = tile_x * len(all_characters)
+    total_bits += word_bits - total_bits % word_bits
+    bytes_per_row = total_bits // 8
+    b = bytearray(bytes_per_row * tile_y)
+
+    for x, c in enumerate(filtered_characters):
+        g = f.get_glyph(ord(c))
+        start_bit = x * tile_x + g["bounds"][2]
+        start_y = (tile_y - 2) - (g["bounds"][1] + g["bounds"][3])
+        for y, row in enumerate(g["bitmap"].rows):
+            for i in range(g["bounds"][0]):
+                byte = i // 8
+                bit = i % 8
+                if row[byte] & (1 << (7-bit)) != 0:
+                    overall_bit = start_bit + (start_y + y) * bytes_per_row * 8 + i
+                    b[overall_bit // 8] |= 1 << (7 - (overall_bit % 8))
+    return b, bytes_per_row
+
+
+extra_codepoints = [ord(c) for c in filtered_characters if c not in visible_ascii]
 
 c_file = args.output_c_file
 
 c_file.write("""\
 
+#include <stdint.h>
+
 #include "shared-bindings/displayio/Palette.h"
 #include "supervisor/shared/display.h"
 
@@ -111,6 +123,7 @@ displayio_palette_t supervisor_terminal_color = {
     .opaque = terminal_transparency,
     .colors = terminal_colors,
     .color_count = 2,
+    .transparent_count = 0,
     .needs_refresh = false
 };
 """)
@@ -132,22 +145,39 @@ displayio_tilegrid_t supervisor_terminal_text_grid = {{
     .tile_width = {1},
     .tile_height = {2},
     .tiles = NULL,
-    .needs_refresh = false,
+    .full_change = false,
     .inline_tiles = false
 }};
 """.format(len(all_characters), tile_x, tile_y))
 
 c_file.write("""\
-const uint32_t font_bitmap_data[{}] = {{
-""".format(bytes_per_row * tile_y // 4))
+#if SIZE_MAX > 0xffffffff
+""")
 
-for i, word in enumerate(struct.iter_unpack(">I", b)):
-    c_file.write("0x{:08x}, ".format(word[0]))
-    if (i + 1) % (bytes_per_row // 4) == 0:
-        c_file.write("\n")
+for word_bits, word_type, word_format in ((64, "uint64_t", ">Q"), (32, "uint32_t", ">I")):
+    b, bytes_per_row = render(word_bits)
+    words_per_row = bytes_per_row // (word_bits // 8)
+    if word_bits == 32:
+        c_file.write("""\
+#else
+""")
+    c_file.write("""\
+#define FONT_BITMAP_STRIDE {}
+#define FONT_BITMAP_X_SHIFT {}
+const {} font_bitmap_data[{}] = {{
+""".format(words_per_row, word_bits.bit_length() - 1, word_type, words_per_row * tile_y))
+
+    for i, word in enumerate(struct.iter_unpack(word_format, b)):
+        c_file.write("0x{:0{}x}, ".format(word[0], word_bits // 4))
+        if (i + 1) % words_per_row == 0:
+            c_file.write("\n")
+
+    c_file.write("""\
+};
+""")
 
 c_file.write("""\
-};
+#endif
 """)
 
 c_file.write("""\
@@ -156,15 +186,31 @@ const displayio_bitmap_t supervisor_terminal_font_bitmap = {{
     .width = {},
     .height = {},
     .data = (size_t*) font_bitmap_data,
-    .stride = {},
+    .stride = FONT_BITMAP_STRIDE,
     .bits_per_value = 1,
-    .x_shift = 5,
-    .x_mask = 0x1f,
+    .x_shift = FONT_BITMAP_X_SHIFT,
+    .x_mask = (1 << FONT_BITMAP_X_SHIFT) - 1,
     .bitmask = 0x1,
     .read_only = true
 }};
-""".format(len(all_characters) * tile_x, tile_y, bytes_per_row / 4))
-
+""".format(len(all_characters) * tile_x, tile_y))
+
+
+codepoints = "NULL"
+if extra_codepoints:
+    codepoints = "font_codepoints"
+    c_file.write("""\
+const uint16_t font_codepoints[{}] = {{
+""".format(len(extra_codepoints)))
+    for i, codepoint in enumerate(extra_codepoints):
+        c_file.write("0x{:04x}, ".format(codepoint))
+        if (i + 1) % 8 == 0:
+            c_file.write("\n")
+    if len(extra_codepoints) % 8 != 0:
+        c_file.write("\n")
+    c_file.write("""\
+};
+""")
 
 c_file.write("""\
 const fontio_builtinfont_t supervisor_terminal_font = {{
@@ -172,10 +218,10 @@ const fontio_builtinfont_t supervisor_terminal_font = {{
     .bitmap = &supervisor_terminal_font_bitmap,
     .width = {},
     .height = {},
-    .unicode_characters = (const uint8_t*) "{}",
-    .unicode_characters_len = {}
+    .unicode_codepoints = {},
+    .unicode_codepoint_count = {}
 }};
-""".format(tile_x, tile_y, extra_characters, len(extra_characters.encode("utf-8"))))
+""".format(tile_x, tile_y, codepoints, len(extra_codepoints)))
 
 c_file.write("""\
 terminalio_terminal_obj_t supervisor_terminal = {
@@ -556,12 +556,22 @@ def freeze_mpy(base_qstrs, raw_codes):
     print('};')
 
     print()
+    if config.MICROPY_QSTR_HASH_INDEX:
+        index = qstrutil.compute_index([bytes_cons(qstr, 'utf8') for _, _, qstr in new])
+        print('STATIC const uint16_t mp_qstr_frozen_const_index[] = {')
+        for i in range(0, len(index), 16):
+            print('    %s,' % ', '.join(str(x) for x in index[i:i + 16]))
+        print('};')
+        print()
     print('extern const qstr_pool_t mp_qstr_const_pool;');
     print('const qstr_pool_t mp_qstr_frozen_const_pool = {')
     print('    (qstr_pool_t*)&mp_qstr_const_pool, // previous pool')
     print('    MP_QSTRnumber_of, // previous pool size')
     print('    %u, // allocated entries' % len(new))
     print('    %u, // used entries' % len(new))
+    if config.MICROPY_QSTR_HASH_INDEX:
+        print('    (uint16_t*)mp_qstr_frozen_const_index,')
+        print('    MP_ARRAY_SIZE(mp_qstr_frozen_const_index) - 1,')
     print('    {')
     qstr_size = {"metadata": 0, "data": 0}
     for _, _, qstr in new:
@@ -632,9 +642,11 @@ def main():
         qcfgs, base_qstrs, _ = qstrutil.parse_input_headers([args.qstr_header])
         config.MICROPY_QSTR_BYTES_IN_LEN = int(qcfgs['BYTES_IN_LEN'])
         config.MICROPY_QSTR_BYTES_IN_HASH = int(qcfgs['BYTES_IN_HASH'])
+        config.MICROPY_QSTR_HASH_INDEX = int(qcfgs.get('HASH_INDEX', '0'))
     else:
         config.MICROPY_QSTR_BYTES_IN_LEN = 1
         config.MICROPY_QSTR_BYTES_IN_HASH = 1
+        config.MICROPY_QSTR_HASH_INDEX = 0
         base_qstrs = {}
 
     raw_codes = [read_mpy(file) for file in args.files]